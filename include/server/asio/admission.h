@@ -0,0 +1,145 @@
+/*!
+    \file admission.h
+    \brief Admission control definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_ADMISSION_H
+#define CPPSERVER_ASIO_ADMISSION_H
+
+#include "time/timespan.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Admission control
+/*!
+    Admission control is used by servers to decide whether a new accepted
+    connection should be served or rejected under overload. It combines
+    the following limits (all of them are disabled by default):
+    - maximal count of connected sessions;
+    - token bucket accept rate;
+    - adaptive concurrency limit driven by the measured event-loop queue delay.
+
+    Servers measure the event-loop queue delay every 100 milliseconds. The
+    adaptive limit is decreased multiplicatively when the queue delay is above
+    the target and increased additively while it is below, so the admitted
+    clients keep a good latency instead of all of them timing out.
+
+    Thread-safe.
+*/
+class AdmissionControl
+{
+public:
+    AdmissionControl() noexcept;
+    AdmissionControl(const AdmissionControl&) = delete;
+    AdmissionControl(AdmissionControl&&) = delete;
+    ~AdmissionControl() = default;
+
+    AdmissionControl& operator=(const AdmissionControl&) = delete;
+    AdmissionControl& operator=(AdmissionControl&&) = delete;
+
+    //! Get the maximal count of sessions (0 - unlimited)
+    size_t max_sessions() const noexcept { return _max_sessions; }
+    //! Get the accept rate in connections per second (0 - unlimited)
+    double accept_rate() const noexcept { return _accept_rate; }
+    //! Get the accept burst size
+    size_t accept_burst() const noexcept { return _accept_burst; }
+    //! Get the target event-loop queue delay (zero - adaptive limit is disabled)
+    CppCommon::Timespan target_delay() const noexcept { return CppCommon::Timespan(_target_delay); }
+    //! Get the reject response sent to rejected connections
+    const std::vector<uint8_t>& reject_response() const noexcept { return _reject_response; }
+
+    //! Get the current adaptive concurrency limit
+    size_t limit() const noexcept { return _limit; }
+    //! Get the last measured event-loop queue delay
+    CppCommon::Timespan queue_delay() const noexcept { return CppCommon::Timespan(_queue_delay); }
+    //! Get the number of admitted connections
+    uint64_t admitted() const noexcept { return _admitted; }
+    //! Get the number of rejected connections
+    uint64_t rejected() const noexcept { return _rejected; }
+
+    //! Is the admission control enabled?
+    bool IsEnabled() const noexcept { return (_max_sessions > 0) || (_accept_rate > 0) || IsAdaptive(); }
+    //! Is the adaptive concurrency limit enabled?
+    bool IsAdaptive() const noexcept { return _target_delay > 0; }
+
+    //! Setup the maximal count of sessions
+    /*!
+        \param sessions - Maximal count of sessions (0 - unlimited)
+    */
+    void SetupMaxSessions(size_t sessions) noexcept { _max_sessions = sessions; }
+    //! Setup the token bucket accept rate
+    /*!
+        \param rate - Accept rate in connections per second (0 - unlimited)
+        \param burst - Accept burst size (default is 1)
+    */
+    void SetupAcceptRate(double rate, size_t burst = 1);
+    //! Setup the adaptive concurrency limit
+    /*!
+        \param target_delay - Target event-loop queue delay (zero - disable adaptive limit)
+        \param min_limit - Minimal concurrency limit (default is 1)
+    */
+    void SetupAdaptiveLimit(const CppCommon::Timespan& target_delay, size_t min_limit = 1);
+    //! Setup the reject response
+    /*!
+        The reject response is sent to rejected connections before closing
+        them. It is supported only by plain TCP servers, SSL servers close
+        rejected connections without any response.
+
+        The reject response is not synchronized with rejected connections,
+        so it should be set up before the server is started.
+
+        \param buffer - Reject response buffer
+        \param size - Reject response buffer size
+    */
+    void SetupRejectResponse(const void* buffer, size_t size);
+
+    //! Admit a new connection
+    /*!
+        \param sessions - Current count of connected sessions
+        \return 'true' if the connection is admitted, 'false' if the connection should be rejected
+    */
+    bool Admit(size_t sessions);
+
+    //! Update the adaptive concurrency limit with the measured event-loop queue delay
+    /*!
+        \param delay - Measured event-loop queue delay
+        \param sessions - Current count of connected sessions
+    */
+    void Update(const CppCommon::Timespan& delay, size_t sessions);
+
+    //! Reset admission control state and statistic
+    void Reset();
+
+private:
+    std::mutex _lock;
+    // Limits (atomic to be checked by accepts without the lock)
+    std::atomic<size_t> _max_sessions;
+    std::atomic<double> _accept_rate;
+    std::atomic<size_t> _accept_burst;
+    std::atomic<int64_t> _target_delay;
+    size_t _min_limit;
+    std::vector<uint8_t> _reject_response;
+    // Token bucket
+    double _tokens;
+    uint64_t _tokens_timestamp;
+    // Adaptive limit
+    std::atomic<size_t> _limit;
+    std::atomic<int64_t> _queue_delay;
+    // Statistic
+    std::atomic<uint64_t> _admitted;
+    std::atomic<uint64_t> _rejected;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_ADMISSION_H
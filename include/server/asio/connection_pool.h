@@ -0,0 +1,395 @@
+/*!
+    \file connection_pool.h
+    \brief Connection pool definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_CONNECTION_POOL_H
+#define CPPSERVER_ASIO_CONNECTION_POOL_H
+
+#include "ssl_client.h"
+#include "tcp_client.h"
+
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+template <class TClient>
+class ConnectionPool;
+
+//! Pooled connection state
+enum class PooledState
+{
+    Connecting,                         //!< Connection is in progress
+    Idle,                               //!< Connection is ready and waits for the checkout
+    Busy,                               //!< Connection is checked out of the pool
+    Closed                              //!< Connection was removed from the pool
+};
+
+//! Pooled TCP client
+/*!
+    Pooled TCP client is a TCP client which notifies its connection pool
+    ('ConnectionPool') when it is connected or disconnected. Connection
+    is ready to be checked out when it is connected.
+
+    Overridden 'onConnected()' and 'onDisconnected()' handlers should
+    call the base ones.
+
+    Thread-safe.
+*/
+class PooledTCPClient : public TCPClient
+{
+public:
+    using TCPClient::TCPClient;
+
+    //! Get the pooled connection state
+    PooledState pooled_state() const noexcept { return _pooled_state; }
+
+    //! Is the connection ready to be checked out?
+    bool IsReady() const noexcept { return IsConnected(); }
+
+protected:
+    void onConnected() override { if (_pool_handler) _pool_handler(true); }
+    void onDisconnected() override { if (_pool_handler) _pool_handler(false); }
+
+private:
+    template <class TClient>
+    friend class ConnectionPool;
+
+    // Pool state (changed under the pool lock)
+    asio::ip::tcp::endpoint _pooled_endpoint;
+    std::atomic<PooledState> _pooled_state{PooledState::Connecting};
+    uint64_t _pooled_timestamp{0};
+    // Pool notification handler
+    std::function<void(bool)> _pool_handler;
+};
+
+//! Pooled SSL client
+/*!
+    Pooled SSL client is a SSL client which notifies its connection pool
+    ('ConnectionPool') when it is handshaked or disconnected. Connection
+    is ready to be checked out when it is handshaked, so the pool keeps
+    warm connections without the TLS handshake latency.
+
+    Overridden 'onHandshaked()' and 'onDisconnected()' handlers should
+    call the base ones.
+
+    Thread-safe.
+*/
+class PooledSSLClient : public SSLClient
+{
+public:
+    using SSLClient::SSLClient;
+
+    //! Get the pooled connection state
+    PooledState pooled_state() const noexcept { return _pooled_state; }
+
+    //! Is the connection ready to be checked out?
+    bool IsReady() const noexcept { return IsHandshaked(); }
+
+protected:
+    void onHandshaked() override { if (_pool_handler) _pool_handler(true); }
+    void onDisconnected() override { if (_pool_handler) _pool_handler(false); }
+
+private:
+    template <class TClient>
+    friend class ConnectionPool;
+
+    // Pool state (changed under the pool lock)
+    asio::ip::tcp::endpoint _pooled_endpoint;
+    std::atomic<PooledState> _pooled_state{PooledState::Connecting};
+    uint64_t _pooled_timestamp{0};
+    // Pool notification handler
+    std::function<void(bool)> _pool_handler;
+};
+
+//! Connection pool
+/*!
+    Connection pool keeps connected clients to the server endpoints and lends
+    them to callers, so a call does not pay the connect latency and the full
+    TLS handshake. Clients are created with 'CreateClient()' factory method
+    and should be derived from 'PooledTCPClient' or 'PooledSSLClient'.
+
+    Each endpoint has its own idle connections, waiting checkouts and limits:
+    - minimal count of connections is kept warm by the maintenance timer;
+    - maximal count of connections limits the connections of the endpoint,
+      further checkouts wait for the returned connection.
+
+    The most recently returned connection is checked out first, so idle
+    connections above the minimal count age and are evicted after the idle
+    timeout. The maintenance timer also checks the health of idle connections
+    with 'CheckHealth()' method and expires waiting checkouts after the
+    checkout timeout.
+
+    Clients take Asio IO services of the Asio service in round-robin, so
+    connects and connection handlers are spread over the service threads.
+    The checkout handler is called with the IO service (strand) of the
+    checked out client, or with 'nullptr' if the checkout was expired or
+    the pool was stopped.
+
+    Thread-safe.
+*/
+template <class TClient>
+class ConnectionPool : public std::enable_shared_from_this<ConnectionPool<TClient>>
+{
+public:
+    //! Checkout handler
+    typedef std::function<void(std::shared_ptr<TClient>)> CheckoutHandler;
+
+    //! Initialize connection pool with a given Asio service
+    /*!
+        \param service - Asio service
+    */
+    explicit ConnectionPool(std::shared_ptr<Service> service);
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool(ConnectionPool&&) = delete;
+    virtual ~ConnectionPool() = default;
+
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(ConnectionPool&&) = delete;
+
+    //! Get the Asio service
+    std::shared_ptr<Service>& service() noexcept { return _service; }
+
+    //! Get the count of pooled connections
+    size_t connections() const;
+    //! Get the count of pooled connections to the given endpoint
+    size_t connections(const asio::ip::tcp::endpoint& endpoint) const;
+    //! Get the count of idle connections
+    size_t idle_connections() const;
+    //! Get the count of waiting checkouts
+    size_t waiting_checkouts() const;
+
+    //! Get the number of checkouts
+    uint64_t checkouts() const noexcept { return _checkouts; }
+    //! Get the number of checkouts served with the idle connection
+    uint64_t hits() const noexcept { return _hits; }
+    //! Get the number of checkouts which waited for the connection
+    uint64_t misses() const noexcept { return _misses; }
+    //! Get the number of expired checkouts
+    uint64_t timeouts() const noexcept { return _timeouts; }
+    //! Get the number of connects
+    uint64_t connects() const noexcept { return _connects; }
+    //! Get the number of failed connects
+    uint64_t connects_failed() const noexcept { return _connects_failed; }
+    //! Get the number of evicted idle connections
+    uint64_t evictions() const noexcept { return _evictions; }
+    //! Get the number of idle connections failed the health check
+    uint64_t health_checks_failed() const noexcept { return _health_checks_failed; }
+    //! Get the total wait time of served waiting checkouts
+    CppCommon::Timespan wait_time() const noexcept { return CppCommon::Timespan(_wait_time); }
+    //! Get the maximal wait time of served waiting checkouts
+    CppCommon::Timespan wait_time_max() const noexcept { return CppCommon::Timespan(_wait_time_max); }
+    //! Get the average wait time of served waiting checkouts
+    CppCommon::Timespan wait_time_avg() const noexcept { return CppCommon::Timespan((_waits > 0) ? (_wait_time / _waits) : 0); }
+    //! Get the ratio of checkouts served with the idle connection
+    double hit_rate() const noexcept { return (_checkouts > 0) ? ((double)_hits / (double)_checkouts) : 0.0; }
+
+    //! Get the option: minimal count of connections per endpoint
+    size_t option_min_connections() const noexcept { return _option_min_connections; }
+    //! Get the option: maximal count of connections per endpoint
+    size_t option_max_connections() const noexcept { return _option_max_connections; }
+    //! Get the option: idle timeout
+    const CppCommon::Timespan& option_idle_timeout() const noexcept { return _option_idle_timeout; }
+    //! Get the option: checkout timeout
+    const CppCommon::Timespan& option_checkout_timeout() const noexcept { return _option_checkout_timeout; }
+    //! Get the option: maintenance interval
+    const CppCommon::Timespan& option_maintenance_interval() const noexcept { return _option_maintenance_interval; }
+
+    //! Is the pool started?
+    bool IsStarted() const noexcept { return _started; }
+
+    //! Start the pool
+    /*!
+        \return 'true' if the pool was successfully started, 'false' if the pool failed to start
+    */
+    virtual bool Start();
+    //! Stop the pool
+    /*!
+        Idle and connecting connections are disconnected, waiting checkouts
+        are completed with 'nullptr'. Checked out connections are disconnected
+        when they are returned.
+
+        \return 'true' if the pool was successfully stopped, 'false' if the pool is already stopped
+    */
+    virtual bool Stop();
+
+    //! Open the minimal count of connections to the given endpoint
+    /*!
+        \param endpoint - Server TCP endpoint
+        \return 'true' if the endpoint was successfully prepared, 'false' if the pool is not started
+    */
+    virtual bool Warmup(const asio::ip::tcp::endpoint& endpoint);
+
+    //! Checkout the connection to the given endpoint (asynchronous)
+    /*!
+        \param endpoint - Server TCP endpoint
+        \param handler - Checkout handler
+        \return 'true' if the checkout was successfully started, 'false' if the pool is not started
+    */
+    virtual bool CheckoutAsync(const asio::ip::tcp::endpoint& endpoint, const CheckoutHandler& handler);
+    //! Return the checked out connection into the pool
+    /*!
+        The connection which is not ready any more is removed from the pool.
+
+        \param client - Checked out client
+        \return 'true' if the connection was successfully returned, 'false' if the connection was removed from the pool
+    */
+    virtual bool Return(std::shared_ptr<TClient> client);
+
+    //! Setup option: minimal and maximal count of connections per endpoint
+    /*!
+        \param min_connections - Minimal count of connections kept warm (default is 0)
+        \param max_connections - Maximal count of connections (default is 16)
+    */
+    void SetupConnections(size_t min_connections, size_t max_connections) noexcept { _option_min_connections = min_connections; _option_max_connections = std::max(max_connections, (size_t)1); }
+    //! Setup option: idle timeout
+    /*!
+        Idle connections above the minimal count are evicted after this timeout.
+
+        \param timeout - Idle timeout (default is 60 seconds)
+    */
+    void SetupIdleTimeout(const CppCommon::Timespan& timeout) noexcept { _option_idle_timeout = timeout; }
+    //! Setup option: checkout timeout
+    /*!
+        \param timeout - Checkout timeout (zero - wait forever, default is zero)
+    */
+    void SetupCheckoutTimeout(const CppCommon::Timespan& timeout) noexcept { _option_checkout_timeout = timeout; }
+    //! Setup option: maintenance interval
+    /*!
+        Maintenance interval is the period of health checks, idle evictions and
+        checkout timeouts, so it also limits their precision.
+
+        \param interval - Maintenance interval (default is 1 second)
+    */
+    void SetupMaintenanceInterval(const CppCommon::Timespan& interval) noexcept { _option_maintenance_interval = interval; }
+
+    //! Reset the pool statistic
+    void ResetStatistic() noexcept;
+
+protected:
+    //! Create a new client
+    /*!
+        Method should be overridden to create clients of the pool with
+        the given Asio service and server endpoint. It is called without
+        the pool lock.
+
+        \param service - Asio service
+        \param endpoint - Server TCP endpoint
+        \return Client, 'nullptr' if failed to create the client
+    */
+    virtual std::shared_ptr<TClient> CreateClient(std::shared_ptr<Service> service, const asio::ip::tcp::endpoint& endpoint) { return nullptr; }
+
+    //! Check the health of the idle connection
+    /*!
+        Method could be overridden to check the connection with the application
+        protocol. Unhealthy connections are disconnected and removed from the pool.
+
+        Method is called by the maintenance timer without the pool lock, so it
+        could block or call the pool. The connection might be checked out by
+        another caller during the check, then it is not removed from the pool.
+
+        \param client - Idle client
+        \return 'true' if the connection is healthy, 'false' if the connection should be removed
+    */
+    virtual bool CheckHealth(std::shared_ptr<TClient>& client) { return client->IsReady(); }
+
+private:
+    // Waiting checkout
+    struct Waiter
+    {
+        CheckoutHandler handler;
+        uint64_t timestamp;
+    };
+
+    // Pooled endpoint
+    struct Endpoint
+    {
+        // All pooled connections of the endpoint
+        std::vector<std::shared_ptr<TClient>> clients;
+        // Idle connections (the most recently returned is the last)
+        std::vector<std::shared_ptr<TClient>> idle;
+        // Waiting checkouts
+        std::deque<Waiter> waiters;
+        size_t connecting{0};
+        // Connects reserved for clients which are being created
+        size_t creating{0};
+    };
+
+    // Asio service
+    std::shared_ptr<Service> _service;
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    bool _strand_required;
+    // Pool state
+    std::atomic<bool> _started;
+    // Pooled endpoints
+    mutable std::mutex _lock;
+    std::map<asio::ip::tcp::endpoint, Endpoint> _endpoints;
+    // Maintenance timer
+    asio::system_timer _timer;
+    // Pool statistic
+    std::atomic<uint64_t> _checkouts;
+    std::atomic<uint64_t> _hits;
+    std::atomic<uint64_t> _misses;
+    std::atomic<uint64_t> _timeouts;
+    std::atomic<uint64_t> _connects;
+    std::atomic<uint64_t> _connects_failed;
+    std::atomic<uint64_t> _evictions;
+    std::atomic<uint64_t> _health_checks_failed;
+    std::atomic<uint64_t> _waits;
+    std::atomic<uint64_t> _wait_time;
+    std::atomic<uint64_t> _wait_time_max;
+    // Options
+    size_t _option_min_connections;
+    size_t _option_max_connections;
+    CppCommon::Timespan _option_idle_timeout;
+    CppCommon::Timespan _option_checkout_timeout;
+    CppCommon::Timespan _option_maintenance_interval;
+
+    //! Reserve new connects to the endpoint up to the required count (under the lock)
+    void Replenish(const asio::ip::tcp::endpoint& key, Endpoint& endpoint, std::vector<asio::ip::tcp::endpoint>& connects);
+    //! Take the next waiting checkout for the ready connection (under the lock)
+    bool TakeWaiter(Endpoint& endpoint, std::shared_ptr<TClient>& client, CheckoutHandler& handler);
+    //! Remove the connection from the endpoint (under the lock)
+    void Remove(Endpoint& endpoint, const std::shared_ptr<TClient>& client);
+
+    //! Create and connect new clients for reserved connects (without the lock)
+    void Connect(const std::vector<asio::ip::tcp::endpoint>& connects);
+    //! Complete the checkout with the given client
+    void Complete(const CheckoutHandler& handler, std::shared_ptr<TClient> client);
+
+    //! Handle the pooled client connected or disconnected notification
+    void onClient(std::shared_ptr<TClient> client, bool ready);
+
+    //! Schedule the maintenance timer
+    void Schedule();
+    //! Perform the maintenance of pooled endpoints
+    void Maintain();
+};
+
+//! TCP connection pool
+typedef ConnectionPool<PooledTCPClient> TCPConnectionPool;
+//! SSL connection pool
+typedef ConnectionPool<PooledSSLClient> SSLConnectionPool;
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "connection_pool.inl"
+
+#endif // CPPSERVER_ASIO_CONNECTION_POOL_H
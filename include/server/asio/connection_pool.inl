@@ -0,0 +1,576 @@
+/*!
+    \file connection_pool.inl
+    \brief Connection pool inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppServer {
+namespace Asio {
+
+template <class TClient>
+inline ConnectionPool<TClient>::ConnectionPool(std::shared_ptr<Service> service)
+    : _service(service),
+      _io_service(_service->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_service->IsStrandRequired()),
+      _started(false),
+      _timer(*_io_service),
+      _checkouts(0),
+      _hits(0),
+      _misses(0),
+      _timeouts(0),
+      _connects(0),
+      _connects_failed(0),
+      _evictions(0),
+      _health_checks_failed(0),
+      _waits(0),
+      _wait_time(0),
+      _wait_time_max(0),
+      _option_min_connections(0),
+      _option_max_connections(16),
+      _option_idle_timeout(CppCommon::Timespan::seconds(60)),
+      _option_checkout_timeout(CppCommon::Timespan::zero()),
+      _option_maintenance_interval(CppCommon::Timespan::seconds(1))
+{
+    assert((service != nullptr) && "Asio service is invalid!");
+    if (service == nullptr)
+        throw CppCommon::ArgumentException("Asio service is invalid!");
+}
+
+template <class TClient>
+inline size_t ConnectionPool<TClient>::connections() const
+{
+    std::scoped_lock locker(_lock);
+
+    size_t result = 0;
+    for (auto& endpoint : _endpoints)
+        result += endpoint.second.clients.size();
+    return result;
+}
+
+template <class TClient>
+inline size_t ConnectionPool<TClient>::connections(const asio::ip::tcp::endpoint& endpoint) const
+{
+    std::scoped_lock locker(_lock);
+
+    auto it = _endpoints.find(endpoint);
+    return (it != _endpoints.end()) ? it->second.clients.size() : 0;
+}
+
+template <class TClient>
+inline size_t ConnectionPool<TClient>::idle_connections() const
+{
+    std::scoped_lock locker(_lock);
+
+    size_t result = 0;
+    for (auto& endpoint : _endpoints)
+        result += endpoint.second.idle.size();
+    return result;
+}
+
+template <class TClient>
+inline size_t ConnectionPool<TClient>::waiting_checkouts() const
+{
+    std::scoped_lock locker(_lock);
+
+    size_t result = 0;
+    for (auto& endpoint : _endpoints)
+        result += endpoint.second.waiters.size();
+    return result;
+}
+
+template <class TClient>
+inline bool ConnectionPool<TClient>::Start()
+{
+    if (IsStarted())
+        return false;
+
+    // Update the started flag
+    _started = true;
+
+    // Start the maintenance timer
+    Schedule();
+
+    return true;
+}
+
+template <class TClient>
+inline bool ConnectionPool<TClient>::Stop()
+{
+    if (!IsStarted())
+        return false;
+
+    // Update the started flag
+    _started = false;
+
+    // Cancel the maintenance timer
+    asio::error_code ec;
+    _timer.cancel(ec);
+
+    std::vector<std::shared_ptr<TClient>> disconnects;
+    std::vector<CheckoutHandler> handlers;
+    {
+        std::scoped_lock locker(_lock);
+
+        for (auto& endpoint : _endpoints)
+        {
+            // Connecting and checked out connections are disconnected later
+            for (auto& client : endpoint.second.clients)
+                client->_pooled_state = PooledState::Closed;
+            disconnects.insert(disconnects.end(), endpoint.second.idle.begin(), endpoint.second.idle.end());
+            for (auto& waiter : endpoint.second.waiters)
+                handlers.emplace_back(std::move(waiter.handler));
+        }
+        _endpoints.clear();
+    }
+
+    // Disconnect idle connections
+    for (auto& client : disconnects)
+        client->DisconnectAsync();
+
+    // Complete waiting checkouts
+    for (auto& handler : handlers)
+        Complete(handler, nullptr);
+
+    return true;
+}
+
+template <class TClient>
+inline bool ConnectionPool<TClient>::Warmup(const asio::ip::tcp::endpoint& endpoint)
+{
+    if (!IsStarted())
+        return false;
+
+    std::vector<asio::ip::tcp::endpoint> connects;
+    {
+        std::scoped_lock locker(_lock);
+
+        Replenish(endpoint, _endpoints[endpoint], connects);
+    }
+
+    // Connect new clients
+    Connect(connects);
+
+    return true;
+}
+
+template <class TClient>
+inline bool ConnectionPool<TClient>::CheckoutAsync(const asio::ip::tcp::endpoint& endpoint, const CheckoutHandler& handler)
+{
+    assert(handler && "Checkout handler is invalid!");
+    if (!handler)
+        return false;
+
+    if (!IsStarted())
+        return false;
+
+    std::shared_ptr<TClient> client;
+    std::vector<asio::ip::tcp::endpoint> connects;
+    {
+        std::scoped_lock locker(_lock);
+
+        if (!IsStarted())
+            return false;
+
+        auto& pooled = _endpoints[endpoint];
+
+        // Take the most recently returned connection which is still ready.
+        // Not ready connections are removed by their disconnected handler.
+        while (!pooled.idle.empty() && !client)
+        {
+            if (pooled.idle.back()->IsReady())
+            {
+                client = pooled.idle.back();
+                client->_pooled_state = PooledState::Busy;
+            }
+            pooled.idle.pop_back();
+        }
+
+        ++_checkouts;
+
+        if (client)
+            ++_hits;
+        else
+        {
+            ++_misses;
+
+            // Wait for the returned or a new connection
+            pooled.waiters.push_back(Waiter{ handler, (uint64_t)CppCommon::Timestamp::nano() });
+            Replenish(endpoint, pooled, connects);
+        }
+    }
+
+    // Complete the checkout with the idle connection
+    if (client)
+        Complete(handler, client);
+
+    // Connect new clients
+    Connect(connects);
+
+    return true;
+}
+
+template <class TClient>
+inline bool ConnectionPool<TClient>::Return(std::shared_ptr<TClient> client)
+{
+    assert((client != nullptr) && "Pooled client is invalid!");
+    if (client == nullptr)
+        return false;
+
+    CheckoutHandler handler;
+    bool closed = false;
+    {
+        std::scoped_lock locker(_lock);
+
+        if (client->_pooled_state == PooledState::Closed)
+            closed = true;
+        else if ((client->_pooled_state != PooledState::Busy) || !client->IsReady())
+        {
+            // Not ready connection is removed by its disconnected handler
+            return false;
+        }
+        else
+        {
+            auto it = _endpoints.find(client->_pooled_endpoint);
+            assert((it != _endpoints.end()) && "Pooled endpoint is not found!");
+
+            // Hand the connection over to the next waiting checkout or keep it idle
+            if (!TakeWaiter(it->second, client, handler))
+            {
+                client->_pooled_state = PooledState::Idle;
+                client->_pooled_timestamp = CppCommon::Timestamp::nano();
+                it->second.idle.push_back(client);
+            }
+        }
+    }
+
+    // Disconnect the connection removed from the pool or checked out before the pool was stopped
+    if (closed)
+    {
+        client->DisconnectAsync();
+        return false;
+    }
+
+    // Complete the waiting checkout with the returned connection
+    if (handler)
+        Complete(handler, client);
+
+    return true;
+}
+
+template <class TClient>
+inline void ConnectionPool<TClient>::ResetStatistic() noexcept
+{
+    _checkouts = 0;
+    _hits = 0;
+    _misses = 0;
+    _timeouts = 0;
+    _connects = 0;
+    _connects_failed = 0;
+    _evictions = 0;
+    _health_checks_failed = 0;
+    _waits = 0;
+    _wait_time = 0;
+    _wait_time_max = 0;
+}
+
+template <class TClient>
+inline void ConnectionPool<TClient>::Replenish(const asio::ip::tcp::endpoint& key, Endpoint& endpoint, std::vector<asio::ip::tcp::endpoint>& connects)
+{
+    // Keep the minimal count of connections and connect one client per waiting checkout.
+    // Clients are created later without the lock, so their connects are reserved here.
+    while (((endpoint.clients.size() + endpoint.creating) < _option_max_connections) && (((endpoint.clients.size() + endpoint.creating) < _option_min_connections) || ((endpoint.connecting + endpoint.creating) < endpoint.waiters.size())))
+    {
+        ++endpoint.creating;
+        connects.push_back(key);
+    }
+}
+
+template <class TClient>
+inline bool ConnectionPool<TClient>::TakeWaiter(Endpoint& endpoint, std::shared_ptr<TClient>& client, CheckoutHandler& handler)
+{
+    if (endpoint.waiters.empty())
+        return false;
+
+    auto& waiter = endpoint.waiters.front();
+
+    // Update the wait time statistic
+    uint64_t wait = CppCommon::Timestamp::nano() - waiter.timestamp;
+    ++_waits;
+    _wait_time += wait;
+    if (wait > _wait_time_max)
+        _wait_time_max = wait;
+
+    handler = std::move(waiter.handler);
+    endpoint.waiters.pop_front();
+
+    client->_pooled_state = PooledState::Busy;
+
+    return true;
+}
+
+template <class TClient>
+inline void ConnectionPool<TClient>::Remove(Endpoint& endpoint, const std::shared_ptr<TClient>& client)
+{
+    auto it = std::find(endpoint.clients.begin(), endpoint.clients.end(), client);
+    if (it != endpoint.clients.end())
+        endpoint.clients.erase(it);
+    it = std::find(endpoint.idle.begin(), endpoint.idle.end(), client);
+    if (it != endpoint.idle.end())
+        endpoint.idle.erase(it);
+
+    client->_pooled_state = PooledState::Closed;
+}
+
+template <class TClient>
+inline void ConnectionPool<TClient>::Connect(const std::vector<asio::ip::tcp::endpoint>& connects)
+{
+    for (auto& key : connects)
+    {
+        // Create the client without the lock
+        auto client = CreateClient(_service, key);
+        if (client)
+        {
+            // Notify the pool about the connection state with weak references
+            std::weak_ptr<ConnectionPool<TClient>> weak_pool(this->shared_from_this());
+            std::weak_ptr<TClient> weak_client(client);
+            client->_pool_handler = [weak_pool, weak_client](bool ready)
+            {
+                auto pool = weak_pool.lock();
+                auto client = weak_client.lock();
+                if (pool && client)
+                    pool->onClient(client, ready);
+            };
+            client->_pooled_endpoint = key;
+            client->_pooled_state = PooledState::Connecting;
+        }
+
+        {
+            std::scoped_lock locker(_lock);
+
+            // Endpoints are cleared when the pool is stopped
+            auto it = _endpoints.find(key);
+            if (it == _endpoints.end())
+                continue;
+            auto& endpoint = it->second;
+
+            // Release the reserved connect
+            if (endpoint.creating > 0)
+                --endpoint.creating;
+
+            if (!client || !IsStarted())
+                continue;
+
+            endpoint.clients.push_back(client);
+            ++endpoint.connecting;
+        }
+
+        // Clients are bound to IO services of the Asio service in round-robin,
+        // so connects and handshakes are performed by different service threads
+        if (!client->ConnectAsync())
+            onClient(client, false);
+    }
+}
+
+template <class TClient>
+inline void ConnectionPool<TClient>::Complete(const CheckoutHandler& handler, std::shared_ptr<TClient> client)
+{
+    // Call the checkout handler with the IO service of the checked out client
+    auto complete_handler = [handler, client]() { handler(client); };
+    if (client)
+    {
+        if (_strand_required)
+            client->strand().post(complete_handler);
+        else
+            client->io_service()->post(complete_handler);
+    }
+    else
+    {
+        if (_strand_required)
+            _strand.post(complete_handler);
+        else
+            _io_service->post(complete_handler);
+    }
+}
+
+template <class TClient>
+inline void ConnectionPool<TClient>::onClient(std::shared_ptr<TClient> client, bool ready)
+{
+    CheckoutHandler handler;
+    std::vector<asio::ip::tcp::endpoint> connects;
+    bool closed = false;
+    {
+        std::scoped_lock locker(_lock);
+
+        if (client->_pooled_state == PooledState::Closed)
+            closed = true;
+        else
+        {
+            auto it = _endpoints.find(client->_pooled_endpoint);
+            assert((it != _endpoints.end()) && "Pooled endpoint is not found!");
+            auto& endpoint = it->second;
+
+            if (ready)
+            {
+                if (client->_pooled_state == PooledState::Connecting)
+                {
+                    --endpoint.connecting;
+                    ++_connects;
+
+                    // Hand the new connection over to the next waiting checkout or keep it idle
+                    if (!TakeWaiter(endpoint, client, handler))
+                    {
+                        client->_pooled_state = PooledState::Idle;
+                        client->_pooled_timestamp = CppCommon::Timestamp::nano();
+                        endpoint.idle.push_back(client);
+                    }
+                }
+            }
+            else if (client->_pooled_state == PooledState::Connecting)
+            {
+                // Failed connects are retried by the maintenance timer
+                --endpoint.connecting;
+                ++_connects_failed;
+                Remove(endpoint, client);
+            }
+            else
+            {
+                // Replace the lost connection for waiting checkouts
+                Remove(endpoint, client);
+                Replenish(it->first, endpoint, connects);
+            }
+        }
+    }
+
+    // Disconnect the connection which was connected after the pool was stopped
+    if (closed && ready)
+        client->DisconnectAsync();
+
+    // Complete the waiting checkout with the new connection
+    if (handler)
+        Complete(handler, client);
+
+    // Connect new clients
+    Connect(connects);
+}
+
+template <class TClient>
+inline void ConnectionPool<TClient>::Schedule()
+{
+    if (!IsStarted() || (option_maintenance_interval().total() <= 0))
+        return;
+
+    // Maintain pooled endpoints once per interval
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const asio::error_code& ec)
+    {
+        if (ec || !IsStarted())
+            return;
+
+        Maintain();
+
+        // Schedule the next maintenance
+        Schedule();
+    };
+    _timer.expires_from_now(std::chrono::nanoseconds(option_maintenance_interval().total()));
+    if (_strand_required)
+        _timer.async_wait(bind_executor(_strand, async_wait_handler));
+    else
+        _timer.async_wait(async_wait_handler);
+}
+
+template <class TClient>
+inline void ConnectionPool<TClient>::Maintain()
+{
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+    uint64_t checkout_timeout = (uint64_t)std::max(option_checkout_timeout().total(), (int64_t)0);
+    uint64_t idle_timeout = (uint64_t)std::max(option_idle_timeout().total(), (int64_t)0);
+
+    std::vector<std::shared_ptr<TClient>> disconnects;
+    std::vector<std::shared_ptr<TClient>> checks;
+    std::vector<asio::ip::tcp::endpoint> connects;
+    std::vector<CheckoutHandler> handlers;
+    {
+        std::scoped_lock locker(_lock);
+
+        for (auto& it : _endpoints)
+        {
+            auto& endpoint = it.second;
+
+            // Expire waiting checkouts
+            while ((checkout_timeout > 0) && !endpoint.waiters.empty() && ((timestamp - endpoint.waiters.front().timestamp) >= checkout_timeout))
+            {
+                handlers.emplace_back(std::move(endpoint.waiters.front().handler));
+                endpoint.waiters.pop_front();
+                ++_timeouts;
+            }
+
+            // Evict the oldest idle connections above the minimal count
+            while ((idle_timeout > 0) && !endpoint.idle.empty() && (endpoint.clients.size() > _option_min_connections) && ((timestamp - endpoint.idle.front()->_pooled_timestamp) >= idle_timeout))
+            {
+                auto client = endpoint.idle.front();
+                Remove(endpoint, client);
+                disconnects.push_back(client);
+                ++_evictions;
+            }
+
+            // Take idle connections to check their health without the lock
+            checks.insert(checks.end(), endpoint.idle.begin(), endpoint.idle.end());
+        }
+    }
+
+    // Check the health of idle connections
+    std::vector<std::shared_ptr<TClient>> unhealthy;
+    for (auto& client : checks)
+        if (!CheckHealth(client))
+            unhealthy.push_back(client);
+
+    {
+        std::scoped_lock locker(_lock);
+
+        // Remove unhealthy connections which are still idle
+        for (auto& client : unhealthy)
+        {
+            if (client->_pooled_state != PooledState::Idle)
+                continue;
+
+            auto it = _endpoints.find(client->_pooled_endpoint);
+            if (it == _endpoints.end())
+                continue;
+
+            Remove(it->second, client);
+            disconnects.push_back(client);
+            ++_health_checks_failed;
+        }
+
+        for (auto it = _endpoints.begin(); it != _endpoints.end();)
+        {
+            auto& endpoint = it->second;
+
+            // Restore the minimal count of connections and retry failed connects
+            Replenish(it->first, endpoint, connects);
+
+            // Remove unused endpoints
+            if (endpoint.clients.empty() && endpoint.waiters.empty() && (endpoint.creating == 0))
+                it = _endpoints.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // Disconnect evicted and unhealthy connections
+    for (auto& client : disconnects)
+        client->DisconnectAsync();
+
+    // Complete expired checkouts
+    for (auto& handler : handlers)
+        Complete(handler, nullptr);
+
+    // Connect new clients
+    Connect(connects);
+}
+
+} // namespace Asio
+} // namespace CppServer
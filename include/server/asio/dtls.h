@@ -0,0 +1,247 @@
+/*!
+    \file dtls.h
+    \brief DTLS protocol definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_DTLS_H
+#define CPPSERVER_ASIO_DTLS_H
+
+#include "asio.h"
+#include "rudp.h"
+
+#include "time/timespan.h"
+
+#include <string>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! DTLS protocol
+/*!
+    DTLS protocol is a transport independent OpenSSL DTLS engine over
+    the datagram BIO without the socket. Each datagram produced by OpenSSL
+    is pushed into the output queue and each received datagram is passed
+    with 'Input()', so the engine could be driven by any UDP server or
+    client (including batched receive and send).
+
+    Server side protocol performs the stateless cookie exchange with
+    'DTLSv1_listen()' before the handshake. Cookies are HMAC-SHA256 of
+    the peer identity with the secret key of the server. Cookie callbacks
+    should be installed into the SSL context with 'SetupCookieExchange()'.
+
+    Messages sent before the handshake are queued and encrypted when it is
+    completed. Each message is encrypted into the single DTLS record sent
+    in the single datagram, so message boundaries are kept. Decrypted
+    messages are collected into the delivered queue.
+
+    'Flush()' should be called when the handshake retransmission timer
+    expires ('timeout()').
+
+    Not thread-safe.
+*/
+class DTLSProtocol
+{
+public:
+    //! Cookie secret key size
+    static constexpr size_t COOKIE_SECRET_SIZE = 32;
+    //! Maximal message payload size (the maximal DTLS record plaintext)
+    static constexpr size_t MAX_PAYLOAD = 16384;
+
+    DTLSProtocol();
+    DTLSProtocol(const DTLSProtocol&) = delete;
+    DTLSProtocol(DTLSProtocol&&) = delete;
+    ~DTLSProtocol();
+
+    DTLSProtocol& operator=(const DTLSProtocol&) = delete;
+    DTLSProtocol& operator=(DTLSProtocol&&) = delete;
+
+    //! Get the number of messages sent
+    uint64_t messages_sent() const noexcept { return _messages_sent; }
+    //! Get the number of messages delivered
+    uint64_t messages_received() const noexcept { return _messages_received; }
+    //! Get the number of datagrams sent (including handshake and retransmissions)
+    uint64_t datagrams_sent() const noexcept { return _datagrams_sent; }
+    //! Get the number of datagrams received
+    uint64_t datagrams_received() const noexcept { return _datagrams_received; }
+    //! Get the number of handshake flight retransmissions
+    uint64_t retransmits() const noexcept { return _retransmits; }
+    //! Get the number of sent cookies (HelloVerifyRequest messages)
+    uint64_t cookies_sent() const noexcept { return _cookies_sent; }
+
+    //! Get the SSL error code of the failed protocol
+    unsigned long error() const noexcept { return _error; }
+    //! Get the count of messages waiting for the handshake
+    size_t send_queued() const noexcept { return _pending.sizes.size(); }
+
+    //! Get the option: MTU
+    size_t option_mtu() const noexcept { return _option_mtu; }
+
+    //! Is the protocol opened?
+    bool IsOpened() const noexcept { return (_ssl != nullptr); }
+    //! Is the server protocol waiting for the valid cookie?
+    bool IsListening() const noexcept { return _listening; }
+    //! Is the handshake completed?
+    bool IsHandshaked() const noexcept { return _handshaked; }
+    //! Is the protocol closed by the peer close notify alert?
+    bool IsClosed() const noexcept { return _closed; }
+    //! Is the protocol failed?
+    bool IsFailed() const noexcept { return _failed; }
+    //! Is the handshake retransmission timer running?
+    bool IsPending() const;
+
+    //! Get the time left to the handshake retransmission
+    CppCommon::Timespan timeout() const;
+
+    //! Setup option: MTU
+    /*!
+        MTU limits the size of datagrams with handshake messages. It should be
+        set up before 'Open()'.
+
+        \param mtu - Maximal datagram payload size (default is 1400 bytes)
+    */
+    void SetupMTU(size_t mtu) noexcept { _option_mtu = mtu; }
+    //! Setup the cookie of the server protocol
+    /*!
+        \param secret - Cookie secret key of COOKIE_SECRET_SIZE bytes
+        \param peer - Peer identity (e.g. address and port of the peer)
+    */
+    void SetupCookie(const uint8_t* secret, const std::string& peer);
+
+    //! Open the protocol
+    /*!
+        The SSL context should be created with the DTLS method (e.g. 'DTLS_method()').
+
+        \param context - SSL context
+        \param server - Server side flag
+        \return 'true' if the protocol was successfully opened, 'false' if failed to create the SSL object
+    */
+    bool Open(SSL_CTX* context, bool server);
+    //! Close the protocol
+    /*!
+        Protocol statistic is kept until the protocol is opened again.
+    */
+    void Close();
+
+    //! Start the client handshake
+    /*!
+        \return 'true' if the handshake was successfully started, 'false' if the protocol failed
+    */
+    bool Connect();
+    //! Perform the stateless cookie exchange with the received datagram
+    /*!
+        Server protocol replies to ClientHello without the valid cookie with
+        HelloVerifyRequest. The protocol never starts the handshake, so it
+        could be reused for datagrams of different peers.
+
+        \param buffer - Datagram buffer
+        \param size - Datagram size
+        \return 'true' if the datagram is ClientHello with the valid cookie, 'false' otherwise
+    */
+    bool Listen(const void* buffer, size_t size);
+
+    //! Send the message
+    /*!
+        The message is queued until the handshake is completed.
+
+        \param buffer - Message buffer
+        \param size - Message size (should not exceed MAX_PAYLOAD)
+        \return 'true' if the message was successfully sent or queued, 'false' if the message is too large or the protocol failed
+    */
+    bool Send(const void* buffer, size_t size);
+
+    //! Input the received datagram
+    /*!
+        \param buffer - Datagram buffer
+        \param size - Datagram size
+        \return 'true' if the datagram was successfully handled, 'false' if the protocol failed
+    */
+    bool Input(const void* buffer, size_t size);
+
+    //! Handle the expired handshake retransmission timer
+    void Flush();
+
+    //! Send the close notify alert
+    void Shutdown();
+
+    //! Take datagrams to send
+    /*!
+        \param queue - Datagrams queue to swap with the output queue
+    */
+    void TakeOutput(RUDPQueue& queue);
+    //! Take delivered messages
+    /*!
+        \param queue - Messages queue to swap with the delivered queue
+    */
+    void TakeDelivered(RUDPQueue& queue);
+
+    //! Install cookie callbacks into the server SSL context
+    /*!
+        \param context - SSL context
+    */
+    static void SetupCookieExchange(SSL_CTX* context);
+
+private:
+    SSL* _ssl;
+    BIO_ADDR* _address;
+    bool _server;
+    bool _listening;
+    bool _handshaked;
+    bool _closed;
+    bool _failed;
+    unsigned long _error;
+    // Received datagram
+    const uint8_t* _input;
+    size_t _input_size;
+    // Read buffer
+    std::vector<uint8_t> _read_buffer;
+    // Cookie
+    uint8_t _cookie_secret[COOKIE_SECRET_SIZE];
+    std::string _cookie_peer;
+    // Pending, output & delivered queues
+    RUDPQueue _pending;
+    RUDPQueue _output;
+    RUDPQueue _delivered;
+    // Statistic
+    uint64_t _messages_sent;
+    uint64_t _messages_received;
+    uint64_t _datagrams_sent;
+    uint64_t _datagrams_received;
+    uint64_t _retransmits;
+    uint64_t _cookies_sent;
+    // Options
+    size_t _option_mtu;
+
+    //! Continue the handshake
+    bool Handshake();
+    //! Read decrypted messages
+    bool Read();
+    //! Write the message
+    bool Write(const void* buffer, size_t size);
+    //! Fail the protocol with the SSL error
+    bool Fail(int result);
+
+    //! Datagram BIO method
+    static BIO_METHOD* Method();
+    //! Datagram BIO write callback
+    static int BioWrite(BIO* bio, const char* data, int size);
+    //! Datagram BIO read callback
+    static int BioRead(BIO* bio, char* data, int size);
+    //! Datagram BIO control callback
+    static long BioCtrl(BIO* bio, int cmd, long num, void* ptr);
+
+    //! Cookie generate callback
+    static int CookieGenerate(SSL* ssl, unsigned char* cookie, unsigned int* length);
+    //! Cookie verify callback
+    static int CookieVerify(SSL* ssl, const unsigned char* cookie, unsigned int length);
+    //! Calculate the cookie of the peer
+    void Cookie(unsigned char* cookie, unsigned int* length) const;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_DTLS_H
@@ -0,0 +1,201 @@
+/*!
+    \file dtls_client.h
+    \brief DTLS client definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_DTLS_CLIENT_H
+#define CPPSERVER_ASIO_DTLS_CLIENT_H
+
+#include "dtls.h"
+#include "ssl_context.h"
+#include "udp_client.h"
+
+#include <mutex>
+
+namespace CppServer {
+namespace Asio {
+
+//! DTLS client
+/*!
+    DTLS client is used to send and receive messages encrypted with DTLS
+    to/from the DTLS server ('DTLSServer'). Each sent message is encrypted
+    into the single DTLS record of the single datagram and each decrypted
+    record is delivered with 'onReceived(buffer, size)' handler.
+
+    The handshake is started when the client is connected, messages sent
+    before the handshake are queued until it is completed. The client keeps
+    receiving datagrams itself, 'ReceiveAsync()' should be called once only
+    when the client is connected with the asynchronous resolver.
+
+    The SSL context should be created with the DTLS method, e.g.
+    'std::make_shared<SSLContext>(SSL_CTX_new(DTLS_method()))'.
+
+    Thread-safe.
+*/
+class DTLSClient : public UDPClient
+{
+public:
+    //! Initialize DTLS client with a given Asio service, SSL context, server address and port number
+    /*!
+        \param service - Asio service
+        \param context - SSL context
+        \param address - Server address
+        \param port - Server port number
+    */
+    DTLSClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, int port);
+    //! Initialize DTLS client with a given Asio service, SSL context, server address and scheme name
+    /*!
+        \param service - Asio service
+        \param context - SSL context
+        \param address - Server address
+        \param scheme - Scheme name
+    */
+    DTLSClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, const std::string& scheme);
+    //! Initialize DTLS client with a given Asio service, SSL context and endpoint
+    /*!
+        \param service - Asio service
+        \param context - SSL context
+        \param endpoint - Server UDP endpoint
+    */
+    DTLSClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const asio::ip::udp::endpoint& endpoint);
+    DTLSClient(const DTLSClient&) = delete;
+    DTLSClient(DTLSClient&&) = delete;
+    virtual ~DTLSClient() = default;
+
+    DTLSClient& operator=(const DTLSClient&) = delete;
+    DTLSClient& operator=(DTLSClient&&) = delete;
+
+    //! Get the client SSL context
+    std::shared_ptr<SSLContext>& context() noexcept { return _context; }
+
+    //! Get the DTLS protocol
+    /*!
+        Protocol statistic is read without synchronization.
+    */
+    DTLSProtocol& protocol() noexcept { return _protocol; }
+
+    //! Get the option: MTU
+    size_t option_mtu() const noexcept { return _option_mtu; }
+
+    //! Is the client handshaked?
+    bool IsHandshaked() const noexcept { return _handshaked; }
+
+    //! Connect the client and start the handshake (synchronous)
+    /*!
+        \return 'true' if the client was successfully connected, 'false' if the client failed to connect
+    */
+    bool Connect() override;
+    //! Connect the client using the given DNS resolver and start the handshake (synchronous)
+    /*!
+        \param resolver - DNS resolver
+        \return 'true' if the client was successfully connected, 'false' if the client failed to connect
+    */
+    bool Connect(std::shared_ptr<UDPResolver> resolver) override;
+    //! Disconnect the client (synchronous)
+    /*!
+        The close notify alert is sent to the server before the disconnect.
+
+        \return 'true' if the client was successfully disconnected, 'false' if the client is already disconnected
+    */
+    bool Disconnect() override;
+
+    //! Send message to the server (synchronous)
+    /*!
+        \param buffer - Message buffer to send
+        \param size - Message size (should not exceed DTLSProtocol::MAX_PAYLOAD)
+        \return Size of sent or queued message
+    */
+    size_t Send(const void* buffer, size_t size) override;
+    //! Send text to the server (synchronous)
+    /*!
+        \param text - Text to send
+        \return Size of sent or queued text
+    */
+    size_t Send(const std::string_view& text) override { return Send(text.data(), text.size()); }
+
+    //! Send message to the server (asynchronous)
+    /*!
+        \param buffer - Message buffer to send
+        \param size - Message size (should not exceed DTLSProtocol::MAX_PAYLOAD)
+        \return 'true' if the message was successfully sent or queued, 'false' if the message was not sent
+    */
+    bool SendAsync(const void* buffer, size_t size) override;
+    //! Send text to the server (asynchronous)
+    /*!
+        \param text - Text to send
+        \return 'true' if the text was successfully sent or queued, 'false' if the text was not sent
+    */
+    bool SendAsync(const std::string_view& text) override { return SendAsync(text.data(), text.size()); }
+
+    //! Receive datagrams from the server (asynchronous)
+    /*!
+        Starts the handshake if it is not started yet.
+    */
+    void ReceiveAsync() override;
+
+    //! Setup option: MTU
+    /*!
+        MTU limits the size of datagrams with handshake messages.
+
+        \param mtu - Maximal datagram payload size (default is 1400 bytes)
+    */
+    void SetupMTU(size_t mtu) noexcept { _option_mtu = mtu; }
+
+protected:
+    //! Handle client handshaked notification
+    virtual void onHandshaked() {}
+
+    //! Handle datagram received notification
+    /*!
+        Continues the handshake or decrypts DTLS records of the datagram
+        received from the server endpoint and delivers messages with
+        'onReceived(buffer, size)' handler.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override;
+    //! Handle message received notification
+    /*!
+        \param buffer - Received message buffer
+        \param size - Received message size
+    */
+    virtual void onReceived(const void* buffer, size_t size) {}
+
+private:
+    // Client SSL context
+    std::shared_ptr<SSLContext> _context;
+    // DTLS protocol
+    std::mutex _protocol_lock;
+    DTLSProtocol _protocol;
+    std::atomic<bool> _handshaked;
+    bool _delivering;
+    // Handshake retransmission timer
+    asio::system_timer _flush_timer;
+    bool _flushing;
+    // Options
+    size_t _option_mtu;
+
+    //! Start the handshake if it is not started yet
+    void Handshake();
+    //! Handle the expired handshake retransmission timer
+    void Flush();
+    //! Schedule the handshake retransmission timer if required
+    void ScheduleFlush();
+    //! Send protocol datagrams to the server
+    void Output(const RUDPQueue& output);
+    //! Deliver decrypted messages with 'onReceived()' handler
+    void Deliver();
+
+    //! Send SSL error notification
+    void SendError(unsigned long error);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_DTLS_CLIENT_H
@@ -0,0 +1,143 @@
+/*!
+    \file dtls_server.h
+    \brief DTLS server definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_DTLS_SERVER_H
+#define CPPSERVER_ASIO_DTLS_SERVER_H
+
+#include "dtls_session.h"
+
+#include <mutex>
+
+namespace CppServer {
+namespace Asio {
+
+//! DTLS server
+/*!
+    DTLS server is the UDP server which creates DTLS sessions ('DTLSSession')
+    for peers after the stateless cookie exchange. ClientHello of unknown
+    peers without the valid cookie is replied with HelloVerifyRequest, so
+    spoofed ClientHello floods never allocate sessions and SSL objects.
+
+    The SSL context should be created with the DTLS method, e.g.
+    'std::make_shared<SSLContext>(SSL_CTX_new(DTLS_method()))'. Datagrams
+    are received as usual with 'ReceiveAsync()' (including batched receive
+    with 'SetupReceiveBatch()'), overridden 'onReceived()' handler should
+    call the base one.
+
+    Thread-safe.
+*/
+class DTLSServer : public UDPServer
+{
+    friend class DTLSSession;
+
+public:
+    //! Initialize DTLS server with a given Asio service, SSL context and port number
+    /*!
+        \param service - Asio service
+        \param context - SSL context
+        \param port - Port number
+        \param protocol - Internet protocol type (default is IPv4)
+    */
+    DTLSServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, int port, InternetProtocol protocol = InternetProtocol::IPv4);
+    //! Initialize DTLS server with a given Asio service, SSL context, server address and port number
+    /*!
+        \param service - Asio service
+        \param context - SSL context
+        \param address - Server address
+        \param port - Port number
+    */
+    DTLSServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, int port);
+    //! Initialize DTLS server with a given Asio service, SSL context and endpoint
+    /*!
+        \param service - Asio service
+        \param context - SSL context
+        \param endpoint - Server UDP endpoint
+    */
+    DTLSServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const asio::ip::udp::endpoint& endpoint);
+    DTLSServer(const DTLSServer&) = delete;
+    DTLSServer(DTLSServer&&) = delete;
+    virtual ~DTLSServer() = default;
+
+    DTLSServer& operator=(const DTLSServer&) = delete;
+    DTLSServer& operator=(DTLSServer&&) = delete;
+
+    //! Get the server SSL context
+    std::shared_ptr<SSLContext>& context() noexcept { return _context; }
+
+    //! Get the number of sent cookies (HelloVerifyRequest messages)
+    uint64_t cookies_sent() const noexcept { return _cookies_sent; }
+    //! Get the number of verified cookies
+    uint64_t cookies_verified() const noexcept { return _cookies_verified; }
+    //! Get the number of completed handshakes
+    uint64_t handshakes() const noexcept { return _handshakes; }
+    //! Get the number of failed handshakes
+    uint64_t handshakes_failed() const noexcept { return _handshakes_failed; }
+
+    //! Get the option: MTU
+    size_t option_mtu() const noexcept { return _option_mtu; }
+
+    //! Setup option: MTU
+    /*!
+        MTU limits the size of datagrams with handshake messages of new sessions.
+
+        \param mtu - Maximal datagram payload size (default is 1400 bytes)
+    */
+    void SetupMTU(size_t mtu) noexcept { _option_mtu = mtu; }
+
+protected:
+    //! Create DTLS session factory method
+    /*!
+        \param server - Connected server
+        \param endpoint - Peer endpoint
+        \return DTLS session
+    */
+    virtual std::shared_ptr<DTLSSession> CreateSession(std::shared_ptr<DTLSServer> server, const asio::ip::udp::endpoint& endpoint) { return std::make_shared<DTLSSession>(server, endpoint); }
+
+protected:
+    //! Handle datagram received notification
+    /*!
+        Datagrams of registered peers are dispatched to their sessions.
+        Datagrams of unknown peers are passed to the stateless cookie
+        exchange and only ClientHello with the valid cookie creates
+        a new session.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override;
+
+private:
+    // Server SSL context
+    std::shared_ptr<SSLContext> _context;
+    // Stateless cookie exchange
+    uint8_t _cookie_secret[DTLSProtocol::COOKIE_SECRET_SIZE];
+    std::mutex _listener_lock;
+    DTLSProtocol _listener;
+    // Server statistic
+    std::atomic<uint64_t> _cookies_sent;
+    std::atomic<uint64_t> _cookies_verified;
+    std::atomic<uint64_t> _handshakes;
+    std::atomic<uint64_t> _handshakes_failed;
+    // Options
+    size_t _option_mtu;
+
+    //! Prepare the cookie exchange
+    void PrepareCookieExchange();
+
+    //! Create UDP session of the verified peer
+    std::shared_ptr<UDPSession> CreateSession(std::shared_ptr<UDPServer> server, const asio::ip::udp::endpoint& endpoint) final;
+
+    //! Get the peer identity of the cookie
+    static std::string PeerIdentity(const asio::ip::udp::endpoint& endpoint);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_DTLS_SERVER_H
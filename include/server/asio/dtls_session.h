@@ -0,0 +1,140 @@
+/*!
+    \file dtls_session.h
+    \brief DTLS session definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_DTLS_SESSION_H
+#define CPPSERVER_ASIO_DTLS_SESSION_H
+
+#include "dtls.h"
+#include "ssl_context.h"
+#include "udp_server.h"
+
+#include <mutex>
+
+namespace CppServer {
+namespace Asio {
+
+class DTLSServer;
+
+//! DTLS session
+/*!
+    DTLS session is a virtual UDP session of the DTLS server ('DTLSServer')
+    which sends and receives messages encrypted with DTLS. Sessions are
+    created only for peers with the verified cookie. Each sent message is
+    encrypted into the single DTLS record of the single datagram and each
+    decrypted record is delivered with 'onReceived()' handler, so message
+    boundaries are kept, but messages might be lost or reordered like
+    plain UDP datagrams.
+
+    Messages sent before the handshake are queued until it is completed.
+
+    Thread-safe.
+*/
+class DTLSSession : public UDPSession
+{
+public:
+    //! Initialize the session with a given server and peer endpoint
+    /*!
+        \param server - Connected server
+        \param endpoint - Peer endpoint
+    */
+    DTLSSession(std::shared_ptr<DTLSServer> server, const asio::ip::udp::endpoint& endpoint);
+    DTLSSession(const DTLSSession&) = delete;
+    DTLSSession(DTLSSession&&) = delete;
+    virtual ~DTLSSession() = default;
+
+    DTLSSession& operator=(const DTLSSession&) = delete;
+    DTLSSession& operator=(DTLSSession&&) = delete;
+
+    //! Get the DTLS protocol
+    /*!
+        Protocol statistic is read without synchronization.
+    */
+    DTLSProtocol& protocol() noexcept { return _protocol; }
+
+    //! Is the session handshaked?
+    bool IsHandshaked() const noexcept { return _handshaked; }
+
+    //! Disconnect the session
+    /*!
+        The close notify alert is sent to the peer before the disconnect.
+
+        \return 'true' if the section was successfully disconnected, 'false' if the section is already disconnected
+    */
+    bool Disconnect() override;
+
+    //! Send message to the peer (synchronous)
+    /*!
+        \param buffer - Message buffer to send
+        \param size - Message size (should not exceed DTLSProtocol::MAX_PAYLOAD)
+        \return Size of sent or queued message
+    */
+    size_t Send(const void* buffer, size_t size) override;
+    //! Send text to the peer (synchronous)
+    /*!
+        \param text - Text to send
+        \return Size of sent or queued text
+    */
+    size_t Send(const std::string_view& text) override { return Send(text.data(), text.size()); }
+
+    //! Send message to the peer (asynchronous)
+    /*!
+        \param buffer - Message buffer to send
+        \param size - Message size (should not exceed DTLSProtocol::MAX_PAYLOAD)
+        \return 'true' if the message was successfully sent or queued, 'false' if the message was not sent
+    */
+    bool SendAsync(const void* buffer, size_t size) override;
+    //! Send text to the peer (asynchronous)
+    /*!
+        \param text - Text to send
+        \return 'true' if the text was successfully sent or queued, 'false' if the text was not sent
+    */
+    bool SendAsync(const std::string_view& text) override { return SendAsync(text.data(), text.size()); }
+
+protected:
+    //! Handle session handshaked notification
+    virtual void onHandshaked() {}
+
+    //! Handle raw datagram received notification
+    /*!
+        Continues the handshake or decrypts DTLS records of the datagram
+        and delivers messages with 'onReceived()' handler.
+
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    void onReceivedDatagram(const void* buffer, size_t size) override;
+
+private:
+    // DTLS server
+    std::shared_ptr<DTLSServer> _dtls_server;
+    // DTLS protocol
+    std::mutex _protocol_lock;
+    DTLSProtocol _protocol;
+    std::atomic<bool> _handshaked;
+    bool _delivering;
+    // Handshake retransmission timer
+    asio::system_timer _flush_timer;
+    bool _flushing;
+
+    //! Handle the expired handshake retransmission timer
+    void Flush();
+    //! Schedule the handshake retransmission timer if required
+    void ScheduleFlush();
+    //! Send protocol datagrams to the peer
+    void Output(const RUDPQueue& output);
+    //! Deliver decrypted messages with 'onReceived()' handler
+    void Deliver();
+
+    //! Send SSL error notification
+    void SendError(unsigned long error);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_DTLS_SESSION_H
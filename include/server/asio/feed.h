@@ -0,0 +1,364 @@
+/*!
+    \file feed.h
+    \brief Sequenced feed protocol definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_FEED_H
+#define CPPSERVER_ASIO_FEED_H
+
+#include "time/timespan.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Sequenced feed range
+struct FeedRange
+{
+    //! First sequence number of the range
+    uint64_t sequence;
+    //! Count of sequence numbers in the range
+    uint64_t count;
+};
+
+//! Sequenced feed queue
+/*!
+    Feed queue keeps messages in the contiguous buffer with their sequence
+    numbers and sizes. Lost ranges are kept in order with messages as entries
+    with non-zero lost count.
+*/
+struct FeedQueue
+{
+    //! Feed queue entry
+    struct Entry
+    {
+        //! Sequence number of the message (first sequence number of the lost range)
+        uint64_t sequence;
+        //! Message size
+        size_t size;
+        //! Count of lost messages (0 for the received message)
+        uint64_t lost;
+    };
+
+    //! Messages buffer
+    std::vector<uint8_t> buffer;
+    //! Queue entries
+    std::vector<Entry> entries;
+
+    //! Is the queue empty?
+    bool empty() const noexcept { return entries.empty(); }
+    //! Clear the queue
+    void clear() noexcept { buffer.clear(); entries.clear(); }
+    //! Push a new message into the queue
+    void push(uint64_t sequence, const void* data, size_t size);
+    //! Push a new lost range into the queue
+    void push_lost(uint64_t sequence, uint64_t count) { entries.push_back({ sequence, 0, count }); }
+};
+
+//! Sequenced feed protocol
+/*!
+    Sequenced feed protocol defines the wire format of the feed:
+    - feed packet is a datagram with the sequence number followed by
+      the message payload: [uint64 sequence][payload];
+    - retransmit request asks the retransmit service for the range of
+      messages: [uint64 sequence][uint32 count];
+    - retransmit response is the stream of records: [uint32 size][uint64 sequence][payload]
+      for the stored messages and [UNAVAILABLE][uint64 sequence][uint32 count] for
+      the range of messages which are not available any more.
+
+    All integers are little-endian. The first published sequence number is 1.
+*/
+class FeedProtocol
+{
+public:
+    //! Feed packet header size
+    static constexpr size_t HEADER_SIZE = 8;
+    //! Retransmit request size
+    static constexpr size_t REQUEST_SIZE = 12;
+    //! Retransmit response record header size
+    static constexpr size_t RECORD_SIZE = 12;
+    //! Retransmit response unavailable record size
+    static constexpr size_t UNAVAILABLE_SIZE = 16;
+    //! Retransmit response record size mark of unavailable messages
+    static constexpr uint32_t UNAVAILABLE = 0xFFFFFFFF;
+
+    //! Write the feed packet header
+    static void WriteHeader(uint8_t* buffer, uint64_t sequence) noexcept;
+    //! Read the feed packet header
+    static uint64_t ReadHeader(const uint8_t* buffer) noexcept;
+    //! Write the retransmit request
+    static void WriteRequest(uint8_t* buffer, uint64_t sequence, uint32_t count) noexcept;
+    //! Read the retransmit request
+    static FeedRange ReadRequest(const uint8_t* buffer) noexcept;
+    //! Write the retransmit response record header
+    static void WriteRecord(uint8_t* buffer, uint32_t size, uint64_t sequence) noexcept;
+    //! Read the retransmit response record header
+    static void ReadRecord(const uint8_t* buffer, uint32_t& size, uint64_t& sequence) noexcept;
+    //! Write the retransmit response unavailable record
+    static void WriteUnavailable(uint8_t* buffer, uint64_t sequence, uint32_t count) noexcept;
+    //! Read the count of unavailable messages from the retransmit response unavailable record
+    static uint32_t ReadUnavailable(const uint8_t* buffer) noexcept;
+};
+
+//! Sequenced feed history
+/*!
+    Feed history is an in-memory ring of the last published messages which
+    is used by the retransmit service to recover lost messages. Each message
+    is stored in the fixed size slot, so storing does not allocate memory.
+
+    Thread-safe.
+*/
+class FeedHistory
+{
+public:
+    //! Initialize the history with a given capacity and message size
+    /*!
+        \param capacity - History capacity in messages
+        \param message_size - Maximal message size (default is 2048)
+    */
+    explicit FeedHistory(size_t capacity, size_t message_size = 2048);
+    FeedHistory(const FeedHistory&) = delete;
+    FeedHistory(FeedHistory&&) = delete;
+    ~FeedHistory() = default;
+
+    FeedHistory& operator=(const FeedHistory&) = delete;
+    FeedHistory& operator=(FeedHistory&&) = delete;
+
+    //! Get the history capacity in messages
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the maximal message size
+    size_t message_size() const noexcept { return _message_size; }
+
+    //! Get the first stored sequence number
+    uint64_t first() const;
+    //! Get the next sequence number to publish
+    uint64_t next() const;
+
+    //! Store the next message
+    /*!
+        The oldest message is overwritten when the history is full.
+
+        \param buffer - Message buffer
+        \param size - Message size
+        \return Sequence number of the stored message or 0 if the message is too large
+    */
+    uint64_t Store(const void* buffer, size_t size);
+
+    //! Copy stored messages of the given range
+    /*!
+        Messages are copied starting from the first requested message which
+        is still stored, so messages before 'first()' are not copied.
+
+        \param sequence - First sequence number of the range
+        \param count - Count of sequence numbers in the range
+        \param queue - Queue to push copied messages
+        \return Count of copied messages
+    */
+    size_t Copy(uint64_t sequence, uint64_t count, FeedQueue& queue) const;
+
+    //! Clear the history and restart sequence numbers from 1
+    void Clear();
+
+private:
+    mutable std::mutex _lock;
+    size_t _capacity;
+    size_t _message_size;
+    std::vector<uint8_t> _buffer;
+    std::vector<size_t> _sizes;
+    uint64_t _first;
+    uint64_t _next;
+};
+
+//! Sequenced feed receiver
+/*!
+    Feed receiver is a transport independent engine which restores the order
+    of the sequenced feed and detects gaps:
+    - out of order messages are kept in the bounded reorder buffer;
+    - a gap is requested from the retransmit service when it is not filled
+      by reordered packets within the reorder delay;
+    - requests are repeated on the retransmit timeout, and the gap is
+      declared lost after the maximal count of attempts, when the retransmit
+      service reports it unavailable or when the reorder buffer overflows.
+
+    Received feed packets are passed with 'Input()', retransmitted messages
+    with 'Recover()' and 'Unavailable()'. Delivered messages and lost ranges
+    are collected in order into the delivered queue. Retransmit requests
+    are produced by 'Flush()' into the requests queue, so 'Flush()' should
+    be called periodically while 'IsPending()'.
+
+    The receiver is synchronized with the first received message, so late
+    joiners do not request the history published before they joined.
+
+    Timestamps are monotonic nanoseconds (e.g. CppCommon::Timestamp::nano()).
+
+    Not thread-safe.
+*/
+class FeedReceiver
+{
+public:
+    FeedReceiver();
+    FeedReceiver(const FeedReceiver&) = delete;
+    FeedReceiver(FeedReceiver&&) = default;
+    ~FeedReceiver() = default;
+
+    FeedReceiver& operator=(const FeedReceiver&) = delete;
+    FeedReceiver& operator=(FeedReceiver&&) = default;
+
+    //! Get the next expected sequence number (0 if not synchronized)
+    uint64_t next() const noexcept { return _next; }
+
+    //! Get the number of delivered messages
+    uint64_t messages_received() const noexcept { return _messages_received; }
+    //! Get the number of messages recovered by the retransmit service
+    uint64_t messages_recovered() const noexcept { return _messages_recovered; }
+    //! Get the number of lost messages
+    uint64_t messages_lost() const noexcept { return _messages_lost; }
+    //! Get the number of reordered messages
+    uint64_t messages_reordered() const noexcept { return _messages_reordered; }
+    //! Get the number of duplicated messages
+    uint64_t messages_duplicated() const noexcept { return _messages_duplicated; }
+    //! Get the number of detected gaps
+    uint64_t gaps_detected() const noexcept { return _gaps_detected; }
+    //! Get the number of retransmit requests
+    uint64_t requests_sent() const noexcept { return _requests_sent; }
+    //! Get the number of invalid packets received
+    uint64_t packets_invalid() const noexcept { return _packets_invalid; }
+
+    //! Get the count of messages in the reorder buffer
+    size_t reorder_buffered() const noexcept { return _reorder.size(); }
+    //! Get the count of open gaps
+    size_t gaps_pending() const noexcept { return _gaps.size(); }
+
+    //! Get the option: reorder window in messages
+    size_t option_reorder_window() const noexcept { return _option_reorder_window; }
+    //! Get the option: reorder delay
+    const CppCommon::Timespan& option_reorder_delay() const noexcept { return _option_reorder_delay; }
+    //! Get the option: retransmit timeout
+    const CppCommon::Timespan& option_retransmit_timeout() const noexcept { return _option_retransmit_timeout; }
+    //! Get the option: maximal count of retransmit attempts
+    size_t option_retransmit_attempts() const noexcept { return _option_retransmit_attempts; }
+
+    //! Is there any gap waiting for recovery?
+    bool IsPending() const noexcept { return !_gaps.empty(); }
+
+    //! Setup option: reorder window
+    /*!
+        The oldest gap is declared lost when the reorder buffer exceeds
+        the reorder window.
+
+        \param window - Maximal count of buffered out of order messages (default is 4096)
+    */
+    void SetupReorderWindow(size_t window) noexcept { _option_reorder_window = (window > 0) ? window : 1; }
+    //! Setup option: reorder delay
+    /*!
+        \param delay - Time to wait for reordered packets before the gap is requested (default is 1 millisecond)
+    */
+    void SetupReorderDelay(const CppCommon::Timespan& delay) noexcept { _option_reorder_delay = delay; }
+    //! Setup option: retransmit timeout
+    /*!
+        \param timeout - Time to wait for the retransmit response before the next request (default is 100 milliseconds)
+    */
+    void SetupRetransmitTimeout(const CppCommon::Timespan& timeout) noexcept { _option_retransmit_timeout = timeout; }
+    //! Setup option: maximal count of retransmit attempts
+    /*!
+        \param attempts - Count of retransmit requests before the gap is declared lost (0 - no recovery, default is 3)
+    */
+    void SetupRetransmitAttempts(size_t attempts) noexcept { _option_retransmit_attempts = attempts; }
+
+    //! Input the received feed packet
+    /*!
+        \param buffer - Packet buffer
+        \param size - Packet size
+        \param timestamp - Current timestamp in nanoseconds
+        \return 'true' if the packet was successfully handled, 'false' if the packet is invalid
+    */
+    bool Input(const void* buffer, size_t size, uint64_t timestamp);
+    //! Input the message recovered by the retransmit service
+    /*!
+        \param sequence - Message sequence number
+        \param buffer - Message buffer
+        \param size - Message size
+        \param timestamp - Current timestamp in nanoseconds
+    */
+    void Recover(uint64_t sequence, const void* buffer, size_t size, uint64_t timestamp);
+    //! Input the range of messages unavailable in the retransmit service
+    /*!
+        \param sequence - First sequence number of the range
+        \param count - Count of sequence numbers in the range
+    */
+    void Unavailable(uint64_t sequence, uint64_t count);
+
+    //! Flush retransmit requests of expired gaps and declare lost gaps
+    /*!
+        \param timestamp - Current timestamp in nanoseconds
+    */
+    void Flush(uint64_t timestamp);
+
+    //! Take retransmit requests
+    /*!
+        \param requests - Requests vector to swap with the requests queue
+    */
+    void TakeRequests(std::vector<FeedRange>& requests);
+    //! Take delivered messages and lost ranges
+    /*!
+        \param queue - Queue to swap with the delivered queue
+    */
+    void TakeDelivered(FeedQueue& queue);
+
+    //! Reset the receiver state and statistic
+    void Reset();
+
+private:
+    // Missing range of sequence numbers
+    struct Gap
+    {
+        uint64_t end;
+        uint64_t detected;
+        uint64_t deadline;
+        size_t attempts;
+        bool lost;
+    };
+
+    // Receive state
+    uint64_t _next;
+    uint64_t _highest;
+    std::map<uint64_t, std::vector<uint8_t>> _reorder;
+    std::map<uint64_t, Gap> _gaps;
+    // Requests & delivered queues
+    std::vector<FeedRange> _requests;
+    FeedQueue _delivered;
+    // Statistic
+    uint64_t _messages_received;
+    uint64_t _messages_recovered;
+    uint64_t _messages_lost;
+    uint64_t _messages_reordered;
+    uint64_t _messages_duplicated;
+    uint64_t _gaps_detected;
+    uint64_t _requests_sent;
+    uint64_t _packets_invalid;
+    // Options
+    size_t _option_reorder_window;
+    CppCommon::Timespan _option_reorder_delay;
+    CppCommon::Timespan _option_retransmit_timeout;
+    size_t _option_retransmit_attempts;
+
+    //! Input the message with the given sequence number
+    bool InputMessage(uint64_t sequence, const uint8_t* payload, size_t size, uint64_t timestamp, bool recovered);
+    //! Mark the range of sequence numbers as lost
+    void MarkLost(uint64_t sequence, uint64_t end);
+    //! Deliver contiguous messages and skip lost gaps
+    void Deliver();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_FEED_H
@@ -0,0 +1,152 @@
+/*!
+    \file feed_client.h
+    \brief Sequenced feed client definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_FEED_CLIENT_H
+#define CPPSERVER_ASIO_FEED_CLIENT_H
+
+#include "feed.h"
+#include "udp_client.h"
+
+#include <mutex>
+
+namespace CppServer {
+namespace Asio {
+
+//! Sequenced feed client
+/*!
+    Sequenced feed client is an UDP client which receives the multicast feed
+    of the feed publisher ('FeedPublisher'), restores the order of messages
+    and detects gaps with the feed receiver ('FeedReceiver'). Gaps are
+    recovered from the retransmit server ('FeedRetransmitServer') with
+    the TCP connection, which is established on the first retransmit request.
+
+    Messages are delivered in order with 'onReceived(sequence, buffer, size)'
+    handler, unrecoverable gaps are reported with 'onLost()' handler in
+    the same order.
+
+    'ReceiveAsync()' should be called once when the client is connected,
+    then the client keeps receiving feed packets.
+
+    Thread-safe.
+*/
+class FeedClient : public UDPClient
+{
+public:
+    //! Initialize feed client with a given Asio service, address and port number
+    /*!
+        \param service - Asio service
+        \param address - Listen address (e.g. "0.0.0.0" to receive the multicast feed)
+        \param port - Feed port number
+    */
+    FeedClient(std::shared_ptr<Service> service, const std::string& address, int port);
+    //! Initialize feed client with a given Asio service and endpoint
+    /*!
+        \param service - Asio service
+        \param endpoint - Feed UDP endpoint
+    */
+    FeedClient(std::shared_ptr<Service> service, const asio::ip::udp::endpoint& endpoint);
+    FeedClient(const FeedClient&) = delete;
+    FeedClient(FeedClient&&) = delete;
+    virtual ~FeedClient();
+
+    FeedClient& operator=(const FeedClient&) = delete;
+    FeedClient& operator=(FeedClient&&) = delete;
+
+    //! Get the feed receiver
+    /*!
+        Receiver options should be set up before the first received message.
+        Receiver statistic is read without synchronization.
+    */
+    FeedReceiver& receiver() noexcept { return _receiver; }
+
+    //! Get the option: retransmit server address
+    const std::string& option_recovery_address() const noexcept { return _option_recovery_address; }
+    //! Get the option: retransmit server port number
+    int option_recovery_port() const noexcept { return _option_recovery_port; }
+    //! Get the option: flush interval
+    const CppCommon::Timespan& option_flush_interval() const noexcept { return _option_flush_interval; }
+
+    //! Setup option: retransmit server
+    /*!
+        Without the retransmit server gaps are declared lost after the reorder
+        delay.
+
+        \param address - Retransmit server address (empty - disable recovery)
+        \param port - Retransmit server port number
+    */
+    void SetupRecovery(const std::string& address, int port) { _option_recovery_address = address; _option_recovery_port = port; }
+    //! Setup option: flush interval
+    /*!
+        Flush interval is the period of the receiver timer which requests and
+        declares lost gaps while there are open gaps.
+
+        \param interval - Flush interval (default is 1 millisecond)
+    */
+    void SetupFlushInterval(const CppCommon::Timespan& interval) noexcept { _option_flush_interval = interval; }
+
+protected:
+    //! Handle datagram received notification
+    /*!
+        Decodes the feed packet and delivers received messages with
+        'onReceived(sequence, buffer, size)' handler.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override;
+    //! Handle feed message received notification
+    /*!
+        \param sequence - Message sequence number
+        \param buffer - Received message buffer
+        \param size - Received message size
+    */
+    virtual void onReceived(uint64_t sequence, const void* buffer, size_t size) {}
+    //! Handle feed messages lost notification
+    /*!
+        Lost messages could not be received nor recovered, the next delivered
+        message has the sequence number 'sequence + count'.
+
+        \param sequence - First lost sequence number
+        \param count - Count of lost messages
+    */
+    virtual void onLost(uint64_t sequence, uint64_t count) {}
+
+private:
+    class Recovery;
+
+    // Feed receiver
+    std::mutex _receiver_lock;
+    FeedReceiver _receiver;
+    bool _delivering;
+    // Receiver flush timer
+    asio::system_timer _flush_timer;
+    bool _flushing;
+    // Retransmit client
+    std::shared_ptr<Recovery> _recovery;
+    // Options
+    std::string _option_recovery_address;
+    int _option_recovery_port;
+    CppCommon::Timespan _option_flush_interval;
+
+    //! Flush the receiver and send retransmit requests
+    void Flush();
+    //! Schedule the receiver flush timer if required
+    void ScheduleFlush();
+    //! Send retransmit requests to the retransmit server
+    void Request(const std::vector<FeedRange>& requests);
+    //! Input the retransmit response records
+    size_t Recover(const uint8_t* buffer, size_t size);
+    //! Deliver received messages and lost ranges in order
+    void Deliver();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_FEED_CLIENT_H
@@ -0,0 +1,82 @@
+/*!
+    \file feed_publisher.h
+    \brief Sequenced feed publisher definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_FEED_PUBLISHER_H
+#define CPPSERVER_ASIO_FEED_PUBLISHER_H
+
+#include "feed.h"
+#include "udp_server.h"
+
+#include <mutex>
+
+namespace CppServer {
+namespace Asio {
+
+//! Sequenced feed publisher
+/*!
+    Sequenced feed publisher is an UDP server which multicasts messages as
+    sequence-numbered feed packets ('FeedProtocol') and stores them into
+    the feed history. The same history should be served by the retransmit
+    server ('FeedRetransmitServer') to recover lost packets.
+
+    Thread-safe.
+*/
+class FeedPublisher : public UDPServer
+{
+public:
+    //! Initialize the feed publisher with a given Asio service, port number and feed history
+    /*!
+        \param service - Asio service
+        \param port - Server port number
+        \param history - Feed history
+    */
+    FeedPublisher(std::shared_ptr<Service> service, int port, std::shared_ptr<FeedHistory> history);
+    FeedPublisher(const FeedPublisher&) = delete;
+    FeedPublisher(FeedPublisher&&) = delete;
+    virtual ~FeedPublisher() = default;
+
+    FeedPublisher& operator=(const FeedPublisher&) = delete;
+    FeedPublisher& operator=(FeedPublisher&&) = delete;
+
+    //! Get the feed history
+    std::shared_ptr<FeedHistory>& history() noexcept { return _history; }
+
+    //! Get the number of published messages
+    uint64_t messages_published() const noexcept { return _messages_published; }
+
+    //! Publish the message to the multicast feed (synchronous)
+    /*!
+        The message is stored into the feed history even if the multicast
+        datagram was not sent, so receivers are able to recover it.
+
+        \param buffer - Message buffer to publish
+        \param size - Message size (should not exceed the feed history message size)
+        \return Sequence number of the published message or 0 if the message was not published
+    */
+    virtual uint64_t Publish(const void* buffer, size_t size);
+    //! Publish the text to the multicast feed (synchronous)
+    /*!
+        \param text - Text to publish
+        \return Sequence number of the published text or 0 if the text was not published
+    */
+    virtual uint64_t Publish(const std::string_view& text) { return Publish(text.data(), text.size()); }
+
+private:
+    // Feed history
+    std::shared_ptr<FeedHistory> _history;
+    // Feed packet
+    std::mutex _publish_lock;
+    std::vector<uint8_t> _packet;
+    // Statistic
+    uint64_t _messages_published;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_FEED_PUBLISHER_H
@@ -0,0 +1,118 @@
+/*!
+    \file feed_retransmit.h
+    \brief Sequenced feed retransmit server definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_FEED_RETRANSMIT_H
+#define CPPSERVER_ASIO_FEED_RETRANSMIT_H
+
+#include "feed.h"
+#include "tcp_server.h"
+
+#include <atomic>
+
+namespace CppServer {
+namespace Asio {
+
+//! Sequenced feed retransmit session
+/*!
+    Sequenced feed retransmit session reads retransmit requests of the feed
+    client and responds with the requested messages from the feed history
+    ('FeedProtocol'). Requested messages which are not stored in the history
+    any more are reported as unavailable.
+
+    Not thread-safe.
+*/
+class FeedRetransmitSession : public TCPSession
+{
+public:
+    //! Initialize the session with a given server and feed history
+    /*!
+        \param server - Connected server
+        \param history - Feed history
+    */
+    FeedRetransmitSession(std::shared_ptr<TCPServer> server, std::shared_ptr<FeedHistory> history);
+    FeedRetransmitSession(const FeedRetransmitSession&) = delete;
+    FeedRetransmitSession(FeedRetransmitSession&&) = delete;
+    virtual ~FeedRetransmitSession() = default;
+
+    FeedRetransmitSession& operator=(const FeedRetransmitSession&) = delete;
+    FeedRetransmitSession& operator=(FeedRetransmitSession&&) = delete;
+
+protected:
+    //! Handle buffer received notification
+    /*!
+        Decodes retransmit requests and sends responses.
+
+        \param buffer - Received buffer
+        \param size - Received buffer size
+    */
+    void onReceived(const void* buffer, size_t size) override;
+
+private:
+    std::shared_ptr<FeedHistory> _history;
+    std::vector<uint8_t> _request;
+    std::vector<uint8_t> _response;
+    FeedQueue _messages;
+
+    //! Append the retransmit response of the given range
+    void Respond(uint64_t sequence, uint64_t count);
+    //! Append the unavailable range record
+    void RespondUnavailable(uint64_t sequence, uint64_t count);
+};
+
+//! Sequenced feed retransmit server
+/*!
+    Sequenced feed retransmit server is a TCP server which serves retransmit
+    requests of feed clients ('FeedClient') from the feed history filled by
+    the feed publisher ('FeedPublisher').
+
+    Thread-safe.
+*/
+class FeedRetransmitServer : public TCPServer
+{
+    friend class FeedRetransmitSession;
+
+public:
+    //! Initialize the retransmit server with a given Asio service, port number and feed history
+    /*!
+        \param service - Asio service
+        \param port - Server port number
+        \param history - Feed history
+    */
+    FeedRetransmitServer(std::shared_ptr<Service> service, int port, std::shared_ptr<FeedHistory> history);
+    FeedRetransmitServer(const FeedRetransmitServer&) = delete;
+    FeedRetransmitServer(FeedRetransmitServer&&) = delete;
+    virtual ~FeedRetransmitServer() = default;
+
+    FeedRetransmitServer& operator=(const FeedRetransmitServer&) = delete;
+    FeedRetransmitServer& operator=(FeedRetransmitServer&&) = delete;
+
+    //! Get the feed history
+    std::shared_ptr<FeedHistory>& history() noexcept { return _history; }
+
+    //! Get the number of served retransmit requests
+    uint64_t requests_served() const noexcept { return _requests_served; }
+    //! Get the number of retransmitted messages
+    uint64_t messages_retransmitted() const noexcept { return _messages_retransmitted; }
+    //! Get the number of messages reported as unavailable
+    uint64_t messages_unavailable() const noexcept { return _messages_unavailable; }
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(std::shared_ptr<TCPServer> server) override { return std::make_shared<FeedRetransmitSession>(server, _history); }
+
+private:
+    std::shared_ptr<FeedHistory> _history;
+    // Statistic
+    std::atomic<uint64_t> _requests_served;
+    std::atomic<uint64_t> _messages_retransmitted;
+    std::atomic<uint64_t> _messages_unavailable;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_FEED_RETRANSMIT_H
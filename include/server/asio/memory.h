@@ -10,6 +10,8 @@
 #define CPPSERVER_ASIO_MEMORY_H
 
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace CppServer {
 namespace Asio {
@@ -53,6 +55,70 @@ private:
     typename std::aligned_storage<1024>::type _storage;
 };
 
+//! Buffer pool
+/*!
+    Bounded pool of byte buffers released by idle connections. Released
+    buffers are kept in the pool up to its capacity to be reacquired by
+    connections which become active again, all other buffers are freed, so
+    the memory of idle connections is returned to the heap.
+
+    Thread-safe.
+*/
+class BufferPool
+{
+public:
+    //! Initialize buffer pool with a given capacity
+    /*!
+        \param capacity - Maximal count of pooled buffers (default is 64)
+    */
+    explicit BufferPool(size_t capacity = 64) : _capacity(capacity), _acquired(0), _reused(0) {}
+    BufferPool(const BufferPool&) = delete;
+    BufferPool(BufferPool&&) = delete;
+    ~BufferPool() = default;
+
+    BufferPool& operator=(const BufferPool&) = delete;
+    BufferPool& operator=(BufferPool&&) = delete;
+
+    //! Get the maximal count of pooled buffers
+    size_t capacity() const;
+    //! Get the count of pooled buffers
+    size_t size() const;
+    //! Get the count of acquired buffers
+    uint64_t acquired() const;
+    //! Get the count of acquired buffers reused from the pool
+    uint64_t reused() const;
+
+    //! Setup the maximal count of pooled buffers
+    /*!
+        \param capacity - Maximal count of pooled buffers
+    */
+    void SetupCapacity(size_t capacity);
+
+    //! Acquire the empty buffer with the given reserved capacity
+    /*!
+        \param buffer - Buffer to replace with the pooled one
+        \param size - Buffer capacity to reserve
+    */
+    void Acquire(std::vector<uint8_t>& buffer, size_t size);
+    //! Release the buffer into the pool
+    /*!
+        The given buffer becomes empty without any allocated memory.
+
+        \param buffer - Buffer to release
+    */
+    void Release(std::vector<uint8_t>& buffer);
+
+    //! Clear the pool
+    void Clear();
+
+private:
+    mutable std::mutex _lock;
+    size_t _capacity;
+    uint64_t _acquired;
+    uint64_t _reused;
+    std::vector<std::vector<uint8_t>> _buffers;
+};
+
 //! Asio handler allocator
 /*!
     The allocator to be associated with the handler objects. This allocator only
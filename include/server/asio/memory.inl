@@ -35,6 +35,84 @@ inline void HandlerStorage::deallocate(void* ptr)
     ::operator delete(ptr);
 }
 
+inline size_t BufferPool::capacity() const
+{
+    std::scoped_lock locker(_lock);
+    return _capacity;
+}
+
+inline size_t BufferPool::size() const
+{
+    std::scoped_lock locker(_lock);
+    return _buffers.size();
+}
+
+inline uint64_t BufferPool::acquired() const
+{
+    std::scoped_lock locker(_lock);
+    return _acquired;
+}
+
+inline uint64_t BufferPool::reused() const
+{
+    std::scoped_lock locker(_lock);
+    return _reused;
+}
+
+inline void BufferPool::SetupCapacity(size_t capacity)
+{
+    std::scoped_lock locker(_lock);
+    _capacity = capacity;
+    if (_buffers.size() > _capacity)
+        _buffers.resize(_capacity);
+}
+
+inline void BufferPool::Acquire(std::vector<uint8_t>& buffer, size_t size)
+{
+    std::vector<uint8_t> pooled;
+    {
+        std::scoped_lock locker(_lock);
+
+        ++_acquired;
+
+        // Reuse the last released buffer
+        if (!_buffers.empty())
+        {
+            pooled.swap(_buffers.back());
+            _buffers.pop_back();
+            ++_reused;
+        }
+    }
+
+    if (pooled.capacity() > 0)
+        buffer.swap(pooled);
+    buffer.clear();
+    buffer.reserve(size);
+}
+
+inline void BufferPool::Release(std::vector<uint8_t>& buffer)
+{
+    std::vector<uint8_t> released;
+    released.swap(buffer);
+    if (released.capacity() == 0)
+        return;
+
+    std::scoped_lock locker(_lock);
+
+    // Keep the buffer in the pool or free it outside of the lock
+    if (_buffers.size() < _capacity)
+        _buffers.emplace_back(std::move(released));
+}
+
+inline void BufferPool::Clear()
+{
+    std::vector<std::vector<uint8_t>> buffers;
+    {
+        std::scoped_lock locker(_lock);
+        buffers.swap(_buffers);
+    }
+}
+
 template <typename THandler>
 inline AllocateHandler<THandler> make_alloc_handler(HandlerStorage& storage, THandler handler)
 {
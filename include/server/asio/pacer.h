@@ -0,0 +1,170 @@
+/*!
+    \file pacer.h
+    \brief Send pacer definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_PACER_H
+#define CPPSERVER_ASIO_PACER_H
+
+#include "udp_batch.h"
+
+#include <cstdint>
+
+namespace CppServer {
+namespace Asio {
+
+//! Pacing rate unit
+enum class PacingUnit
+{
+    Bytes,              //!< Pacing rate in bytes per second
+    Packets             //!< Pacing rate in packets (messages) per second
+};
+
+//! Send pacer
+/*!
+    Send pacer is a token bucket which spreads sent messages evenly in time
+    with the given rate instead of sending them in microbursts which overflow
+    receiver buffers. The bucket is implemented as a virtual scheduling clock:
+    each message moves the theoretical departure time forward by its cost
+    (size / rate), and the message may be sent when its departure time is not
+    further than the burst in the future.
+
+    All timestamps are monotonic nanoseconds ('CppCommon::Timestamp::nano()'),
+    the same clock is used for SO_TXTIME launch times.
+
+    Not thread-safe.
+*/
+class Pacer
+{
+public:
+    //! Transmit time horizon in nanoseconds
+    /*!
+        Datagrams with SO_TXTIME launch times are handed to the kernel at most
+        this time ahead of their departure, so a missing fq queue discipline
+        degrades pacing only to bursts of this duration.
+    */
+    static const uint64_t TRANSMIT_TIME_HORIZON = 1000000;
+
+    Pacer() noexcept;
+    Pacer(const Pacer&) = default;
+    Pacer(Pacer&&) = default;
+    ~Pacer() = default;
+
+    Pacer& operator=(const Pacer&) = default;
+    Pacer& operator=(Pacer&&) = default;
+
+    //! Is the pacer enabled?
+    bool enabled() const noexcept { return _rate > 0; }
+
+    //! Get the target pacing rate in units per second
+    uint64_t rate() const noexcept { return _rate; }
+    //! Get the pacing rate unit
+    PacingUnit unit() const noexcept { return _unit; }
+    //! Get the burst size in units
+    uint64_t burst() const noexcept { return _burst; }
+
+    //! Get the number of paced messages
+    uint64_t messages_paced() const noexcept { return _messages_paced; }
+    //! Get the number of paced bytes
+    uint64_t bytes_paced() const noexcept { return _bytes_paced; }
+    //! Get the number of times the sender was throttled
+    uint64_t throttles() const noexcept { return _throttles; }
+
+    //! Get the achieved pacing rate in units per second
+    /*!
+        Achieved rate is measured from the first paced message to the current
+        time, so it should be compared with 'rate()' while the sender is busy.
+    */
+    double achieved_rate() const noexcept;
+
+    //! Setup the pacer
+    /*!
+        \param rate - Pacing rate in units per second (0 - disable pacing)
+        \param unit - Pacing rate unit (default is PacingUnit::Bytes)
+        \param burst - Burst size in units which could be sent at once (default is 0)
+    */
+    void Setup(uint64_t rate, PacingUnit unit = PacingUnit::Bytes, uint64_t burst = 0) noexcept;
+    //! Reset the token bucket and the pacer statistic
+    void Reset() noexcept;
+
+    //! Get the delay before the next message could be sent
+    /*!
+        \param timestamp - Current monotonic timestamp in nanoseconds
+        \param horizon - Allowed time to send ahead of the departure time in nanoseconds (default is 0)
+        \return Delay in nanoseconds (0 if the message could be sent right now)
+    */
+    uint64_t Delay(uint64_t timestamp, uint64_t horizon = 0) const noexcept;
+    //! Consume tokens of the sent message
+    /*!
+        \param timestamp - Current monotonic timestamp in nanoseconds
+        \param size - Message size in bytes
+        \return Departure time of the message in nanoseconds (SO_TXTIME launch time)
+    */
+    uint64_t Consume(uint64_t timestamp, size_t size) noexcept;
+    //! Count the sender throttled by the pacer
+    void Throttle() noexcept { ++_throttles; }
+
+    //! Is the given delay too short to be waited with timers?
+    /*!
+        Delays shorter than the OS timer slack are not precise with timers,
+        so senders should yield the working thread (post the send handler)
+        instead of arming the timer. The working thread is never busy waited.
+
+        \param delay - Delay in nanoseconds
+        \return 'true' if the delay should be yielded, 'false' if the delay should be waited with the timer
+    */
+    static bool IsShortDelay(uint64_t delay) noexcept;
+
+    //! Is SO_TXTIME transmit time supported?
+    static bool IsTransmitTimeSupported() noexcept;
+    //! Enable SO_TXTIME transmit time for the UDP socket
+    /*!
+        Launch times are honored only if the egress interface uses fq queue
+        discipline. The transmit time is enabled only if such queue discipline
+        is found on the network interface of the socket local address (on any
+        network interface for the wildcard address), so the caller falls back
+        to the user space pacing otherwise. The etf queue discipline is not
+        supported, because it expects CLOCK_TAI launch times and drops
+        datagrams with CLOCK_MONOTONIC ones.
+
+        \param socket - UDP socket
+        \param ec - Error code
+        \return 'true' if the transmit time was enabled, 'false' if the transmit time is not supported or no fq queue discipline was found
+    */
+    static bool EnableTransmitTime(asio::ip::udp::socket& socket, asio::error_code& ec);
+    //! Send a batch of datagrams with their launch times
+    /*!
+        Other platforms fall back to 'UDPBatch::Send()' and ignore launch times.
+
+        \param socket - UDP socket with enabled transmit time
+        \param datagrams - Datagrams array to send
+        \param launch_times - Launch times array in monotonic nanoseconds
+        \param count - Count of datagrams to send
+        \param ec - Error code
+        \return Count of sent datagrams
+    */
+    static size_t Send(asio::ip::udp::socket& socket, const UDPDatagram* datagrams, const uint64_t* launch_times, size_t count, asio::error_code& ec);
+
+private:
+    uint64_t _rate;
+    PacingUnit _unit;
+    uint64_t _burst;
+    // Token bucket state
+    uint64_t _departure;
+    uint64_t _remainder;
+    uint64_t _tolerance;
+    // Pacer statistic
+    uint64_t _started;
+    uint64_t _units_paced;
+    uint64_t _messages_paced;
+    uint64_t _bytes_paced;
+    uint64_t _throttles;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_PACER_H
@@ -0,0 +1,269 @@
+/*!
+    \file rudp.h
+    \brief Reliable UDP protocol definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_RUDP_H
+#define CPPSERVER_ASIO_RUDP_H
+
+#include "time/timespan.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! Reliable UDP packets queue
+/*!
+    Packets queue keeps packets in the contiguous buffer with their sizes.
+*/
+struct RUDPQueue
+{
+    //! Packets buffer
+    std::vector<uint8_t> buffer;
+    //! Packets sizes
+    std::vector<size_t> sizes;
+
+    //! Is the queue empty?
+    bool empty() const noexcept { return sizes.empty(); }
+    //! Clear the queue
+    void clear() noexcept { buffer.clear(); sizes.clear(); }
+    //! Push a new packet into the queue
+    void push(const void* data, size_t size);
+};
+
+//! Reliable UDP protocol
+/*!
+    Reliable UDP protocol is a transport independent ARQ engine which
+    provides reliable delivery of messages over lossy datagram links:
+    - sequence numbers with cumulative and selective (32 packets) ACKs;
+    - retransmission timeout estimated from the round-trip time;
+    - fast retransmit of packets skipped by later ACKs;
+    - send/receive windows and optional NewReno-like congestion control;
+    - ordered or unordered delivery of messages.
+
+    Each message is sent in a single packet, so the message size should not
+    exceed the maximal payload size. Received packets are passed with 'Input()',
+    packets to send are produced by 'Input()' and 'Flush()' into the output
+    queue, delivered messages are collected into the delivered queue.
+    'Flush()' should be also called periodically to handle retransmissions.
+
+    Timestamps are monotonic nanoseconds (e.g. CppCommon::Timestamp::nano()).
+
+    Not thread-safe.
+*/
+class RUDPProtocol
+{
+public:
+    //! Data packet header size
+    static constexpr size_t HEADER_SIZE = 8;
+    //! Acknowledgement packet size
+    static constexpr size_t ACK_SIZE = 12;
+
+    RUDPProtocol();
+    RUDPProtocol(const RUDPProtocol&) = delete;
+    RUDPProtocol(RUDPProtocol&&) = default;
+    ~RUDPProtocol() = default;
+
+    RUDPProtocol& operator=(const RUDPProtocol&) = delete;
+    RUDPProtocol& operator=(RUDPProtocol&&) = default;
+
+    //! Get the number of messages sent
+    uint64_t messages_sent() const noexcept { return _messages_sent; }
+    //! Get the number of messages delivered
+    uint64_t messages_received() const noexcept { return _messages_received; }
+    //! Get the number of packets sent (including retransmissions and ACKs)
+    uint64_t packets_sent() const noexcept { return _packets_sent; }
+    //! Get the number of packets received
+    uint64_t packets_received() const noexcept { return _packets_received; }
+    //! Get the number of retransmitted packets
+    uint64_t packets_retransmitted() const noexcept { return _packets_retransmitted; }
+    //! Get the number of fast retransmitted packets
+    uint64_t packets_fast_retransmitted() const noexcept { return _packets_fast_retransmitted; }
+    //! Get the number of duplicated packets received
+    uint64_t packets_duplicated() const noexcept { return _packets_duplicated; }
+    //! Get the number of invalid or out of window packets received
+    uint64_t packets_invalid() const noexcept { return _packets_invalid; }
+
+    //! Get the count of messages waiting for the send window
+    size_t send_queued() const noexcept { return _send_queue.size(); }
+    //! Get the count of packets in flight (sent but not acknowledged)
+    size_t send_inflight() const noexcept { return _send_buffer.size(); }
+    //! Get the current congestion window in packets
+    size_t congestion_window() const noexcept { return (size_t)_cwnd; }
+    //! Get the smoothed round-trip time
+    CppCommon::Timespan rtt() const noexcept { return CppCommon::Timespan((int64_t)_srtt); }
+    //! Get the current retransmission timeout
+    CppCommon::Timespan rto() const noexcept { return CppCommon::Timespan((int64_t)_rto); }
+
+    //! Get the option: send window in packets
+    size_t option_send_window() const noexcept { return _option_send_window; }
+    //! Get the option: receive window in packets
+    size_t option_receive_window() const noexcept { return _option_receive_window; }
+    //! Get the option: congestion control
+    bool option_congestion_control() const noexcept { return _option_congestion_control; }
+    //! Get the option: ordered delivery
+    bool option_ordered() const noexcept { return _option_ordered; }
+    //! Get the option: fast retransmit skip count
+    size_t option_fast_retransmit() const noexcept { return _option_fast_retransmit; }
+    //! Get the option: minimal retransmission timeout
+    const CppCommon::Timespan& option_min_rto() const noexcept { return _option_min_rto; }
+    //! Get the option: maximal message payload size
+    size_t option_max_payload() const noexcept { return _option_max_payload; }
+
+    //! Is there any data pending to send or to acknowledge?
+    bool IsPending() const noexcept { return !_send_queue.empty() || !_send_buffer.empty() || _ack_required; }
+
+    //! Setup option: send/receive windows
+    /*!
+        \param send_window - Maximal count of packets in flight (default is 256)
+        \param receive_window - Maximal count of buffered out of order packets (default is 256)
+    */
+    void SetupWindow(size_t send_window, size_t receive_window) noexcept;
+    //! Setup option: congestion control
+    /*!
+        With congestion control the count of packets in flight is limited
+        by the congestion window, which grows with ACKs and shrinks on loss.
+        Without congestion control only send/receive windows are used.
+
+        \param enable - Enable/disable option (default is enabled)
+    */
+    void SetupCongestionControl(bool enable) noexcept { _option_congestion_control = enable; }
+    //! Setup option: ordered delivery
+    /*!
+        \param enable - Enable/disable ordered delivery (default is enabled)
+    */
+    void SetupOrdered(bool enable) noexcept { _option_ordered = enable; }
+    //! Setup option: fast retransmit
+    /*!
+        \param count - Count of later acknowledged packets to retransmit the skipped one (0 - disable, default is 3)
+    */
+    void SetupFastRetransmit(size_t count) noexcept { _option_fast_retransmit = count; }
+    //! Setup option: minimal retransmission timeout
+    /*!
+        \param timeout - Minimal retransmission timeout (default is 20 milliseconds)
+    */
+    void SetupMinRTO(const CppCommon::Timespan& timeout) noexcept { _option_min_rto = timeout; }
+    //! Setup option: maximal message payload size
+    /*!
+        \param size - Maximal message payload size (default is 1400 bytes)
+    */
+    void SetupMaxPayload(size_t size) noexcept { _option_max_payload = size; }
+
+    //! Send the message
+    /*!
+        The message is queued and sent with the next 'Flush()' call when
+        the send window allows.
+
+        \param buffer - Message buffer
+        \param size - Message size
+        \return 'true' if the message was successfully queued, 'false' if the message is too large
+    */
+    bool Send(const void* buffer, size_t size);
+
+    //! Input the received packet
+    /*!
+        \param buffer - Packet buffer
+        \param size - Packet size
+        \param timestamp - Current timestamp in nanoseconds
+        \return 'true' if the packet was successfully handled, 'false' if the packet is invalid
+    */
+    bool Input(const void* buffer, size_t size, uint64_t timestamp);
+
+    //! Flush ACKs, retransmissions and new packets into the output queue
+    /*!
+        \param timestamp - Current timestamp in nanoseconds
+    */
+    void Flush(uint64_t timestamp);
+
+    //! Take packets to send
+    /*!
+        \param queue - Packets queue to swap with the output queue
+    */
+    void TakeOutput(RUDPQueue& queue);
+    //! Take delivered messages
+    /*!
+        \param queue - Messages queue to swap with the delivered queue
+    */
+    void TakeDelivered(RUDPQueue& queue);
+
+    //! Reset the protocol state and statistic
+    void Reset();
+
+private:
+    // Sent packet waiting for acknowledgement
+    struct Segment
+    {
+        uint32_t seq;
+        std::vector<uint8_t> data;
+        uint64_t timestamp;
+        uint64_t deadline;
+        size_t transmits;
+        size_t skipped;
+        bool acked;
+        bool fast;
+    };
+
+    // Send state
+    std::deque<std::vector<uint8_t>> _send_queue;
+    std::deque<Segment> _send_buffer;
+    uint32_t _send_una;
+    uint32_t _send_next;
+    uint32_t _recover;
+    size_t _remote_window;
+    // Receive state
+    std::map<uint32_t, std::vector<uint8_t>> _receive_buffer;
+    uint32_t _receive_next;
+    bool _ack_required;
+    // Congestion & RTT state
+    double _cwnd;
+    double _ssthresh;
+    double _srtt;
+    double _rttvar;
+    double _rto;
+    // Output & delivered queues
+    RUDPQueue _output;
+    RUDPQueue _delivered;
+    // Statistic
+    uint64_t _messages_sent;
+    uint64_t _messages_received;
+    uint64_t _packets_sent;
+    uint64_t _packets_received;
+    uint64_t _packets_retransmitted;
+    uint64_t _packets_fast_retransmitted;
+    uint64_t _packets_duplicated;
+    uint64_t _packets_invalid;
+    // Options
+    size_t _option_send_window;
+    size_t _option_receive_window;
+    bool _option_congestion_control;
+    bool _option_ordered;
+    size_t _option_fast_retransmit;
+    CppCommon::Timespan _option_min_rto;
+    size_t _option_max_payload;
+
+    //! Input the data packet
+    void InputData(uint32_t seq, const uint8_t* payload, size_t size);
+    //! Input the acknowledgement packet
+    void InputAck(uint32_t ack, uint32_t sack, uint64_t timestamp);
+    //! Acknowledge the sent segment
+    void AckSegment(Segment& segment, uint64_t timestamp);
+    //! Output the data segment
+    void OutputSegment(Segment& segment, uint64_t timestamp);
+    //! Output the acknowledgement packet
+    void OutputAck();
+    //! Get the current receive window advertised to the remote side
+    size_t ReceiveWindow() const noexcept;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_RUDP_H
@@ -0,0 +1,158 @@
+/*!
+    \file rudp_client.h
+    \brief Reliable UDP client definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_RUDP_CLIENT_H
+#define CPPSERVER_ASIO_RUDP_CLIENT_H
+
+#include "rudp.h"
+#include "udp_client.h"
+
+#include <mutex>
+
+namespace CppServer {
+namespace Asio {
+
+//! Reliable UDP client
+/*!
+    Reliable UDP client is used to send and receive messages with the reliable
+    UDP protocol to/from the reliable UDP session of the server ('RUDPSession').
+    Sent messages are retransmitted until acknowledged by the server and
+    received messages are delivered with 'onReceived()' handler exactly once
+    (and in order if the ordered delivery is enabled).
+
+    'ReceiveAsync()' should be called once when the client is connected,
+    then the client keeps receiving protocol packets.
+
+    Protocol state is kept between reconnects, call 'protocol().Reset()'
+    to start a new protocol session.
+
+    Thread-safe.
+*/
+class RUDPClient : public UDPClient
+{
+public:
+    //! Initialize reliable UDP client with a given Asio service, server address and port number
+    /*!
+        \param service - Asio service
+        \param address - Server address
+        \param port - Server port number
+    */
+    RUDPClient(std::shared_ptr<Service> service, const std::string& address, int port);
+    //! Initialize reliable UDP client with a given Asio service, server address and scheme name
+    /*!
+        \param service - Asio service
+        \param address - Server address
+        \param scheme - Scheme name
+    */
+    RUDPClient(std::shared_ptr<Service> service, const std::string& address, const std::string& scheme);
+    //! Initialize reliable UDP client with a given Asio service and endpoint
+    /*!
+        \param service - Asio service
+        \param endpoint - Server UDP endpoint
+    */
+    RUDPClient(std::shared_ptr<Service> service, const asio::ip::udp::endpoint& endpoint);
+    RUDPClient(const RUDPClient&) = delete;
+    RUDPClient(RUDPClient&&) = delete;
+    virtual ~RUDPClient() = default;
+
+    RUDPClient& operator=(const RUDPClient&) = delete;
+    RUDPClient& operator=(RUDPClient&&) = delete;
+
+    //! Get the reliable UDP protocol
+    /*!
+        Protocol options should be set up before the first sent or received
+        message. Protocol statistic is read without synchronization.
+    */
+    RUDPProtocol& protocol() noexcept { return _protocol; }
+
+    //! Get the option: flush interval
+    const CppCommon::Timespan& option_flush_interval() const noexcept { return _option_flush_interval; }
+
+    //! Send message to the server (synchronous)
+    /*!
+        The message is queued into the reliable UDP protocol and sent as soon
+        as the send window allows.
+
+        \param buffer - Message buffer to send
+        \param size - Message size (should not exceed the protocol maximal payload)
+        \return Size of queued message
+    */
+    size_t Send(const void* buffer, size_t size) override;
+    //! Send text to the server (synchronous)
+    /*!
+        \param text - Text to send
+        \return Size of queued text
+    */
+    size_t Send(const std::string_view& text) override { return Send(text.data(), text.size()); }
+
+    //! Send message to the server (asynchronous)
+    /*!
+        \param buffer - Message buffer to send
+        \param size - Message size (should not exceed the protocol maximal payload)
+        \return 'true' if the message was successfully queued, 'false' if the message was not queued
+    */
+    bool SendAsync(const void* buffer, size_t size) override;
+    //! Send text to the server (asynchronous)
+    /*!
+        \param text - Text to send
+        \return 'true' if the text was successfully queued, 'false' if the text was not queued
+    */
+    bool SendAsync(const std::string_view& text) override { return SendAsync(text.data(), text.size()); }
+
+    //! Setup option: flush interval
+    /*!
+        Flush interval is the period of the protocol timer which handles
+        retransmissions while there are unacknowledged messages.
+
+        \param interval - Flush interval (default is 10 milliseconds)
+    */
+    void SetupFlushInterval(const CppCommon::Timespan& interval) noexcept { _option_flush_interval = interval; }
+
+protected:
+    //! Handle datagram received notification
+    /*!
+        Decodes the reliable UDP packet received from the server endpoint and
+        delivers received messages with 'onReceived(buffer, size)' handler.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override;
+    //! Handle message received notification
+    /*!
+        \param buffer - Received message buffer
+        \param size - Received message size
+    */
+    virtual void onReceived(const void* buffer, size_t size) {}
+
+private:
+    // Reliable UDP protocol
+    std::mutex _protocol_lock;
+    RUDPProtocol _protocol;
+    bool _delivering;
+    // Protocol flush timer
+    asio::system_timer _flush_timer;
+    bool _flushing;
+    // Options
+    CppCommon::Timespan _option_flush_interval;
+
+    //! Flush the protocol and send its packets
+    void Flush();
+    //! Schedule the protocol flush timer if required
+    void ScheduleFlush();
+    //! Send protocol packets to the server
+    void Output(const RUDPQueue& output);
+    //! Deliver received messages in order with 'onReceived()' handler
+    void Deliver();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_RUDP_CLIENT_H
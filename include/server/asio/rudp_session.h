@@ -0,0 +1,134 @@
+/*!
+    \file rudp_session.h
+    \brief Reliable UDP session definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_RUDP_SESSION_H
+#define CPPSERVER_ASIO_RUDP_SESSION_H
+
+#include "rudp.h"
+#include "udp_server.h"
+
+#include <mutex>
+
+namespace CppServer {
+namespace Asio {
+
+//! Reliable UDP session
+/*!
+    Reliable UDP session is a virtual UDP session which sends and receives
+    messages with the reliable UDP protocol. Sent messages are retransmitted
+    until acknowledged by the peer and received messages are delivered with
+    'onReceived()' handler exactly once (and in order if the ordered delivery
+    is enabled). The peer should use the reliable UDP protocol as well
+    (e.g. 'RUDPClient').
+
+    'onSent()' handler is called for each sent protocol packet.
+
+    Thread-safe.
+*/
+class RUDPSession : public UDPSession
+{
+public:
+    //! Initialize the session with a given server and peer endpoint
+    /*!
+        \param server - Connected server
+        \param endpoint - Peer endpoint
+    */
+    RUDPSession(std::shared_ptr<UDPServer> server, const asio::ip::udp::endpoint& endpoint);
+    RUDPSession(const RUDPSession&) = delete;
+    RUDPSession(RUDPSession&&) = delete;
+    virtual ~RUDPSession() = default;
+
+    RUDPSession& operator=(const RUDPSession&) = delete;
+    RUDPSession& operator=(RUDPSession&&) = delete;
+
+    //! Get the reliable UDP protocol
+    /*!
+        Protocol options should be set up before the first sent or received
+        message. Protocol statistic is read without synchronization.
+    */
+    RUDPProtocol& protocol() noexcept { return _protocol; }
+
+    //! Get the option: flush interval
+    const CppCommon::Timespan& option_flush_interval() const noexcept { return _option_flush_interval; }
+
+    //! Send message to the peer (synchronous)
+    /*!
+        The message is queued into the reliable UDP protocol and sent as soon
+        as the send window allows.
+
+        \param buffer - Message buffer to send
+        \param size - Message size (should not exceed the protocol maximal payload)
+        \return Size of queued message
+    */
+    size_t Send(const void* buffer, size_t size) override;
+    //! Send text to the peer (synchronous)
+    /*!
+        \param text - Text to send
+        \return Size of queued text
+    */
+    size_t Send(const std::string_view& text) override { return Send(text.data(), text.size()); }
+
+    //! Send message to the peer (asynchronous)
+    /*!
+        \param buffer - Message buffer to send
+        \param size - Message size (should not exceed the protocol maximal payload)
+        \return 'true' if the message was successfully queued, 'false' if the message was not queued
+    */
+    bool SendAsync(const void* buffer, size_t size) override;
+    //! Send text to the peer (asynchronous)
+    /*!
+        \param text - Text to send
+        \return 'true' if the text was successfully queued, 'false' if the text was not queued
+    */
+    bool SendAsync(const std::string_view& text) override { return SendAsync(text.data(), text.size()); }
+
+    //! Setup option: flush interval
+    /*!
+        Flush interval is the period of the protocol timer which handles
+        retransmissions while there are unacknowledged messages.
+
+        \param interval - Flush interval (default is 10 milliseconds)
+    */
+    void SetupFlushInterval(const CppCommon::Timespan& interval) noexcept { _option_flush_interval = interval; }
+
+protected:
+    //! Handle raw datagram received notification
+    /*!
+        Decodes the reliable UDP packet and delivers received messages
+        with 'onReceived()' handler.
+
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    void onReceivedDatagram(const void* buffer, size_t size) override;
+
+private:
+    // Reliable UDP protocol
+    std::mutex _protocol_lock;
+    RUDPProtocol _protocol;
+    bool _delivering;
+    // Protocol flush timer
+    asio::system_timer _flush_timer;
+    bool _flushing;
+    // Options
+    CppCommon::Timespan _option_flush_interval;
+
+    //! Flush the protocol and send its packets
+    void Flush();
+    //! Schedule the protocol flush timer if required
+    void ScheduleFlush();
+    //! Send protocol packets to the peer
+    void Output(const RUDPQueue& output);
+    //! Deliver received messages in order with 'onReceived()' handler
+    void Deliver();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_RUDP_SESSION_H
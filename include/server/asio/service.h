@@ -74,6 +74,8 @@ public:
 
     //! Get the number of working threads
     size_t threads() const noexcept { return _threads.size(); }
+    //! Get the number of Asio IO services
+    size_t services() const noexcept { return _services.size(); }
 
     //! Is the service required strand to serialized handler execution?
     bool IsStrandRequired() const noexcept { return _strand_required; }
@@ -109,6 +111,18 @@ public:
     */
     virtual std::shared_ptr<asio::io_service>& GetAsioService() noexcept
     { return _services[++_round_robin_index % _services.size()]; }
+    //! Get the Asio IO service with a given index
+    /*!
+        \param index - Asio IO service index
+        \return Asio IO service
+    */
+    std::shared_ptr<asio::io_service>& GetAsioService(size_t index) noexcept
+    { return _services[index % _services.size()]; }
+    //! Get the Asio IO service of the current working thread
+    /*!
+        \return Asio IO service of the current working thread or nullptr if the current thread is not a service working thread
+    */
+    static std::shared_ptr<asio::io_service> GetCurrentAsioService() noexcept;
 
     //! Dispatch the given handler
     /*!
@@ -90,11 +90,23 @@ public:
     uint64_t bytes_sent() const noexcept;
     //! Get the number of bytes received by the client
     uint64_t bytes_received() const noexcept;
+    //! Get the number of socket reads of the current connection (memory BIO option)
+    uint64_t socket_reads() const noexcept;
+    //! Get the number of socket writes of the current connection (memory BIO option)
+    uint64_t socket_writes() const noexcept;
 
     //! Get the option: keep alive
     bool option_keep_alive() const noexcept;
     //! Get the option: no delay
     bool option_no_delay() const noexcept;
+    //! Get the option: session resumption
+    bool option_session_resumption() const noexcept;
+    //! Get the option: kernel TLS
+    bool option_kernel_tls() const noexcept;
+    //! Get the option: early data
+    bool option_early_data() const noexcept;
+    //! Get the option: memory BIO
+    bool option_memory_bio() const noexcept;
     //! Get the option: receive buffer size
     size_t option_receive_buffer_size() const;
     //! Get the option: send buffer size
@@ -104,6 +116,14 @@ public:
     bool IsConnected() const noexcept;
     //! Is the session handshaked?
     bool IsHandshaked() const noexcept;
+    //! Is the session resumed with the abbreviated handshake?
+    bool IsResumed() const noexcept;
+    //! Is TLS 1.3 early data of the client accepted by the server?
+    bool IsEarlyDataAccepted() const noexcept;
+    //! Is the send path offloaded to the kernel TLS?
+    bool IsSendOffloaded() const noexcept;
+    //! Is the receive path offloaded to the kernel TLS?
+    bool IsReceiveOffloaded() const noexcept;
 
     //! Connect the client (synchronous)
     /*!
@@ -181,6 +201,10 @@ public:
 
     //! Send data to the server (asynchronous)
     /*!
+        With the early data option the data is also queued while the client
+        is connecting or handshaking, or while it is disconnected with a saved
+        session to resume on the next connect (see SetupEarlyData()).
+
         \param buffer - Buffer to send
         \param size - Buffer size
         \return 'true' if the data was successfully sent, 'false' if the client is not connected
@@ -242,6 +266,54 @@ public:
         \param enable - Enable/disable option
     */
     void SetupNoDelay(bool enable) noexcept;
+    //! Setup option: session resumption
+    /*!
+        This option will keep the last SSL session (or session ticket) of
+        the client and offer it to the server on the next connect, so
+        reconnects perform the abbreviated handshake without public key
+        operations if the server accepts the session.
+
+        \param enable - Enable/disable option (default is enabled)
+    */
+    void SetupSessionResumption(bool enable) noexcept;
+    //! Setup option: kernel TLS
+    /*!
+        This option will attach OpenSSL directly to the client socket and
+        offload encryption of application data to the OS kernel (kTLS) after
+        the handshake. The client keeps the default Asio SSL stream if the
+        OS kernel does not support kTLS.
+
+        \param enable - Enable/disable option
+    */
+    void SetupKernelTLS(bool enable) noexcept;
+    //! Setup option: early data
+    /*!
+        This option will allow to send data before the handshake is finished.
+        Data sent with SendAsync() during the connect and the handshake, or
+        before ConnectAsync() of the client with a saved session, is queued
+        and sent as TLS 1.3 early data (0-RTT) with the resumed session, if
+        the server allows early data for it. Early data rejected by the server
+        is sent again after the handshake. SendAsync() still fails for the
+        disconnected client without a saved session.
+
+        Early data could be replayed by an attacker, so only idempotent
+        requests should be sent before the handshake.
+
+        \param enable - Enable/disable option
+    */
+    void SetupEarlyData(bool enable) noexcept;
+    //! Setup option: memory BIO
+    /*!
+        This option will replace Asio BIO pair of the client with the memory
+        BIO over pooled buffers. The client reads the socket into the large
+        input buffer and decrypts all received TLS records at once, TLS records
+        of the send buffer are flushed with one gather write instead of one
+        socket write per record. The client with kernel TLS or early data
+        keeps OpenSSL on the socket.
+
+        \param enable - Enable/disable option
+    */
+    void SetupMemoryBIO(bool enable) noexcept;
     //! Setup option: receive buffer size
     /*!
         This option will setup SO_RCVBUF if the OS support this feature.
@@ -11,9 +11,36 @@
 
 #include "service.h"
 
+#include "time/timespan.h"
+
+#include <memory>
+#include <vector>
+
 namespace CppServer {
 namespace Asio {
 
+//! SSL session ticket key
+/*!
+    Session ticket key has the same 80 bytes layout as nginx session ticket
+    key files ('ssl_session_ticket_key'), so keys could be generated once,
+    distributed as files and shared by all processes of the cluster:
+    - 16 bytes of the key name;
+    - 32 bytes of the HMAC-SHA256 key;
+    - 32 bytes of the AES-256-CBC key.
+*/
+struct SSLTicketKey
+{
+    //! Key name
+    uint8_t name[16];
+    //! HMAC-SHA256 key
+    uint8_t hmac_key[32];
+    //! AES-256-CBC key
+    uint8_t aes_key[32];
+
+    //! Generate a new random session ticket key
+    static SSLTicketKey Generate();
+};
+
 //! SSL context
 /*!
     SSL context is used to handle and validate certificates in SSL clients and servers.
@@ -34,6 +61,68 @@ public:
 
     //! Configures the context to use system root certificates
     void set_root_certs();
+
+    //! Configures the server-side session cache
+    /*!
+        Session cache keeps sessions of clients in the server memory, so
+        clients could resume them with the abbreviated handshake without
+        public key operations.
+
+        \param size - Maximal count of cached sessions (0 - disable session cache)
+        \param timeout - Session timeout (default is 5 minutes)
+        \param id_context - Session id context, should be the same for all contexts sharing sessions (default is "CppServer")
+    */
+    void set_session_cache(size_t size, const CppCommon::Timespan& timeout = CppCommon::Timespan::minutes(5), const std::string& id_context = "CppServer");
+
+    //! Enable or disable session tickets
+    /*!
+        Session tickets keep encrypted sessions on the client side, so
+        the server does not need the session cache to resume them. Without
+        ticket keys the context uses random keys of the current process.
+
+        \param enable - Enable/disable session tickets
+    */
+    void set_session_tickets(bool enable);
+    //! Configures session ticket keys
+    /*!
+        The first key encrypts new tickets, all keys decrypt tickets. Tickets
+        encrypted with other than the first key are renewed with the first key.
+
+        \param keys - Session ticket keys (empty - use random keys of the current process)
+    */
+    void set_ticket_keys(const std::vector<SSLTicketKey>& keys);
+    //! Rotate session ticket keys
+    /*!
+        The new key becomes the encryption key, previous keys are kept to
+        decrypt tickets issued before the rotation.
+
+        \param key - New session ticket key
+        \param keep - Count of previous keys to keep for decryption (default is 2)
+    */
+    void rotate_ticket_key(const SSLTicketKey& key, size_t keep = 2);
+    //! Load session ticket keys from the file
+    /*!
+        The file is a sequence of 80 bytes keys, the first key encrypts
+        new tickets.
+
+        \param path - Session ticket keys file path
+        \return 'true' if keys were successfully loaded, 'false' if the file is not valid
+    */
+    bool load_ticket_keys(const std::string& path);
+    //! Get session ticket keys
+    std::vector<SSLTicketKey> ticket_keys() const;
+
+private:
+    // Session ticket keys shared with the ticket key callback
+    struct TicketKeys;
+    std::shared_ptr<TicketKeys> _ticket_keys;
+
+    //! Install the session ticket key callback
+    void InstallTicketKeys(bool install);
+
+    //! Session ticket key callback
+    template <typename TMacContext>
+    static int TicketKeyCallback(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, TMacContext* mac, int enc);
 };
 
 } // namespace Asio
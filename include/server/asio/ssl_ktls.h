@@ -0,0 +1,191 @@
+/*!
+    \file ssl_ktls.h
+    \brief SSL kernel TLS stream definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SSL_KTLS_H
+#define CPPSERVER_ASIO_SSL_KTLS_H
+
+#include "asio.h"
+
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! SSL kernel TLS stream
+/*!
+    SSL kernel TLS stream attaches OpenSSL directly to the socket of the SSL
+    stream instead of Asio memory BIOs and enables kernel TLS offload
+    (SSL_OP_ENABLE_KTLS). After the handshake OpenSSL installs TX/RX keys
+    into the socket, so application data is encrypted and decrypted by the
+    Linux kernel (or by the network card) without copies into OpenSSL
+    buffers, and files could be sent with sendfile().
+
+    If the kernel or OpenSSL cannot offload the negotiated cipher, OpenSSL
+    continues to encrypt in user space directly on the socket, so the stream
+    keeps working with the fallback. The same fallback is used to perform
+    TLS 1.3 early data handshakes, which Asio SSL stream does not support.
+
+    All asynchronous operations wait for the socket readiness and invoke
+    the handler with its associated executor. Synchronous operations block
+    until the socket is ready.
+
+    Not thread-safe.
+*/
+class SSLKernelStream
+{
+public:
+    //! Initialize kernel TLS stream with the given SSL stream
+    /*!
+        \param stream - SSL stream
+    */
+    explicit SSLKernelStream(asio::ssl::stream<asio::ip::tcp::socket>& stream);
+    SSLKernelStream(const SSLKernelStream&) = delete;
+    SSLKernelStream(SSLKernelStream&&) = delete;
+    ~SSLKernelStream() = default;
+
+    SSLKernelStream& operator=(const SSLKernelStream&) = delete;
+    SSLKernelStream& operator=(SSLKernelStream&&) = delete;
+
+    //! Is the kernel TLS supported by the OS kernel and OpenSSL?
+    static bool IsSupported() noexcept;
+
+    //! Is the stream attached to the socket?
+    bool IsAttached() const noexcept { return _attached; }
+    //! Is the send path offloaded to the kernel?
+    bool IsSendOffloaded() const noexcept;
+    //! Is the receive path offloaded to the kernel?
+    bool IsReceiveOffloaded() const noexcept;
+
+    //! Attach OpenSSL to the connected socket before the handshake
+    /*!
+        \param offload - Offload the encryption to the kernel TLS (default is true)
+        \return 'true' if OpenSSL was successfully attached, 'false' if the kernel TLS or the socket attach is not supported
+    */
+    bool Attach(bool offload = true);
+
+    //! Perform the SSL handshake (synchronous)
+    /*!
+        \param type - Handshake type
+        \param ec - Error code
+    */
+    void handshake(asio::ssl::stream_base::handshake_type type, asio::error_code& ec);
+    //! Read some data (synchronous)
+    /*!
+        \param buffer - Buffer to read
+        \param ec - Error code
+        \return Size of read data
+    */
+    size_t read_some(const asio::mutable_buffer& buffer, asio::error_code& ec);
+    //! Write the whole buffer (synchronous)
+    /*!
+        \param buffer - Buffer to write
+        \param ec - Error code
+        \return Size of written data
+    */
+    size_t write(const asio::const_buffer& buffer, asio::error_code& ec);
+    //! Send the file content with sendfile() (synchronous)
+    /*!
+        Requires the offloaded send path, otherwise returns zero with
+        'operation_not_supported' error.
+
+        \param fd - File descriptor
+        \param offset - File offset
+        \param size - Size of the file content to send
+        \param ec - Error code
+        \return Size of sent data
+    */
+    size_t sendfile(int fd, int64_t offset, size_t size, asio::error_code& ec);
+
+    //! Perform the SSL handshake (asynchronous)
+    /*!
+        \param type - Handshake type
+        \param handler - Handler with the signature void(std::error_code)
+    */
+    template <typename THandler>
+    void async_handshake(asio::ssl::stream_base::handshake_type type, THandler&& handler);
+    //! Perform the SSL handshake with TLS 1.3 early data (asynchronous)
+    /*!
+        The client sends the content of the early data buffer as 0-RTT data
+        with the resumed session before the handshake.
+
+        The server receives 0-RTT data of the client into the early data
+        buffer and calls the handler as soon as some data is received, before
+        the handshake is finished (SSL_is_init_finished() returns 0). The
+        caller could process received data, answer it with async_write_early()
+        and continue the handshake with the next call of this method.
+
+        The buffer should be valid until the handler is called.
+
+        \param type - Handshake type
+        \param early_data - Early data buffer
+        \param handler - Handler with the signature void(std::error_code)
+    */
+    template <typename THandler>
+    void async_handshake(asio::ssl::stream_base::handshake_type type, std::vector<uint8_t>& early_data, THandler&& handler);
+    //! Write the whole buffer as TLS 1.3 early data of the server (asynchronous)
+    /*!
+        The server could write 0.5-RTT data to the client, which is not
+        authenticated yet, after receiving its early data and before the
+        handshake is finished.
+
+        \param buffer - Buffer to write
+        \param handler - Handler with the signature void(std::error_code, size_t)
+    */
+    template <typename THandler>
+    void async_write_early(const asio::const_buffer& buffer, THandler&& handler);
+    //! Read some data (asynchronous)
+    /*!
+        \param buffer - Buffer to read
+        \param handler - Handler with the signature void(std::error_code, size_t)
+    */
+    template <typename THandler>
+    void async_read_some(const asio::mutable_buffer& buffer, THandler&& handler);
+    //! Write some data (asynchronous)
+    /*!
+        \param buffer - Buffer to write
+        \param handler - Handler with the signature void(std::error_code, size_t)
+    */
+    template <typename THandler>
+    void async_write_some(const asio::const_buffer& buffer, THandler&& handler);
+    //! Send the SSL close notify alert (asynchronous)
+    /*!
+        \param handler - Handler with the signature void(std::error_code)
+    */
+    template <typename THandler>
+    void async_shutdown(THandler&& handler);
+
+private:
+    asio::ssl::stream<asio::ip::tcp::socket>& _stream;
+    bool _attached;
+
+    // SSL operation result
+    enum class Result { Done, WantRead, WantWrite };
+
+    //! Perform the single SSL operation on the non-blocking socket
+    template <typename TOperation>
+    Result Perform(TOperation& operation, size_t& size, asio::error_code& ec);
+    //! Perform the SSL operation waiting for the socket readiness (synchronous)
+    template <typename TOperation>
+    size_t Run(TOperation operation, asio::error_code& ec);
+    //! Perform the SSL operation waiting for the socket readiness (asynchronous)
+    template <typename TOperation, typename THandler>
+    void AsyncRun(TOperation operation, THandler handler, bool continuation);
+
+    //! Wait for the non-blocking socket readiness (synchronous)
+    void Wait(bool read, asio::error_code& ec);
+
+    //! Convert the OpenSSL error into the error code
+    static asio::error_code MakeError(SSL* ssl, int result, int error);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "ssl_ktls.inl"
+
+#endif // CPPSERVER_ASIO_SSL_KTLS_H
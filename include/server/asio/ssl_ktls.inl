@@ -0,0 +1,191 @@
+/*!
+    \file ssl_ktls.inl
+    \brief SSL kernel TLS stream inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppServer {
+namespace Asio {
+
+template <typename TOperation>
+inline SSLKernelStream::Result SSLKernelStream::Perform(TOperation& operation, size_t& size, asio::error_code& ec)
+{
+    SSL* ssl = _stream.native_handle();
+
+    size = 0;
+    ec.clear();
+
+    ERR_clear_error();
+    errno = 0;
+
+    int result = operation(ssl, size);
+    if (result > 0)
+        return Result::Done;
+
+    int error = SSL_get_error(ssl, result);
+    if (error == SSL_ERROR_WANT_READ)
+        return Result::WantRead;
+    if (error == SSL_ERROR_WANT_WRITE)
+        return Result::WantWrite;
+
+    ec = MakeError(ssl, result, error);
+    return Result::Done;
+}
+
+template <typename TOperation>
+inline size_t SSLKernelStream::Run(TOperation operation, asio::error_code& ec)
+{
+    for (;;)
+    {
+        size_t size;
+        Result result = Perform(operation, size, ec);
+        if (result == Result::Done)
+            return size;
+
+        // Wait for the socket readiness
+        Wait(result == Result::WantRead, ec);
+        if (ec)
+            return 0;
+    }
+}
+
+template <typename TOperation, typename THandler>
+inline void SSLKernelStream::AsyncRun(TOperation operation, THandler handler, bool continuation)
+{
+    auto executor = asio::get_associated_executor(handler, _stream.get_executor());
+
+    size_t size;
+    asio::error_code ec;
+    Result result = Perform(operation, size, ec);
+    if (result == Result::Done)
+    {
+        // Never call the handler from the initiating function
+        if (continuation)
+            handler(ec, size);
+        else
+            asio::post(executor, [handler = std::move(handler), ec, size]() mutable { handler(ec, size); });
+        return;
+    }
+
+    // Async wait for the socket readiness and repeat the operation
+    auto async_wait_handler = [this, operation, handler = std::move(handler)](std::error_code ec) mutable
+    {
+        if (ec)
+            handler(ec, 0);
+        else
+            AsyncRun(std::move(operation), std::move(handler), true);
+    };
+    _stream.lowest_layer().async_wait((result == Result::WantRead) ? asio::socket_base::wait_read : asio::socket_base::wait_write, asio::bind_executor(executor, std::move(async_wait_handler)));
+}
+
+template <typename THandler>
+inline void SSLKernelStream::async_handshake(asio::ssl::stream_base::handshake_type type, THandler&& handler)
+{
+    auto executor = asio::get_associated_executor(handler, _stream.get_executor());
+    auto operation = [type](SSL* ssl, size_t& size) { return (type == asio::ssl::stream_base::client) ? SSL_connect(ssl) : SSL_accept(ssl); };
+    auto async_handshake_handler = [handler = std::forward<THandler>(handler)](std::error_code ec, size_t size) mutable { handler(ec); };
+    AsyncRun(operation, asio::bind_executor(executor, std::move(async_handshake_handler)), false);
+}
+
+template <typename THandler>
+inline void SSLKernelStream::async_handshake(asio::ssl::stream_base::handshake_type type, std::vector<uint8_t>& early_data, THandler&& handler)
+{
+    auto executor = asio::get_associated_executor(handler, _stream.get_executor());
+
+    // Early data functions require the known side of the connection
+    if (SSL_in_before(_stream.native_handle()))
+    {
+        if (type == asio::ssl::stream_base::client)
+            SSL_set_connect_state(_stream.native_handle());
+        else
+            SSL_set_accept_state(_stream.native_handle());
+    }
+
+    auto operation = [type, buffer = &early_data, offset = (size_t)0, finished = false](SSL* ssl, size_t& size) mutable
+    {
+        // Exchange early data before the handshake
+        while (!finished)
+        {
+            if (type == asio::ssl::stream_base::client)
+            {
+                if (offset == buffer->size())
+                {
+                    finished = true;
+                    break;
+                }
+
+                // Send 0-RTT data with the resumed session
+                size_t written = 0;
+                if (SSL_write_early_data(ssl, buffer->data() + offset, buffer->size() - offset, &written) != 1)
+                    return 0;
+                offset += written;
+            }
+            else
+            {
+                // Receive 0-RTT data of the client
+                size_t received = buffer->size();
+                size_t read = 0;
+                buffer->resize(received + SSL3_RT_MAX_PLAIN_LENGTH);
+                int result = SSL_read_early_data(ssl, buffer->data() + received, SSL3_RT_MAX_PLAIN_LENGTH, &read);
+                buffer->resize(received + read);
+                if (result == SSL_READ_EARLY_DATA_ERROR)
+                    return 0;
+                if (result == SSL_READ_EARLY_DATA_FINISH)
+                    finished = true;
+                else if (!buffer->empty())
+                    return 1;
+            }
+        }
+
+        return (type == asio::ssl::stream_base::client) ? SSL_connect(ssl) : SSL_accept(ssl);
+    };
+    auto async_handshake_handler = [handler = std::forward<THandler>(handler)](std::error_code ec, size_t size) mutable { handler(ec); };
+    AsyncRun(operation, asio::bind_executor(executor, std::move(async_handshake_handler)), false);
+}
+
+template <typename THandler>
+inline void SSLKernelStream::async_write_early(const asio::const_buffer& buffer, THandler&& handler)
+{
+    auto operation = [buffer, offset = (size_t)0](SSL* ssl, size_t& size) mutable
+    {
+        while (offset < buffer.size())
+        {
+            size_t written = 0;
+            if (SSL_write_early_data(ssl, (const uint8_t*)buffer.data() + offset, buffer.size() - offset, &written) != 1)
+                return 0;
+            offset += written;
+        }
+        size = offset;
+        return 1;
+    };
+    AsyncRun(operation, std::forward<THandler>(handler), false);
+}
+
+template <typename THandler>
+inline void SSLKernelStream::async_read_some(const asio::mutable_buffer& buffer, THandler&& handler)
+{
+    auto operation = [buffer](SSL* ssl, size_t& size) { return SSL_read_ex(ssl, buffer.data(), buffer.size(), &size); };
+    AsyncRun(operation, std::forward<THandler>(handler), false);
+}
+
+template <typename THandler>
+inline void SSLKernelStream::async_write_some(const asio::const_buffer& buffer, THandler&& handler)
+{
+    auto operation = [buffer](SSL* ssl, size_t& size) { return SSL_write_ex(ssl, buffer.data(), buffer.size(), &size); };
+    AsyncRun(operation, std::forward<THandler>(handler), false);
+}
+
+template <typename THandler>
+inline void SSLKernelStream::async_shutdown(THandler&& handler)
+{
+    auto executor = asio::get_associated_executor(handler, _stream.get_executor());
+    // Do not wait for the close notify alert of the peer
+    auto operation = [](SSL* ssl, size_t& size) { int result = SSL_shutdown(ssl); return (result == 0) ? 1 : result; };
+    auto async_shutdown_handler = [handler = std::forward<THandler>(handler)](std::error_code ec, size_t size) mutable { handler(ec); };
+    AsyncRun(operation, asio::bind_executor(executor, std::move(async_shutdown_handler)), false);
+}
+
+} // namespace Asio
+} // namespace CppServer
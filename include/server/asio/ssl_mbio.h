@@ -0,0 +1,218 @@
+/*!
+    \file ssl_mbio.h
+    \brief SSL memory BIO stream definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_SSL_MBIO_H
+#define CPPSERVER_ASIO_SSL_MBIO_H
+
+#include "asio.h"
+#include "memory.h"
+
+#include <functional>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! SSL memory BIO stream
+/*!
+    SSL memory BIO stream replaces the BIO pair of the SSL stream with the
+    memory BIO over its own pooled buffers. Asio SSL stream copies data
+    through the BIO pair and its internal buffers and performs one socket
+    operation per TLS record.
+
+    The memory BIO stream reads the socket into the large input buffer, so
+    OpenSSL decrypts multiple TLS records of one socket read and a single
+    read operation returns all decrypted data which fits into the given
+    buffer. TLS records encrypted by write operations are appended into
+    pooled output chunks and flushed with one gather write (writev).
+
+    All asynchronous operations invoke the handler with its associated
+    executor. Synchronous operations block on the socket.
+
+    Not thread-safe.
+*/
+class SSLMemoryStream
+{
+public:
+    //! Size of the input buffer for the single socket read
+    static constexpr size_t INPUT_SIZE = 65536;
+    //! Size of the pooled output chunk
+    static constexpr size_t OUTPUT_SIZE = 65536;
+    //! Maximal size of data encrypted by the single write operation
+    static constexpr size_t WRITE_LIMIT = 65536;
+
+    //! Initialize memory BIO stream with the given SSL stream and buffer pool
+    /*!
+        \param stream - SSL stream
+        \param pool - Buffer pool
+    */
+    SSLMemoryStream(asio::ssl::stream<asio::ip::tcp::socket>& stream, BufferPool& pool);
+    SSLMemoryStream(const SSLMemoryStream&) = delete;
+    SSLMemoryStream(SSLMemoryStream&&) = delete;
+    ~SSLMemoryStream();
+
+    SSLMemoryStream& operator=(const SSLMemoryStream&) = delete;
+    SSLMemoryStream& operator=(SSLMemoryStream&&) = delete;
+
+    //! Get the number of socket reads
+    uint64_t socket_reads() const noexcept { return _socket_reads; }
+    //! Get the number of socket writes
+    uint64_t socket_writes() const noexcept { return _socket_writes; }
+
+    //! Is the stream attached to the SSL stream?
+    bool IsAttached() const noexcept { return _attached; }
+
+    //! Attach the memory BIO to the SSL stream before the handshake
+    /*!
+        \return 'true' if the memory BIO was successfully attached, 'false' if failed to create the memory BIO
+    */
+    bool Attach();
+    //! Release the consumed input buffer into the buffer pool
+    /*!
+        The input buffer is reacquired by the next socket read.
+
+        \return 'true' if the input buffer was released, 'false' if it keeps unprocessed data or the socket read is in progress
+    */
+    bool Release();
+
+    //! Perform the SSL handshake (synchronous)
+    /*!
+        \param type - Handshake type
+        \param ec - Error code
+    */
+    void handshake(asio::ssl::stream_base::handshake_type type, asio::error_code& ec);
+    //! Read some data (synchronous)
+    /*!
+        \param buffer - Buffer to read
+        \param ec - Error code
+        \return Size of read data
+    */
+    size_t read_some(const asio::mutable_buffer& buffer, asio::error_code& ec);
+    //! Write the whole buffer (synchronous)
+    /*!
+        \param buffer - Buffer to write
+        \param ec - Error code
+        \return Size of written data
+    */
+    size_t write(const asio::const_buffer& buffer, asio::error_code& ec);
+
+    //! Perform the SSL handshake (asynchronous)
+    /*!
+        \param type - Handshake type
+        \param handler - Handler with the signature void(std::error_code)
+    */
+    template <typename THandler>
+    void async_handshake(asio::ssl::stream_base::handshake_type type, THandler&& handler);
+    //! Read some data (asynchronous)
+    /*!
+        \param buffer - Buffer to read
+        \param handler - Handler with the signature void(std::error_code, size_t)
+    */
+    template <typename THandler>
+    void async_read_some(const asio::mutable_buffer& buffer, THandler&& handler);
+    //! Write some data (asynchronous)
+    /*!
+        Encrypts up to WRITE_LIMIT bytes of the buffer and calls the handler
+        when all encrypted TLS records are flushed into the socket.
+
+        \param buffer - Buffer to write
+        \param handler - Handler with the signature void(std::error_code, size_t)
+    */
+    template <typename THandler>
+    void async_write_some(const asio::const_buffer& buffer, THandler&& handler);
+    //! Send the SSL close notify alert (asynchronous)
+    /*!
+        \param handler - Handler with the signature void(std::error_code)
+    */
+    template <typename THandler>
+    void async_shutdown(THandler&& handler);
+
+private:
+    asio::ssl::stream<asio::ip::tcp::socket>& _stream;
+    BufferPool& _pool;
+    bool _attached;
+    BIO* _bio;
+    // Stream statistic
+    uint64_t _socket_reads;
+    uint64_t _socket_writes;
+    // Input buffer
+    std::vector<uint8_t> _input;
+    size_t _input_size;
+    size_t _input_offset;
+    bool _filling;
+    std::vector<std::function<void(const asio::error_code&)>> _fill_handlers;
+    // Output chunks
+    std::vector<std::vector<uint8_t>> _output;
+    std::vector<std::vector<uint8_t>> _flushing;
+    std::vector<asio::const_buffer> _flushing_buffers;
+    bool _flushing_active;
+    std::vector<std::function<void(const asio::error_code&)>> _flush_handlers;
+    std::vector<std::function<void(const asio::error_code&)>> _flush_pending;
+
+    // SSL operation result
+    enum class Result { Done, WantRead };
+
+    //! Perform the single SSL operation over the memory BIO
+    template <typename TOperation>
+    Result Perform(TOperation& operation, size_t& size, asio::error_code& ec);
+    //! Perform the SSL operation with socket reads and writes (synchronous)
+    template <typename TOperation>
+    size_t Run(TOperation operation, asio::error_code& ec);
+    //! Perform the SSL operation with socket reads and writes (asynchronous)
+    template <typename TOperation, typename THandler>
+    void AsyncRun(TOperation operation, THandler handler, bool continuation);
+
+    //! Read the socket into the input buffer (synchronous)
+    void Fill(asio::error_code& ec);
+    //! Read the socket into the input buffer (asynchronous)
+    template <typename TExecutor>
+    void AsyncFill(const TExecutor& executor, std::function<void(const asio::error_code&)> handler);
+    //! Write output chunks into the socket (synchronous)
+    void Flush(asio::error_code& ec);
+    //! Write output chunks into the socket (asynchronous)
+    template <typename TExecutor>
+    void AsyncFlush(const TExecutor& executor, std::function<void(const asio::error_code&)> handler);
+    //! Write the rest of flushing output chunks with one gather write
+    template <typename TExecutor>
+    void AsyncFlushNext(const TExecutor& executor);
+
+    //! Prepare the input buffer for the next socket read
+    void PrepareFill();
+    //! Move output chunks into flushing ones
+    void PrepareFlush();
+    //! Skip written data of flushing output chunks
+    /*!
+        \return 'true' if all flushing output chunks were written, 'false' otherwise
+    */
+    bool ConsumeFlush(size_t size);
+    //! Release flushing output chunks into the buffer pool
+    void ReleaseFlush();
+    //! Append encrypted data into output chunks
+    void Append(const uint8_t* data, size_t size);
+
+    //! Map the socket read error like Asio SSL stream does
+    asio::error_code MapError(const asio::error_code& ec) const;
+    //! Convert the OpenSSL error into the error code
+    static asio::error_code MakeError(SSL* ssl, int result, int error);
+
+    //! Memory BIO method
+    static BIO_METHOD* Method();
+    //! Memory BIO write callback
+    static int BioWrite(BIO* bio, const char* data, int size);
+    //! Memory BIO read callback
+    static int BioRead(BIO* bio, char* data, int size);
+    //! Memory BIO control callback
+    static long BioCtrl(BIO* bio, int cmd, long num, void* ptr);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#include "ssl_mbio.inl"
+
+#endif // CPPSERVER_ASIO_SSL_MBIO_H
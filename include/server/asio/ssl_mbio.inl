@@ -0,0 +1,265 @@
+/*!
+    \file ssl_mbio.inl
+    \brief SSL memory BIO stream inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppServer {
+namespace Asio {
+
+template <typename TOperation>
+inline SSLMemoryStream::Result SSLMemoryStream::Perform(TOperation& operation, size_t& size, asio::error_code& ec)
+{
+    SSL* ssl = _stream.native_handle();
+
+    size = 0;
+    ec.clear();
+
+    ERR_clear_error();
+
+    int result = operation(ssl, size);
+    if (result > 0)
+        return Result::Done;
+
+    // The memory BIO never blocks writes, so only reads could be retried
+    int error = SSL_get_error(ssl, result);
+    if (error == SSL_ERROR_WANT_READ)
+        return Result::WantRead;
+
+    ec = MakeError(ssl, result, error);
+    return Result::Done;
+}
+
+template <typename TOperation>
+inline size_t SSLMemoryStream::Run(TOperation operation, asio::error_code& ec)
+{
+    for (;;)
+    {
+        size_t size;
+        Result result = Perform(operation, size, ec);
+
+        // Flush TLS records produced by the operation
+        if (!_output.empty())
+        {
+            asio::error_code flush_ec;
+            Flush(flush_ec);
+            if (flush_ec)
+            {
+                ec = flush_ec;
+                return 0;
+            }
+        }
+
+        if (result == Result::Done)
+            return size;
+
+        // Read the socket into the input buffer
+        Fill(ec);
+        if (ec)
+            return 0;
+    }
+}
+
+template <typename TOperation, typename THandler>
+inline void SSLMemoryStream::AsyncRun(TOperation operation, THandler handler, bool continuation)
+{
+    auto executor = asio::get_associated_executor(handler, _stream.get_executor());
+
+    size_t size;
+    asio::error_code ec;
+    Result result = Perform(operation, size, ec);
+
+    // Flush TLS records produced by the operation before its completion or the next socket read
+    if (!_output.empty())
+    {
+        auto async_flush_handler = [this, executor, operation, handler, result, size, ec](const asio::error_code& flush_ec) mutable
+        {
+            if (flush_ec)
+                handler(flush_ec, 0);
+            else if (result == Result::Done)
+                handler(ec, size);
+            else
+                AsyncFill(executor, [this, operation, handler](const asio::error_code& ec) mutable
+                {
+                    if (ec)
+                        handler(ec, 0);
+                    else
+                        AsyncRun(std::move(operation), std::move(handler), true);
+                });
+        };
+        AsyncFlush(executor, std::move(async_flush_handler));
+        return;
+    }
+
+    if (result == Result::Done)
+    {
+        // Never call the handler from the initiating function
+        if (continuation)
+            handler(ec, size);
+        else
+            asio::post(executor, [handler = std::move(handler), ec, size]() mutable { handler(ec, size); });
+        return;
+    }
+
+    // Read the socket into the input buffer and repeat the operation
+    auto async_fill_handler = [this, operation, handler](const asio::error_code& ec) mutable
+    {
+        if (ec)
+            handler(ec, 0);
+        else
+            AsyncRun(std::move(operation), std::move(handler), true);
+    };
+    AsyncFill(executor, std::move(async_fill_handler));
+}
+
+template <typename TExecutor>
+inline void SSLMemoryStream::AsyncFill(const TExecutor& executor, std::function<void(const asio::error_code&)> handler)
+{
+    // Wait for the socket read in progress
+    _fill_handlers.emplace_back(std::move(handler));
+    if (_filling)
+        return;
+
+    _filling = true;
+    PrepareFill();
+
+    auto async_read_handler = [this](std::error_code ec, size_t size)
+    {
+        ++_socket_reads;
+        _input_size += size;
+        _filling = false;
+
+        // Call all handlers waiting for the socket read
+        std::vector<std::function<void(const asio::error_code&)>> handlers;
+        handlers.swap(_fill_handlers);
+        asio::error_code result = ec ? MapError(ec) : asio::error_code();
+        for (auto& handler : handlers)
+            handler(result);
+    };
+    _stream.next_layer().async_read_some(asio::buffer(_input.data() + _input_size, _input.size() - _input_size), asio::bind_executor(executor, std::move(async_read_handler)));
+}
+
+template <typename TExecutor>
+inline void SSLMemoryStream::AsyncFlush(const TExecutor& executor, std::function<void(const asio::error_code&)> handler)
+{
+    // Output chunks appended during the flush in progress will be flushed by the next one
+    if (_flushing_active)
+    {
+        _flush_pending.emplace_back(std::move(handler));
+        return;
+    }
+
+    _flush_handlers.emplace_back(std::move(handler));
+    _flushing_active = true;
+    PrepareFlush();
+    AsyncFlushNext(executor);
+}
+
+template <typename TExecutor>
+inline void SSLMemoryStream::AsyncFlushNext(const TExecutor& executor)
+{
+    auto async_write_handler = [this, executor](std::error_code ec, size_t size)
+    {
+        ++_socket_writes;
+
+        // Continue the partial gather write
+        if (!ec && !ConsumeFlush(size))
+        {
+            AsyncFlushNext(executor);
+            return;
+        }
+
+        ReleaseFlush();
+
+        std::vector<std::function<void(const asio::error_code&)>> handlers;
+        handlers.swap(_flush_handlers);
+
+        // Start the next flush of output chunks appended during the current one
+        if (!_flush_pending.empty())
+        {
+            if (ec)
+            {
+                // Fail all pending flushes of the broken connection
+                for (auto& handler : _flush_pending)
+                    handlers.emplace_back(std::move(handler));
+                _flush_pending.clear();
+                PrepareFlush();
+                ReleaseFlush();
+                _flushing_active = false;
+            }
+            else
+            {
+                _flush_handlers.swap(_flush_pending);
+                PrepareFlush();
+                AsyncFlushNext(executor);
+            }
+        }
+        else
+            _flushing_active = false;
+
+        for (auto& handler : handlers)
+            handler(ec);
+    };
+    _stream.next_layer().async_write_some(_flushing_buffers, asio::bind_executor(executor, std::move(async_write_handler)));
+}
+
+template <typename THandler>
+inline void SSLMemoryStream::async_handshake(asio::ssl::stream_base::handshake_type type, THandler&& handler)
+{
+    auto executor = asio::get_associated_executor(handler, _stream.get_executor());
+    auto operation = [type](SSL* ssl, size_t& size) { return (type == asio::ssl::stream_base::client) ? SSL_connect(ssl) : SSL_accept(ssl); };
+    auto async_handshake_handler = [handler = std::forward<THandler>(handler)](std::error_code ec, size_t size) mutable { handler(ec); };
+    AsyncRun(operation, asio::bind_executor(executor, std::move(async_handshake_handler)), false);
+}
+
+template <typename THandler>
+inline void SSLMemoryStream::async_read_some(const asio::mutable_buffer& buffer, THandler&& handler)
+{
+    auto operation = [buffer](SSL* ssl, size_t& size)
+    {
+        // Decrypt all received TLS records which fit into the buffer
+        while (size < buffer.size())
+        {
+            size_t read = 0;
+            if (SSL_read_ex(ssl, (uint8_t*)buffer.data() + size, buffer.size() - size, &read) != 1)
+                return (size > 0) ? 1 : 0;
+            size += read;
+        }
+        return 1;
+    };
+    AsyncRun(operation, std::forward<THandler>(handler), false);
+}
+
+template <typename THandler>
+inline void SSLMemoryStream::async_write_some(const asio::const_buffer& buffer, THandler&& handler)
+{
+    auto operation = [buffer](SSL* ssl, size_t& size)
+    {
+        // Encrypt TLS records of the buffer into output chunks
+        size_t limit = std::min(buffer.size(), WRITE_LIMIT);
+        while (size < limit)
+        {
+            size_t written = 0;
+            if (SSL_write_ex(ssl, (const uint8_t*)buffer.data() + size, limit - size, &written) != 1)
+                return (size > 0) ? 1 : 0;
+            size += written;
+        }
+        return 1;
+    };
+    AsyncRun(operation, std::forward<THandler>(handler), false);
+}
+
+template <typename THandler>
+inline void SSLMemoryStream::async_shutdown(THandler&& handler)
+{
+    auto executor = asio::get_associated_executor(handler, _stream.get_executor());
+    // Do not wait for the close notify alert of the peer
+    auto operation = [](SSL* ssl, size_t& size) { int result = SSL_shutdown(ssl); return (result == 0) ? 1 : result; };
+    auto async_shutdown_handler = [handler = std::forward<THandler>(handler)](std::error_code ec, size_t size) mutable { handler(ec); };
+    AsyncRun(operation, asio::bind_executor(executor, std::move(async_shutdown_handler)), false);
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -10,6 +10,7 @@
 #define CPPSERVER_ASIO_SSL_SERVER_H
 
 #include "ssl_context.h"
+#include "admission.h"
 #include "ssl_session.h"
 
 #include "system/uuid.h"
@@ -17,6 +18,7 @@
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace CppServer {
@@ -78,6 +80,10 @@ public:
     asio::ip::tcp::endpoint& endpoint() noexcept { return _endpoint; }
     //! Get the server acceptor
     asio::ip::tcp::acceptor& acceptor() noexcept { return _acceptor; }
+    //! Get the server admission control
+    AdmissionControl& admission() noexcept { return _admission; }
+    //! Get the buffer pool of idle sessions
+    BufferPool& buffer_pool() noexcept { return _buffer_pool; }
 
     //! Get the server address
     const std::string& address() const noexcept { return _address; }
@@ -92,6 +98,42 @@ public:
     uint64_t bytes_sent() const noexcept { return _bytes_sent; }
     //! Get the number of bytes received by the server
     uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number of connections accepted by the server
+    uint64_t connections_accepted() const noexcept { return _connections_accepted; }
+    //! Get the number of failed server accepts
+    uint64_t accept_errors() const noexcept { return _accept_errors; }
+    //! Get the number of accepts that found the listen backlog overflowed (Linux only, zero if TCP_INFO of the listening socket is not available)
+    uint64_t backlog_overflows() const noexcept { return _backlog_overflows; }
+    //! Get the number of full SSL handshakes
+    uint64_t handshakes_full() const noexcept { return _handshakes_full; }
+    //! Get the number of abbreviated SSL handshakes with the resumed session
+    uint64_t handshakes_resumed() const noexcept { return _handshakes_resumed; }
+    //! Get the number of SSL handshakes in progress
+    uint64_t handshakes_pending() const noexcept { return _handshakes_pending; }
+    //! Get the total latency of successful SSL handshakes in nanoseconds
+    uint64_t handshake_latency_total() const noexcept { return _handshake_latency_total; }
+    //! Get the maximal latency of successful SSL handshakes in nanoseconds
+    uint64_t handshake_latency_max() const noexcept { return _handshake_latency_max; }
+    //! Get the total time SSL handshakes were queued in the handshake service in nanoseconds
+    uint64_t handshake_queue_total() const noexcept { return _handshake_queue_total; }
+    //! Get the maximal time SSL handshakes were queued in the handshake service in nanoseconds
+    uint64_t handshake_queue_max() const noexcept { return _handshake_queue_max; }
+    //! Get the number of TLS records sent by sessions (dynamic records option)
+    uint64_t records_sent() const noexcept { return _records_sent; }
+    //! Get the number of TLS records filled up to the session record size limit (dynamic records option)
+    uint64_t records_full() const noexcept { return _records_full; }
+    //! Get the number of times small pending writes were coalesced into the sending TLS record (dynamic records option)
+    uint64_t records_coalesced() const noexcept { return _records_coalesced; }
+    //! Get the number of idle sessions with released buffers
+    uint64_t sessions_idle() const noexcept { return _sessions_idle; }
+    //! Get the number of resumed SSL handshakes with accepted TLS 1.3 early data
+    uint64_t early_data_accepted() const noexcept { return _early_data_accepted; }
+    //! Get the number of resumed SSL handshakes with rejected TLS 1.3 early data
+    uint64_t early_data_rejected() const noexcept { return _early_data_rejected; }
+    //! Get the number of socket reads of disconnected sessions (memory BIO option)
+    uint64_t socket_reads() const noexcept { return _socket_reads; }
+    //! Get the number of socket writes of disconnected sessions (memory BIO option)
+    uint64_t socket_writes() const noexcept { return _socket_writes; }
 
     //! Get the option: keep alive
     bool option_keep_alive() const noexcept { return _option_keep_alive; }
@@ -101,6 +143,22 @@ public:
     bool option_reuse_address() const noexcept { return _option_reuse_address; }
     //! Get the option: reuse port
     bool option_reuse_port() const noexcept { return _option_reuse_port; }
+    //! Get the option: multiple acceptors
+    bool option_multiple_acceptors() const noexcept { return _option_multiple_acceptors; }
+    //! Get the option: accept concurrency
+    size_t option_accept_concurrency() const noexcept { return _option_accept_concurrency; }
+    //! Get the option: kernel TLS
+    bool option_kernel_tls() const noexcept { return _option_kernel_tls; }
+    //! Get the option: dynamic records
+    bool option_dynamic_records() const noexcept { return _option_dynamic_records; }
+    //! Get the option: memory BIO
+    bool option_memory_bio() const noexcept { return _option_memory_bio; }
+    //! Get the option: idle release interval
+    const CppCommon::Timespan& option_idle_release() const noexcept { return _option_idle_release; }
+    //! Get the option: handshake service
+    const std::shared_ptr<Service>& option_handshake_service() const noexcept { return _option_handshake_service; }
+    //! Get the option: early data size
+    size_t option_early_data() const noexcept { return _option_early_data; }
 
     //! Is the server started?
     bool IsStarted() const noexcept { return _started; }
@@ -123,6 +181,14 @@ public:
 
     //! Multicast data to all connected sessions
     /*!
+        Sessions are grouped by their Asio IO service and the multicast
+        fan-out is performed in parallel: one task per group is posted to
+        the corresponding IO service, so in the io-service-per-thread design
+        each working thread touches only its own sessions. In the thread pool
+        design sessions are split into one group per working thread in
+        round-robin and groups are processed in parallel by any pool thread,
+        so a group has no thread affinity.
+
         \param buffer - Buffer to multicast
         \param size - Buffer size
         \return 'true' if the data was successfully multicast, 'false' if the server is not started
@@ -135,6 +201,45 @@ public:
     */
     virtual bool Multicast(const std::string_view& text) { return Multicast(text.data(), text.size()); }
 
+    //! Multicast the latest value of the given key to all connected sessions (conflated)
+    /*!
+        Each session keeps at most one pending value per key, so lagging
+        sessions receive only the newest value instead of every update.
+
+        \param key - Conflation key
+        \param buffer - Buffer to multicast
+        \param size - Buffer size
+        \return 'true' if the data was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool MulticastConflated(const std::string& key, const void* buffer, size_t size);
+    //! Multicast the latest text of the given key to all connected sessions (conflated)
+    /*!
+        \param key - Conflation key
+        \param text - Text to multicast
+        \return 'true' if the text was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool MulticastConflated(const std::string& key, const std::string_view& text) { return MulticastConflated(key, text.data(), text.size()); }
+
+    //! Publish data to all sessions subscribed to the given topic
+    /*!
+        Topic subscribers are kept in arrays per session group, so the publish
+        fan-out is performed in parallel only for groups with subscribers
+        (see 'Multicast()' for session groups of the thread pool design).
+
+        \param topic - Topic to publish
+        \param buffer - Buffer to publish
+        \param size - Buffer size
+        \return 'true' if the data was successfully published, 'false' if the server is not started
+    */
+    virtual bool Publish(const std::string& topic, const void* buffer, size_t size);
+    //! Publish text to all sessions subscribed to the given topic
+    /*!
+        \param topic - Topic to publish
+        \param text - Text to publish
+        \return 'true' if the text was successfully published, 'false' if the server is not started
+    */
+    virtual bool Publish(const std::string& topic, const std::string_view& text) { return Publish(topic, text.data(), text.size()); }
+
     //! Disconnect all connected sessions
     /*!
         \return 'true' if all sessions were successfully disconnected, 'false' if the server is not started
@@ -178,6 +283,106 @@ public:
         \param enable - Enable/disable option
     */
     void SetupReusePort(bool enable) noexcept { _option_reuse_port = enable; }
+    //! Setup option: multiple acceptors
+    /*!
+        This option will open one acceptor with SO_REUSEPORT per Asio IO service
+        (or per working thread for the thread-pool design), so the OS kernel will
+        balance new connections between them. Each accepted session stays on the
+        Asio IO service of its acceptor.
+
+        The option is supported only on Unix systems, otherwise the single acceptor
+        will be used.
+
+        \param enable - Enable/disable option
+    */
+    void SetupMultipleAcceptors(bool enable) noexcept { _option_multiple_acceptors = enable; }
+    //! Setup option: accept concurrency
+    /*!
+        This option will setup the count of concurrent accept operations
+        outstanding on each server acceptor (default is 1). More concurrent
+        accepts help to drain the listen backlog faster during reconnect storms,
+        because each accepted session connects independently from others.
+
+        \param count - Accept operations count per acceptor
+    */
+    void SetupAcceptConcurrency(size_t count) noexcept { _option_accept_concurrency = std::max(count, (size_t)1); }
+    //! Setup option: kernel TLS
+    /*!
+        This option will attach OpenSSL of each session directly to its socket
+        and offload encryption of application data to the OS kernel (kTLS)
+        after the handshake. Sessions keep the default Asio SSL stream if the
+        OS kernel does not support kTLS.
+
+        \param enable - Enable/disable option
+    */
+    void SetupKernelTLS(bool enable) noexcept { _option_kernel_tls = enable; }
+    //! Setup option: dynamic records
+    /*!
+        This option will limit the size of TLS records sent by sessions. New
+        and idle sessions send small records which fit into a single TCP
+        segment, so the client could decrypt the first bytes of the response
+        without waiting for the whole 16KB record. The record size is doubled
+        after a number of records up to 16KB for bulk transfers. Small pending
+        writes are coalesced into the sending record.
+
+        \param enable - Enable/disable option
+    */
+    void SetupDynamicRecords(bool enable) noexcept { _option_dynamic_records = enable; }
+    //! Setup option: memory BIO
+    /*!
+        This option will replace Asio BIO pair of each session with the memory
+        BIO over buffers of the server buffer pool. Sessions read the socket
+        into the large input buffer and decrypt all received TLS records at
+        once, TLS records of the send buffer are flushed with one gather write
+        instead of one socket write per record. Sessions with kernel TLS or
+        early data keep OpenSSL on the socket.
+
+        \param enable - Enable/disable option
+    */
+    void SetupMemoryBIO(bool enable) noexcept { _option_memory_bio = enable; }
+    //! Setup option: idle release interval
+    /*!
+        This option will release memory of sessions without any activity
+        during the given interval. Idle sessions return their receive and
+        send buffers into the server buffer pool and wait for the new data
+        with a small receive buffer. Buffers are reacquired from the pool as
+        soon as the session receives or sends something.
+
+        \param interval - Idle interval (zero - disable the option)
+    */
+    void SetupIdleRelease(const CppCommon::Timespan& interval) noexcept { _option_idle_release = interval; }
+    //! Setup option: handshake service
+    /*!
+        This option will perform SSL handshakes of new sessions on the given
+        Asio service (handshake worker pool), so bursts of new connections do
+        not stall established sessions with the handshake crypto. Handshaked
+        sessions are handed back to their own Asio service.
+
+        The handshake service should be started before the server.
+
+        \param service - Handshake Asio service (nullptr - perform handshakes on the session Asio service)
+    */
+    void SetupHandshakeService(const std::shared_ptr<Service>& service) noexcept { _option_handshake_service = service; }
+    //! Setup option: early data size
+    /*!
+        This option will allow clients to send up to the given size of TLS 1.3
+        early data (0-RTT) with resumed sessions. Sessions receive early data
+        before the handshake is finished and could answer it with 0.5-RTT data
+        from the received data handler, so the first response is available
+        to the client one round trip earlier. Early data could be accepted or
+        rejected with onEarlyData() handler, which is called with handshake
+        service threads if SetupHandshakeService() is used.
+
+        Early data could be replayed by an attacker, so the server allows it
+        only with the session cache of the SSL context, which makes resumed
+        sessions single-use (OpenSSL anti-replay protection), or if the SSL
+        context disables the protection with SSL_OP_NO_ANTI_REPLAY. Sessions
+        with early data use OpenSSL directly on the socket, because Asio SSL
+        stream does not support it.
+
+        \param size - Early data size (0 - disable the option)
+    */
+    void SetupEarlyData(size_t size) noexcept { _option_early_data = size; }
 
 protected:
     //! Create SSL session factory method
@@ -203,11 +408,33 @@ protected:
         \param session - Handshaked session
     */
     virtual void onHandshaked(std::shared_ptr<SSLSession>& session) {}
+    //! Handle session early data notification
+    /*!
+        Notification is called during the resumed handshake when the client
+        offers TLS 1.3 early data. With the handshake service option the
+        handler is called with one of the handshake service threads, not with
+        the session thread, so it must not touch the session state without
+        synchronization. Early data itself is always received by the session
+        thread with onReceived() handler of the session.
+
+        \param session - Handshaking session
+        \return 'true' to accept early data, 'false' to reject it (client will send data again after the handshake)
+    */
+    virtual bool onEarlyData(std::shared_ptr<SSLSession>& session) { return true; }
     //! Handle session disconnected notification
     /*!
         \param session - Disconnected session
     */
     virtual void onDisconnected(std::shared_ptr<SSLSession>& session) {}
+    //! Handle connection rejected notification
+    /*!
+        Notification is called when a new accepted connection was rejected
+        by the server admission control. The connection will be closed right
+        after the notification.
+
+        \param endpoint - Rejected connection endpoint
+    */
+    virtual void onRejected(const asio::ip::tcp::endpoint& endpoint) {}
 
     //! Handle error notification
     /*!
@@ -232,18 +459,79 @@ private:
     int _port;
     // Server SSL context, endpoint, acceptor and socket
     std::shared_ptr<SSLContext> _context;
-    std::shared_ptr<SSLSession> _session;
     asio::ip::tcp::endpoint _endpoint;
     asio::ip::tcp::acceptor _acceptor;
     std::atomic<bool> _started;
-    HandlerStorage _acceptor_storage;
+    // Additional server acceptors (multiple acceptors mode)
+    struct Acceptor
+    {
+        std::shared_ptr<asio::io_service> io_service;
+        asio::io_service::strand strand;
+        asio::ip::tcp::acceptor acceptor;
+
+        explicit Acceptor(std::shared_ptr<asio::io_service> service) : io_service(service), strand(*service), acceptor(*service) {}
+    };
+    std::vector<std::shared_ptr<Acceptor>> _acceptors;
+    // Server accept operations (accept concurrency per acceptor)
+    struct AcceptOperation
+    {
+        std::shared_ptr<asio::io_service> io_service;
+        asio::io_service::strand& strand;
+        asio::ip::tcp::acceptor& acceptor;
+        std::shared_ptr<Acceptor> owner;
+        std::shared_ptr<SSLSession> session;
+        HandlerStorage storage;
+
+        AcceptOperation(std::shared_ptr<asio::io_service> service, asio::io_service::strand& service_strand, asio::ip::tcp::acceptor& service_acceptor, std::shared_ptr<Acceptor> acceptor_owner = nullptr)
+            : io_service(service), strand(service_strand), acceptor(service_acceptor), owner(acceptor_owner)
+        {}
+    };
+    std::vector<std::shared_ptr<AcceptOperation>> _accept_operations;
     // Server statistic
     uint64_t _bytes_pending;
     uint64_t _bytes_sent;
     uint64_t _bytes_received;
+    std::atomic<uint64_t> _connections_accepted;
+    std::atomic<uint64_t> _accept_errors;
+    std::atomic<uint64_t> _backlog_overflows;
+    std::atomic<bool> _backlog_supported;
+    std::atomic<uint64_t> _handshakes_full;
+    std::atomic<uint64_t> _handshakes_resumed;
+    std::atomic<uint64_t> _handshakes_pending;
+    std::atomic<uint64_t> _handshake_latency_total;
+    std::atomic<uint64_t> _handshake_latency_max;
+    std::atomic<uint64_t> _handshake_queue_total;
+    std::atomic<uint64_t> _handshake_queue_max;
+    std::atomic<uint64_t> _records_sent;
+    std::atomic<uint64_t> _records_full;
+    std::atomic<uint64_t> _records_coalesced;
+    std::atomic<uint64_t> _sessions_idle;
+    std::atomic<uint64_t> _early_data_accepted;
+    std::atomic<uint64_t> _early_data_rejected;
+    std::atomic<uint64_t> _socket_reads;
+    std::atomic<uint64_t> _socket_writes;
+    // Server buffer pool of idle sessions
+    BufferPool _buffer_pool;
+    asio::system_timer _idle_timer;
+    // Server admission control
+    AdmissionControl _admission;
+    asio::system_timer _admission_timer;
     // Server sessions
     std::shared_mutex _sessions_lock;
     std::map<CppCommon::UUID, std::shared_ptr<SSLSession>> _sessions;
+    // Server session groups (one group per Asio IO service or working thread)
+    struct SessionGroup
+    {
+        std::shared_ptr<asio::io_service> io_service;
+        asio::io_service::strand strand;
+        std::shared_mutex lock;
+        std::vector<std::shared_ptr<SSLSession>> sessions;
+        std::unordered_map<std::string, std::vector<std::shared_ptr<SSLSession>>> topics;
+
+        explicit SessionGroup(std::shared_ptr<asio::io_service> service) : io_service(service), strand(*service) {}
+    };
+    std::vector<std::shared_ptr<SessionGroup>> _session_groups;
+    size_t _session_groups_index;
     // Multicast buffer
     std::mutex _multicast_lock;
     std::vector<uint8_t> _multicast_buffer;
@@ -253,18 +541,74 @@ private:
     bool _option_no_delay;
     bool _option_reuse_address;
     bool _option_reuse_port;
+    bool _option_multiple_acceptors;
+    size_t _option_accept_concurrency;
+    bool _option_kernel_tls;
+    bool _option_dynamic_records;
+    bool _option_memory_bio;
+    CppCommon::Timespan _option_idle_release;
+    std::shared_ptr<Service> _option_handshake_service;
+    size_t _option_early_data;
+
+    //! Open the given acceptor
+    /*!
+        \param acceptor - Acceptor to open
+    */
+    void OpenAcceptor(asio::ip::tcp::acceptor& acceptor);
+
+    //! Accept new connections with the given accept operation
+    /*!
+        \param operation - Accept operation
+    */
+    void Accept(std::shared_ptr<AcceptOperation> operation);
+    //! Check the listen backlog of the given acceptor for overflow
+    /*!
+        \param acceptor - Acceptor to check
+    */
+    void CheckBacklog(asio::ip::tcp::acceptor& acceptor);
+
+    //! Reject the given session by the admission control
+    /*!
+        \param session - Session to reject
+    */
+    void RejectSession(std::shared_ptr<SSLSession>& session);
+    //! Measure the event-loop queue delay for the adaptive admission control
+    void ProbeQueueDelay();
+    //! Release buffers of idle sessions once per idle release interval
+    void CheckIdleSessions();
 
-    //! Accept new connections
-    void Accept();
+    //! Get the Asio IO service for a new session
+    std::shared_ptr<asio::io_service> GetSessionAsioService();
+
+    //! Initialize session groups
+    void InitSessionGroups();
 
     //! Register a new session
-    void RegisterSession();
+    /*!
+        \param session - Session to register
+    */
+    void RegisterSession(const std::shared_ptr<SSLSession>& session);
     //! Unregister the given session
     /*!
         \param id - Session Id
     */
     void UnregisterSession(const CppCommon::UUID& id);
 
+    //! Subscribe the given session to the given topic
+    /*!
+        \param session - Session to subscribe
+        \param topic - Topic to subscribe
+        \return 'true' if the session was successfully subscribed, 'false' if the session is not registered or already subscribed
+    */
+    bool SubscribeSession(const std::shared_ptr<SSLSession>& session, const std::string& topic);
+    //! Unsubscribe the given session from the given topic
+    /*!
+        \param session - Session to unsubscribe
+        \param topic - Topic to unsubscribe
+        \return 'true' if the session was successfully unsubscribed, 'false' if the session was not subscribed
+    */
+    bool UnsubscribeSession(const std::shared_ptr<SSLSession>& session, const std::string& topic);
+
     //! Clear multicast buffer
     void ClearBuffers();
 
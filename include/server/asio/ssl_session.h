@@ -10,9 +10,13 @@
 #define CPPSERVER_ASIO_SSL_SESSION_H
 
 #include "service.h"
+#include "ssl_ktls.h"
+#include "ssl_mbio.h"
 
 #include "system/uuid.h"
 
+#include <unordered_map>
+
 namespace CppServer {
 namespace Asio {
 
@@ -29,6 +33,15 @@ class SSLSession : public std::enable_shared_from_this<SSLSession>
     friend class SSLServer;
 
 public:
+    //! Initial TLS record size of dynamic records (fits into a single TCP segment)
+    static constexpr size_t MIN_RECORD_SIZE = 1369;
+    //! Maximal TLS record size
+    static constexpr size_t MAX_RECORD_SIZE = 16384;
+    //! Count of TLS records to send before the record size is doubled
+    static constexpr size_t RECORD_RAMP_COUNT = 8;
+    //! Idle time in nanoseconds after which the record size is reset to the initial one
+    static constexpr uint64_t RECORD_IDLE_TIMEOUT = 1000000000;
+
     //! Initialize the session with a given server
     /*!
         \param server - Connected server
@@ -61,6 +74,14 @@ public:
     uint64_t bytes_sent() const noexcept { return _bytes_sent; }
     //! Get the number of bytes received by the session
     uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number of conflated values replaced by newer ones before sending
+    uint64_t values_conflated() const noexcept { return _values_conflated; }
+    //! Get the current TLS record size limit of dynamic records
+    size_t record_size() const noexcept { return _record_size; }
+    //! Get the number of socket reads of the memory BIO
+    uint64_t socket_reads() const noexcept { return _memory.socket_reads(); }
+    //! Get the number of socket writes of the memory BIO
+    uint64_t socket_writes() const noexcept { return _memory.socket_writes(); }
 
     //! Get the option: receive buffer size
     size_t option_receive_buffer_size() const;
@@ -71,6 +92,16 @@ public:
     bool IsConnected() const noexcept { return _connected; }
     //! Is the session handshaked?
     bool IsHandshaked() const noexcept { return _handshaked; }
+    //! Is the session resumed with the abbreviated handshake?
+    bool IsResumed() const noexcept { return _resumed; }
+    //! Is the session idle with released buffers?
+    bool IsIdle() const noexcept { return _idle; }
+    //! Is TLS 1.3 early data of the client accepted?
+    bool IsEarlyDataAccepted() const noexcept { return _early_accepted; }
+    //! Is the send path offloaded to the kernel TLS?
+    bool IsSendOffloaded() const noexcept { return _kernel.IsSendOffloaded(); }
+    //! Is the receive path offloaded to the kernel TLS?
+    bool IsReceiveOffloaded() const noexcept { return _kernel.IsReceiveOffloaded(); }
 
     //! Disconnect the session
     /*!
@@ -108,6 +139,20 @@ public:
     */
     virtual size_t Send(const std::string_view& text, const CppCommon::Timespan& timeout) { return Send(text.data(), text.size(), timeout); }
 
+    //! Send the file content to the client (synchronous)
+    /*!
+        With the offloaded send path the file content is sent with sendfile()
+        and encrypted by the kernel TLS without copies into the user space.
+        Otherwise the file content is read into the memory and sent with the
+        SSL stream.
+
+        \param fd - File descriptor
+        \param offset - File offset
+        \param size - Size of the file content to send
+        \return Size of sent data
+    */
+    virtual size_t SendFile(int fd, int64_t offset, size_t size);
+
     //! Send data to the client (asynchronous)
     /*!
         \param buffer - Buffer to send
@@ -122,6 +167,27 @@ public:
     */
     virtual bool SendAsync(const std::string_view& text) { return SendAsync(text.data(), text.size()); }
 
+    //! Send the latest value of the given key to the client (asynchronous, conflated)
+    /*!
+        The session keeps at most one pending value per key. A newer value
+        replaces the queued one in place, and the newest values are flushed
+        after all sent data is written to the socket. This way slow clients
+        receive fresh data instead of a growing backlog.
+
+        \param key - Conflation key
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \return 'true' if the data was successfully queued, 'false' if the session is not connected
+    */
+    virtual bool SendConflated(const std::string& key, const void* buffer, size_t size);
+    //! Send the latest text of the given key to the client (asynchronous, conflated)
+    /*!
+        \param key - Conflation key
+        \param text - Text to send
+        \return 'true' if the text was successfully queued, 'false' if the session is not connected
+    */
+    virtual bool SendConflated(const std::string& key, const std::string_view& text) { return SendConflated(key, text.data(), text.size()); }
+
     //! Receive data from the client (synchronous)
     /*!
         \param buffer - Buffer to receive
@@ -155,6 +221,19 @@ public:
     //! Receive data from the client (asynchronous)
     virtual void ReceiveAsync();
 
+    //! Subscribe the session to the given topic
+    /*!
+        \param topic - Topic to subscribe
+        \return 'true' if the session was successfully subscribed, 'false' if the session is not registered in the server or already subscribed
+    */
+    bool Subscribe(const std::string& topic);
+    //! Unsubscribe the session from the given topic
+    /*!
+        \param topic - Topic to unsubscribe
+        \return 'true' if the session was successfully unsubscribed, 'false' if the session was not subscribed
+    */
+    bool Unsubscribe(const std::string& topic);
+
     //! Setup option: receive buffer size
     /*!
         This option will setup SO_RCVBUF if the OS support this feature.
@@ -229,8 +308,15 @@ private:
     bool _strand_required;
     // Session stream
     asio::ssl::stream<asio::ip::tcp::socket> _stream;
+    SSLKernelStream _kernel;
+    SSLMemoryStream _memory;
     std::atomic<bool> _connected;
     std::atomic<bool> _handshaked;
+    std::atomic<bool> _resumed;
+    uint64_t _handshake_timestamp;
+    // Handshake offloaded to the handshake service with the deferred disconnect
+    bool _handshake_offloaded;
+    bool _disconnect_deferred;
     // Session statistic
     uint64_t _bytes_pending;
     uint64_t _bytes_sending;
@@ -246,7 +332,33 @@ private:
     std::vector<uint8_t> _send_buffer_main;
     std::vector<uint8_t> _send_buffer_flush;
     size_t _send_buffer_flush_offset;
+    size_t _send_buffer_flush_limit;
     HandlerStorage _send_storage;
+    // Dynamic TLS records
+    size_t _record_size;
+    size_t _record_count;
+    uint64_t _record_timestamp;
+    // Idle mode with released buffers
+    bool _idle;
+    bool _idle_pending;
+    uint64_t _activity_timestamp;
+    uint8_t _idle_buffer[64];
+    // TLS 1.3 early data
+    bool _early_data;
+    std::atomic<bool> _early_accepted;
+    bool _early_receiving;
+    bool _early_received;
+    std::vector<uint8_t> _early_buffer;
+    // Conflated values (one pending value per key)
+    std::unordered_map<std::string, size_t> _conflation_index;
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> _conflation_values;
+    size_t _conflation_size;
+    uint64_t _values_conflated;
+    // Session group in the server
+    size_t _group;
+    size_t _group_index;
+    // Session topics with indexes in topic subscribers of the session group
+    std::unordered_map<std::string, size_t> _topics;
 
     //! Connect the session
     void Connect();
@@ -257,14 +369,29 @@ private:
     */
     bool Disconnect(bool dispatch);
 
+    //! Try to continue the SSL handshake
+    void TryHandshake();
     //! Try to receive new data
     void TryReceive();
     //! Try to send pending data
     void TrySend();
+    //! Try to release buffers of the idle session
+    void TryIdle();
+
+    //! Release buffers and enter the idle mode
+    void EnterIdle();
+    //! Reacquire buffers and leave the idle mode
+    void LeaveIdle();
+
+    //! Receive TLS 1.3 early data and send 0.5-RTT response before the handshake is finished
+    void ReceiveEarlyData();
 
     //! Clear send/receive buffers
     void ClearBuffers();
 
+    //! OpenSSL callback to accept or reject TLS 1.3 early data (called with handshake service threads if the server has the handshake service)
+    static int AllowEarlyData(SSL* ssl, void* arg);
+
     //! Send error notification
     void SendError(std::error_code ec);
 };
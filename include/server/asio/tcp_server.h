@@ -9,6 +9,8 @@
 #ifndef CPPSERVER_ASIO_TCP_SERVER_H
 #define CPPSERVER_ASIO_TCP_SERVER_H
 
+#include "admission.h"
+#include "pacer.h"
 #include "tcp_session.h"
 
 #include "system/uuid.h"
@@ -16,6 +18,7 @@
 #include <map>
 #include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace CppServer {
@@ -72,6 +75,8 @@ public:
     asio::ip::tcp::endpoint& endpoint() noexcept { return _endpoint; }
     //! Get the server acceptor
     asio::ip::tcp::acceptor& acceptor() noexcept { return _acceptor; }
+    //! Get the server admission control
+    AdmissionControl& admission() noexcept { return _admission; }
 
     //! Get the server address
     const std::string& address() const noexcept { return _address; }
@@ -86,6 +91,14 @@ public:
     uint64_t bytes_sent() const noexcept { return _bytes_sent; }
     //! Get the number of bytes received by the server
     uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number of connections accepted by the server
+    uint64_t connections_accepted() const noexcept { return _connections_accepted; }
+    //! Get the number of failed server accepts
+    uint64_t accept_errors() const noexcept { return _accept_errors; }
+    //! Get the number of accepts that found the listen backlog overflowed (Linux only, zero if TCP_INFO of the listening socket is not available)
+    uint64_t backlog_overflows() const noexcept { return _backlog_overflows; }
+    //! Get the multicast pacer with the achieved and target rate statistic (read without synchronization)
+    const Pacer& multicast_pacer() const noexcept { return _multicast_pacer; }
 
     //! Get the option: keep alive
     bool option_keep_alive() const noexcept { return _option_keep_alive; }
@@ -95,6 +108,20 @@ public:
     bool option_reuse_address() const noexcept { return _option_reuse_address; }
     //! Get the option: reuse port
     bool option_reuse_port() const noexcept { return _option_reuse_port; }
+    //! Get the option: multiple acceptors
+    bool option_multiple_acceptors() const noexcept { return _option_multiple_acceptors; }
+    //! Get the option: accept concurrency
+    size_t option_accept_concurrency() const noexcept { return _option_accept_concurrency; }
+    //! Get the option: receive timestamps
+    bool option_receive_timestamps() const noexcept { return _option_receive_timestamps; }
+    //! Get the option: transmit timestamps
+    bool option_transmit_timestamps() const noexcept { return _option_transmit_timestamps; }
+    //! Get the option: multicast pacing rate
+    uint64_t option_multicast_pacing_rate() const noexcept { return _option_multicast_pacing_rate; }
+    //! Get the option: multicast pacing rate unit
+    PacingUnit option_multicast_pacing_unit() const noexcept { return _option_multicast_pacing_unit; }
+    //! Get the option: multicast pacing burst
+    uint64_t option_multicast_pacing_burst() const noexcept { return _option_multicast_pacing_burst; }
 
     //! Is the server started?
     bool IsStarted() const noexcept { return _started; }
@@ -117,6 +144,14 @@ public:
 
     //! Multicast data to all connected sessions
     /*!
+        Sessions are grouped by their Asio IO service and the multicast
+        fan-out is performed in parallel: one task per group is posted to
+        the corresponding IO service, so in the io-service-per-thread design
+        each working thread touches only its own sessions. In the thread pool
+        design sessions are split into one group per working thread in
+        round-robin and groups are processed in parallel by any pool thread,
+        so a group has no thread affinity.
+
         \param buffer - Buffer to multicast
         \param size - Buffer size
         \return 'true' if the data was successfully multicast, 'false' if the server is not started
@@ -129,6 +164,45 @@ public:
     */
     virtual bool Multicast(const std::string_view& text) { return Multicast(text.data(), text.size()); }
 
+    //! Multicast the latest value of the given key to all connected sessions (conflated)
+    /*!
+        Each session keeps at most one pending value per key, so lagging
+        sessions receive only the newest value instead of every update.
+
+        \param key - Conflation key
+        \param buffer - Buffer to multicast
+        \param size - Buffer size
+        \return 'true' if the data was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool MulticastConflated(const std::string& key, const void* buffer, size_t size);
+    //! Multicast the latest text of the given key to all connected sessions (conflated)
+    /*!
+        \param key - Conflation key
+        \param text - Text to multicast
+        \return 'true' if the text was successfully multicast, 'false' if the server is not started
+    */
+    virtual bool MulticastConflated(const std::string& key, const std::string_view& text) { return MulticastConflated(key, text.data(), text.size()); }
+
+    //! Publish data to all sessions subscribed to the given topic
+    /*!
+        Topic subscribers are kept in arrays per session group, so the publish
+        fan-out is performed in parallel only for groups with subscribers
+        (see 'Multicast()' for session groups of the thread pool design).
+
+        \param topic - Topic to publish
+        \param buffer - Buffer to publish
+        \param size - Buffer size
+        \return 'true' if the data was successfully published, 'false' if the server is not started
+    */
+    virtual bool Publish(const std::string& topic, const void* buffer, size_t size);
+    //! Publish text to all sessions subscribed to the given topic
+    /*!
+        \param topic - Topic to publish
+        \param text - Text to publish
+        \return 'true' if the text was successfully published, 'false' if the server is not started
+    */
+    virtual bool Publish(const std::string& topic, const std::string_view& text) { return Publish(topic, text.data(), text.size()); }
+
     //! Disconnect all connected sessions
     /*!
         \return 'true' if all sessions were successfully disconnected, 'false' if the server is not started
@@ -172,6 +246,56 @@ public:
         \param enable - Enable/disable option
     */
     void SetupReusePort(bool enable) noexcept { _option_reuse_port = enable; }
+    //! Setup option: multiple acceptors
+    /*!
+        This option will open one acceptor with SO_REUSEPORT per Asio IO service
+        (or per working thread for the thread-pool design), so the OS kernel will
+        balance new connections between them. Each accepted session stays on the
+        Asio IO service of its acceptor.
+
+        The option is supported only on Unix systems, otherwise the single acceptor
+        will be used.
+
+        \param enable - Enable/disable option
+    */
+    void SetupMultipleAcceptors(bool enable) noexcept { _option_multiple_acceptors = enable; }
+    //! Setup option: accept concurrency
+    /*!
+        This option will setup the count of concurrent accept operations
+        outstanding on each server acceptor (default is 1). More concurrent
+        accepts help to drain the listen backlog faster during reconnect storms,
+        because each accepted session connects independently from others.
+
+        \param count - Accept operations count per acceptor
+    */
+    void SetupAcceptConcurrency(size_t count) noexcept { _option_accept_concurrency = std::max(count, (size_t)1); }
+    //! Setup option: packet timestamps
+    /*!
+        This option will enable SO_TIMESTAMPING for session sockets if the OS
+        support this feature. Received data is delivered with session
+        'onReceivedTimestamped()' handler together with the kernel (or network
+        device) receive timestamp of the latest received segment. Transmit
+        timestamps are reported with session 'onSentTimestamp()' handler.
+
+        \param receive - Enable/disable receive timestamps
+        \param transmit - Enable/disable transmit timestamps (default is false)
+    */
+    void SetupTimestamping(bool receive, bool transmit = false) noexcept { _option_receive_timestamps = receive; _option_transmit_timestamps = transmit; }
+    //! Setup option: multicast pacing
+    /*!
+        This option will pace 'Multicast()' with the token bucket of the given
+        rate: multicast messages are kept in the multicast buffer and released
+        to all sessions evenly spread in time by the high resolution timer of
+        the server Asio IO service instead of microbursts which overflow client
+        receive buffers. Messages are never split, the packet rate unit counts
+        'Multicast()' calls. Achieved and target rates are reported by
+        'multicast_pacer()'.
+
+        \param rate - Pacing rate in units per second (0 - disable pacing)
+        \param unit - Pacing rate unit (default is PacingUnit::Bytes)
+        \param burst - Burst size in units which could be multicast at once (default is 0)
+    */
+    void SetupMulticastPacing(uint64_t rate, PacingUnit unit = PacingUnit::Bytes, uint64_t burst = 0) noexcept { _option_multicast_pacing_rate = rate; _option_multicast_pacing_unit = unit; _option_multicast_pacing_burst = burst; }
 
 protected:
     //! Create TCP session factory method
@@ -197,6 +321,15 @@ protected:
         \param session - Disconnected session
     */
     virtual void onDisconnected(std::shared_ptr<TCPSession>& session) {}
+    //! Handle connection rejected notification
+    /*!
+        Notification is called when a new accepted connection was rejected
+        by the server admission control. The connection will be closed right
+        after the notification.
+
+        \param endpoint - Rejected connection endpoint
+    */
+    virtual void onRejected(const asio::ip::tcp::endpoint& endpoint) {}
 
     //! Handle error notification
     /*!
@@ -220,39 +353,148 @@ private:
     std::string _address;
     int _port;
     // Server endpoint, acceptor & socket
-    std::shared_ptr<TCPSession> _session;
     asio::ip::tcp::endpoint _endpoint;
     asio::ip::tcp::acceptor _acceptor;
     std::atomic<bool> _started;
-    HandlerStorage _acceptor_storage;
+    // Additional server acceptors (multiple acceptors mode)
+    struct Acceptor
+    {
+        std::shared_ptr<asio::io_service> io_service;
+        asio::io_service::strand strand;
+        asio::ip::tcp::acceptor acceptor;
+
+        explicit Acceptor(std::shared_ptr<asio::io_service> service) : io_service(service), strand(*service), acceptor(*service) {}
+    };
+    std::vector<std::shared_ptr<Acceptor>> _acceptors;
+    // Server accept operations (accept concurrency per acceptor)
+    struct AcceptOperation
+    {
+        std::shared_ptr<asio::io_service> io_service;
+        asio::io_service::strand& strand;
+        asio::ip::tcp::acceptor& acceptor;
+        std::shared_ptr<Acceptor> owner;
+        std::shared_ptr<TCPSession> session;
+        HandlerStorage storage;
+
+        AcceptOperation(std::shared_ptr<asio::io_service> service, asio::io_service::strand& service_strand, asio::ip::tcp::acceptor& service_acceptor, std::shared_ptr<Acceptor> acceptor_owner = nullptr)
+            : io_service(service), strand(service_strand), acceptor(service_acceptor), owner(acceptor_owner)
+        {}
+    };
+    std::vector<std::shared_ptr<AcceptOperation>> _accept_operations;
     // Server statistic
     uint64_t _bytes_pending;
     uint64_t _bytes_sent;
     uint64_t _bytes_received;
+    std::atomic<uint64_t> _connections_accepted;
+    std::atomic<uint64_t> _accept_errors;
+    std::atomic<uint64_t> _backlog_overflows;
+    std::atomic<bool> _backlog_supported;
+    // Server admission control
+    AdmissionControl _admission;
+    asio::system_timer _admission_timer;
     // Server sessions
     std::shared_mutex _sessions_lock;
     std::map<CppCommon::UUID, std::shared_ptr<TCPSession>> _sessions;
+    // Server session groups (one group per Asio IO service or working thread)
+    struct SessionGroup
+    {
+        std::shared_ptr<asio::io_service> io_service;
+        asio::io_service::strand strand;
+        std::shared_mutex lock;
+        std::vector<std::shared_ptr<TCPSession>> sessions;
+        std::unordered_map<std::string, std::vector<std::shared_ptr<TCPSession>>> topics;
+
+        explicit SessionGroup(std::shared_ptr<asio::io_service> service) : io_service(service), strand(*service) {}
+    };
+    std::vector<std::shared_ptr<SessionGroup>> _session_groups;
+    size_t _session_groups_index;
     // Multicast buffer
     std::mutex _multicast_lock;
     std::vector<uint8_t> _multicast_buffer;
     HandlerStorage _multicast_storage;
+    // Multicast pacing
+    std::vector<size_t> _multicast_sizes;
+    Pacer _multicast_pacer;
+    asio::steady_timer _multicast_timer;
+    HandlerStorage _multicast_timer_storage;
     // Options
     bool _option_keep_alive;
     bool _option_no_delay;
     bool _option_reuse_address;
     bool _option_reuse_port;
+    bool _option_multiple_acceptors;
+    size_t _option_accept_concurrency;
+    bool _option_receive_timestamps;
+    bool _option_transmit_timestamps;
+    uint64_t _option_multicast_pacing_rate;
+    PacingUnit _option_multicast_pacing_unit;
+    uint64_t _option_multicast_pacing_burst;
+
+    //! Open the given acceptor
+    /*!
+        \param acceptor - Acceptor to open
+    */
+    void OpenAcceptor(asio::ip::tcp::acceptor& acceptor);
 
-    //! Accept new connections
-    void Accept();
+    //! Accept new connections with the given accept operation
+    /*!
+        \param operation - Accept operation
+    */
+    void Accept(std::shared_ptr<AcceptOperation> operation);
+    //! Check the listen backlog of the given acceptor for overflow
+    /*!
+        \param acceptor - Acceptor to check
+    */
+    void CheckBacklog(asio::ip::tcp::acceptor& acceptor);
+
+    //! Reject the given session by the admission control
+    /*!
+        \param session - Session to reject
+    */
+    void RejectSession(std::shared_ptr<TCPSession>& session);
+    //! Measure the event-loop queue delay for the adaptive admission control
+    void ProbeQueueDelay();
+
+    //! Try to multicast the multicast buffer to all session groups
+    void TryMulticast();
+    //! Wait for the multicast pacing delay and continue multicasting
+    /*!
+        \param delay - Pacing delay in nanoseconds
+    */
+    void TryMulticastPaced(uint64_t delay);
+
+    //! Get the Asio IO service for a new session
+    std::shared_ptr<asio::io_service> GetSessionAsioService();
+
+    //! Initialize session groups
+    void InitSessionGroups();
 
     //! Register a new session
-    void RegisterSession();
+    /*!
+        \param session - Session to register
+    */
+    void RegisterSession(const std::shared_ptr<TCPSession>& session);
     //! Unregister the given session
     /*!
         \param id - Session Id
     */
     void UnregisterSession(const CppCommon::UUID& id);
 
+    //! Subscribe the given session to the given topic
+    /*!
+        \param session - Session to subscribe
+        \param topic - Topic to subscribe
+        \return 'true' if the session was successfully subscribed, 'false' if the session is not registered or already subscribed
+    */
+    bool SubscribeSession(const std::shared_ptr<TCPSession>& session, const std::string& topic);
+    //! Unsubscribe the given session from the given topic
+    /*!
+        \param session - Session to unsubscribe
+        \param topic - Topic to unsubscribe
+        \return 'true' if the session was successfully unsubscribed, 'false' if the session was not subscribed
+    */
+    bool UnsubscribeSession(const std::shared_ptr<TCPSession>& session, const std::string& topic);
+
     //! Clear multicast buffer
     void ClearBuffers();
 
@@ -10,9 +10,12 @@
 #define CPPSERVER_ASIO_TCP_SESSION_H
 
 #include "service.h"
+#include "timestamping.h"
 
 #include "system/uuid.h"
 
+#include <unordered_map>
+
 namespace CppServer {
 namespace Asio {
 
@@ -59,6 +62,8 @@ public:
     uint64_t bytes_sent() const noexcept { return _bytes_sent; }
     //! Get the number of bytes received by the session
     uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number of conflated values replaced by newer ones before sending
+    uint64_t values_conflated() const noexcept { return _values_conflated; }
 
     //! Get the option: receive buffer size
     size_t option_receive_buffer_size() const;
@@ -118,6 +123,27 @@ public:
     */
     virtual bool SendAsync(const std::string_view& text) { return SendAsync(text.data(), text.size()); }
 
+    //! Send the latest value of the given key to the client (asynchronous, conflated)
+    /*!
+        The session keeps at most one pending value per key. A newer value
+        replaces the queued one in place, and the newest values are flushed
+        after all sent data is written to the socket. This way slow clients
+        receive fresh data instead of a growing backlog.
+
+        \param key - Conflation key
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \return 'true' if the data was successfully queued, 'false' if the session is not connected
+    */
+    virtual bool SendConflated(const std::string& key, const void* buffer, size_t size);
+    //! Send the latest text of the given key to the client (asynchronous, conflated)
+    /*!
+        \param key - Conflation key
+        \param text - Text to send
+        \return 'true' if the text was successfully queued, 'false' if the session is not connected
+    */
+    virtual bool SendConflated(const std::string& key, const std::string_view& text) { return SendConflated(key, text.data(), text.size()); }
+
     //! Receive data from the client (synchronous)
     /*!
         \param buffer - Buffer to receive
@@ -151,6 +177,19 @@ public:
     //! Receive data from the client (asynchronous)
     virtual void ReceiveAsync();
 
+    //! Subscribe the session to the given topic
+    /*!
+        \param topic - Topic to subscribe
+        \return 'true' if the session was successfully subscribed, 'false' if the session is not registered in the server or already subscribed
+    */
+    bool Subscribe(const std::string& topic);
+    //! Unsubscribe the session from the given topic
+    /*!
+        \param topic - Topic to unsubscribe
+        \return 'true' if the session was successfully unsubscribed, 'false' if the session was not subscribed
+    */
+    bool Unsubscribe(const std::string& topic);
+
     //! Setup option: receive buffer size
     /*!
         This option will setup SO_RCVBUF if the OS support this feature.
@@ -181,6 +220,18 @@ protected:
         \param size - Received buffer size
     */
     virtual void onReceived(const void* buffer, size_t size) {}
+    //! Handle timestamped buffer received notification
+    /*!
+        Notification is called when another chunk of buffer was received
+        from the client in the receive timestamps mode.
+
+        Default implementation calls 'onReceived()' handler.
+
+        \param buffer - Received buffer
+        \param size - Received buffer size
+        \param timestamp - Receive timestamp of the latest received segment
+    */
+    virtual void onReceivedTimestamped(const void* buffer, size_t size, const PacketTimestamp& timestamp) { onReceived(buffer, size); }
     //! Handle buffer sent notification
     /*!
         Notification is called when another chunk of buffer was sent
@@ -193,6 +244,15 @@ protected:
         \param pending - Size of pending buffer
     */
     virtual void onSent(size_t sent, size_t pending) {}
+    //! Handle buffer transmit timestamp notification
+    /*!
+        Notification is called when the transmit timestamp of the sent
+        chunk was reported by the OS kernel in the transmit timestamps mode.
+
+        \param id - Offset of the last byte of the sent chunk in the session stream (modulo 2^32)
+        \param timestamp - Transmit timestamp of the chunk
+    */
+    virtual void onSentTimestamp(uint32_t id, const PacketTimestamp& timestamp) {}
 
     //! Handle empty send buffer notification
     /*!
@@ -240,6 +300,16 @@ private:
     std::vector<uint8_t> _send_buffer_flush;
     size_t _send_buffer_flush_offset;
     HandlerStorage _send_storage;
+    // Conflated values (one pending value per key)
+    std::unordered_map<std::string, size_t> _conflation_index;
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> _conflation_values;
+    size_t _conflation_size;
+    uint64_t _values_conflated;
+    // Session group in the server
+    size_t _group;
+    size_t _group_index;
+    // Session topics with indexes in topic subscribers of the session group
+    std::unordered_map<std::string, size_t> _topics;
 
     //! Connect the session
     void Connect();
@@ -252,6 +322,10 @@ private:
 
     //! Try to receive new data
     void TryReceive();
+    //! Try to receive new data with its receive timestamp
+    void TryReceiveTimestamped();
+    //! Try to receive transmit timestamps from the socket error queue
+    void TryReceiveTransmitTimestamps();
     //! Try to send pending data
     void TrySend();
 
@@ -0,0 +1,131 @@
+/*!
+    \file timestamping.h
+    \brief Packet timestamping definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_TIMESTAMPING_H
+#define CPPSERVER_ASIO_TIMESTAMPING_H
+
+#include "asio.h"
+
+#include <cstdint>
+
+namespace CppServer {
+namespace Asio {
+
+//! Packet timestamp
+/*!
+    Timestamps are nanoseconds since the Unix epoch (UTC).
+*/
+struct PacketTimestamp
+{
+    //! Kernel software timestamp (0 if not available)
+    uint64_t software;
+    //! Network device hardware timestamp (0 if not available)
+    uint64_t hardware;
+
+    PacketTimestamp() noexcept : software(0), hardware(0) {}
+
+    //! Get the most precise available timestamp
+    uint64_t best() const noexcept { return (hardware != 0) ? hardware : software; }
+};
+
+//! Packet timestamping
+/*!
+    Packet timestamping uses SO_TIMESTAMPING socket option to take the time
+    the packet hit the host (receive timestamp) and the time the packet left
+    the host (transmit timestamp) in the OS kernel or in the network device.
+    Comparing them with the user handler time separates the network latency
+    from the event loop queueing.
+
+    Hardware timestamps are reported only if the network device timestamping
+    was enabled by the system (e.g. with 'hwstamp_ctl' tool).
+
+    Linux is the only OS with kernel timestamps support. Other OS fall back
+    to the user space receive time and do not report transmit timestamps.
+
+    Not thread-safe.
+*/
+class Timestamping
+{
+public:
+    Timestamping() = delete;
+    Timestamping(const Timestamping&) = delete;
+    Timestamping(Timestamping&&) = delete;
+    ~Timestamping() = delete;
+
+    Timestamping& operator=(const Timestamping&) = delete;
+    Timestamping& operator=(Timestamping&&) = delete;
+
+    //! Is kernel packet timestamping supported?
+    static bool IsSupported() noexcept;
+
+    //! Enable packet timestamping for the UDP socket
+    /*!
+        Transmit timestamps are identified by the counter of datagrams sent
+        after the option was enabled.
+
+        \param socket - UDP socket
+        \param receive - Enable receive timestamps
+        \param transmit - Enable transmit timestamps
+        \param ec - Error code
+        \return 'true' if the kernel timestamping was enabled, 'false' if the timestamping is not supported
+    */
+    static bool Enable(asio::ip::udp::socket& socket, bool receive, bool transmit, asio::error_code& ec);
+    //! Enable packet timestamping for the TCP socket
+    /*!
+        Transmit timestamps are identified by the offset of the last byte
+        of the sent buffer in the stream.
+
+        \param socket - TCP socket
+        \param receive - Enable receive timestamps
+        \param transmit - Enable transmit timestamps
+        \param ec - Error code
+        \return 'true' if the kernel timestamping was enabled, 'false' if the timestamping is not supported
+    */
+    static bool Enable(asio::ip::tcp::socket& socket, bool receive, bool transmit, asio::error_code& ec);
+
+    //! Receive a single datagram with its receive timestamp (non-blocking)
+    /*!
+        \param socket - UDP socket
+        \param endpoint - Received endpoint
+        \param buffer - Receive buffer
+        \param size - Receive buffer size
+        \param timestamp - Receive timestamp
+        \param ec - Error code
+        \return Size of received datagram (0 if the socket has no pending datagrams)
+    */
+    static size_t Receive(asio::ip::udp::socket& socket, asio::ip::udp::endpoint& endpoint, void* buffer, size_t size, PacketTimestamp& timestamp, asio::error_code& ec);
+    //! Receive some data with its receive timestamp (non-blocking)
+    /*!
+        \param socket - TCP socket
+        \param buffer - Receive buffer
+        \param size - Receive buffer size
+        \param timestamp - Receive timestamp of the latest received segment
+        \param ec - Error code ('asio::error::eof' if the peer closed the connection)
+        \return Size of received data (0 if the socket has no pending data)
+    */
+    static size_t Receive(asio::ip::tcp::socket& socket, void* buffer, size_t size, PacketTimestamp& timestamp, asio::error_code& ec);
+
+    //! Receive a single transmit timestamp from the socket error queue (non-blocking)
+    /*!
+        Other entries of the error queue (e.g. ICMP errors) are returned one
+        by one with the error code of the queued extended error, so they are
+        never lost.
+
+        \param handle - Native socket handle
+        \param id - Transmit timestamp Id
+        \param timestamp - Transmit timestamp
+        \param ec - Error code of the received non-timestamp error queue entry
+        \return 'true' if the transmit timestamp was received, 'false' if the error queue is empty or the error was received
+    */
+    static bool ReceiveTransmit(asio::detail::socket_type handle, uint32_t& id, PacketTimestamp& timestamp, asio::error_code& ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_TIMESTAMPING_H
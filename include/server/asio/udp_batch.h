@@ -0,0 +1,87 @@
+/*!
+    \file udp_batch.h
+    \brief UDP batch I/O definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_UDP_BATCH_H
+#define CPPSERVER_ASIO_UDP_BATCH_H
+
+#include "asio.h"
+
+namespace CppServer {
+namespace Asio {
+
+//! UDP datagram
+/*!
+    UDP datagram entry of a batch: endpoint with the datagram buffer.
+*/
+struct UDPDatagram
+{
+    //! Datagram endpoint
+    asio::ip::udp::endpoint endpoint;
+    //! Datagram buffer
+    const void* buffer;
+    //! Datagram buffer size
+    size_t size;
+
+    UDPDatagram() noexcept : buffer(nullptr), size(0) {}
+    UDPDatagram(const asio::ip::udp::endpoint& datagram_endpoint, const void* datagram_buffer, size_t datagram_size) noexcept
+        : endpoint(datagram_endpoint), buffer(datagram_buffer), size(datagram_size)
+    {}
+};
+
+//! UDP batch I/O
+/*!
+    UDP batch I/O is used to receive or send several datagrams with
+    a single system call: recvmmsg()/sendmmsg() on Linux. Other platforms
+    fall back to the loop of non-blocking receive_from()/send_to() calls.
+
+    Both operations never block and stop on the first would-block result.
+
+    Not thread-safe.
+*/
+class UDPBatch
+{
+public:
+    UDPBatch() = delete;
+    UDPBatch(const UDPBatch&) = delete;
+    UDPBatch(UDPBatch&&) = delete;
+    ~UDPBatch() = delete;
+
+    UDPBatch& operator=(const UDPBatch&) = delete;
+    UDPBatch& operator=(UDPBatch&&) = delete;
+
+    //! Receive a batch of datagrams
+    /*!
+        Datagrams are received into the given buffer with a fixed slot
+        of 'size' bytes for each datagram. Datagrams larger than the slot
+        are truncated.
+
+        \param socket - UDP socket
+        \param buffer - Batch buffer of 'count * size' bytes
+        \param size - Single datagram slot size
+        \param datagrams - Received datagrams array of 'count' entries
+        \param count - Maximal count of datagrams to receive
+        \param ec - Error code
+        \return Count of received datagrams
+    */
+    static size_t Receive(asio::ip::udp::socket& socket, uint8_t* buffer, size_t size, UDPDatagram* datagrams, size_t count, asio::error_code& ec);
+
+    //! Send a batch of datagrams
+    /*!
+        \param socket - UDP socket
+        \param datagrams - Datagrams array to send
+        \param count - Count of datagrams to send
+        \param ec - Error code
+        \return Count of sent datagrams
+    */
+    static size_t Send(asio::ip::udp::socket& socket, const UDPDatagram* datagrams, size_t count, asio::error_code& ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_UDP_BATCH_H
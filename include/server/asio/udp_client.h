@@ -9,7 +9,11 @@
 #ifndef CPPSERVER_ASIO_UDP_CLIENT_H
 #define CPPSERVER_ASIO_UDP_CLIENT_H
 
+#include "udp_batch.h"
+#include "udp_offload.h"
 #include "udp_resolver.h"
+#include "udp_ring.h"
+#include "timestamping.h"
 
 #include "system/uuid.h"
 #include "time/timespan.h"
@@ -92,8 +96,20 @@ public:
     bool option_reuse_address() const noexcept { return _option_reuse_address; }
     //! Get the option: reuse port
     bool option_reuse_port() const noexcept { return _option_reuse_port; }
+    //! Get the option: receive batch count
+    size_t option_receive_batch() const noexcept { return _option_receive_batch; }
+    //! Get the option: receive batch datagram size
+    size_t option_receive_batch_size() const noexcept { return _option_receive_batch_size; }
+    //! Get the option: receive offload
+    bool option_receive_offload() const noexcept { return _option_receive_offload; }
+    //! Get the option: receive timestamps
+    bool option_receive_timestamps() const noexcept { return _option_receive_timestamps; }
+    //! Get the option: transmit timestamps
+    bool option_transmit_timestamps() const noexcept { return _option_transmit_timestamps; }
     //! Get the option: bind the socket to the multicast UDP server
     bool option_multicast() const noexcept { return _option_multicast; }
+    //! Get the option: receive ring
+    const std::shared_ptr<UDPRing>& option_receive_ring() const noexcept { return _option_receive_ring; }
     //! Get the option: receive buffer size
     size_t option_receive_buffer_size() const;
     //! Get the option: send buffer size
@@ -296,6 +312,48 @@ public:
     //! Receive datagram from the server (asynchronous)
     virtual void ReceiveAsync();
 
+    //! Send a batch of datagrams (asynchronous)
+    /*!
+        Datagrams are copied into the pooled send batch buffer and sent with
+        as few system calls as possible (sendmmsg() on Linux). The method fails
+        while another datagram or batch is sending.
+
+        \param datagrams - Datagrams array to send
+        \param count - Count of datagrams to send
+        \return 'true' if the batch was successfully queued, 'false' if the batch was not sent
+    */
+    virtual bool SendBatchAsync(const UDPDatagram* datagrams, size_t count);
+
+    //! Send the buffer segmented into datagrams of the given size (asynchronous)
+    /*!
+        The buffer is copied into the main send buffer and sent with a single
+        system call which is split into datagrams by the OS kernel or network
+        card (UDP_SEGMENT on Linux). Other platforms fall back to sending each
+        segment separately. The last segment might be shorter than the segment
+        size. Buffers larger than 64 segments or 64 KB are split into several
+        system calls. The segment size should not exceed the maximal datagram
+        payload ('UDPOffload::MAX_PAYLOAD'). If the socket route does not
+        support the offload, the socket falls back to sending each segment
+        separately until it is closed.
+
+        'onSent()' handler is called once with the whole buffer size.
+
+        \param endpoint - Endpoint to send
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param segment_size - Single datagram segment size
+        \return 'true' if the buffer was successfully queued, 'false' if the buffer was not sent
+    */
+    virtual bool SendSegmentedAsync(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size);
+    //! Send the buffer segmented into datagrams of the given size to the server (asynchronous)
+    /*!
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param segment_size - Single datagram segment size
+        \return 'true' if the buffer was successfully queued, 'false' if the buffer was not sent
+    */
+    virtual bool SendSegmentedAsync(const void* buffer, size_t size, size_t segment_size);
+
     //! Setup option: reuse address
     /*!
         This option will enable/disable SO_REUSEADDR if the OS support this feature.
@@ -310,11 +368,67 @@ public:
         \param enable - Enable/disable option
     */
     void SetupReusePort(bool enable) noexcept { _option_reuse_port = enable; }
+    //! Setup option: receive batch
+    /*!
+        This option will enable batched receive of up to 'count' datagrams
+        with a single system call (recvmmsg() on Linux) into the pooled batch
+        buffer. Received datagrams are delivered with 'onReceivedBatch()'
+        handler. Datagrams larger than 'size' bytes are truncated.
+
+        \param count - Maximal count of datagrams in a batch (0 or 1 - disable batching)
+        \param size - Maximal datagram size (default is 2048)
+    */
+    void SetupReceiveBatch(size_t count, size_t size = 2048) noexcept { _option_receive_batch = count; _option_receive_batch_size = size; }
+    //! Setup option: receive offload
+    /*!
+        This option will enable UDP_GRO if the OS support this feature, so
+        several datagrams of the same flow are received coalesced into one
+        buffer. Received buffers are delivered with 'onReceivedSegments()'
+        handler together with the segment size. Without the OS support each
+        datagram is delivered as a single segment.
+
+        The option takes precedence over the receive batch option.
+
+        \param enable - Enable/disable option
+    */
+    void SetupReceiveOffload(bool enable) noexcept { _option_receive_offload = enable; }
+    //! Setup option: packet timestamps
+    /*!
+        This option will enable SO_TIMESTAMPING for the client socket if the OS
+        support this feature. Received datagrams are delivered with
+        'onReceivedTimestamped()' handler together with the kernel (or network
+        device) receive timestamp. Transmit timestamps are reported with
+        'onSentTimestamp()' handler.
+
+        Receive and segmentation offloads take precedence over the receive
+        timestamps option.
+
+        \param receive - Enable/disable receive timestamps
+        \param transmit - Enable/disable transmit timestamps (default is false)
+    */
+    void SetupTimestamping(bool receive, bool transmit = false) noexcept { _option_receive_timestamps = receive; _option_transmit_timestamps = transmit; }
     //! Setup option: bind the socket to the multicast UDP server
     /*!
         \param enable - Enable/disable option
     */
     void SetupMulticast(bool enable) noexcept { _option_reuse_address = enable; _option_multicast = enable; }
+    //! Setup option: receive ring
+    /*!
+        This option will receive datagrams directly into the slots of the given
+        shared ring, so several in-process consumers read each datagram of the
+        single socket (e.g. joined to the multicast group) on their own threads
+        without copying. Datagrams which do not fit into the full ring are
+        dropped. Datagrams larger than the ring datagram size are truncated.
+
+        In the receive ring mode 'onReceived()' handlers are not called and
+        the client keeps receiving datagrams after the first 'ReceiveAsync()'
+        call until disconnected.
+
+        The option takes precedence over all other receive options.
+
+        \param ring - Shared ring of received datagrams (nullptr - disable option)
+    */
+    void SetupReceiveRing(std::shared_ptr<UDPRing> ring) noexcept { _option_receive_ring = ring; }
     //! Setup option: receive buffer size
     /*!
         This option will setup SO_RCVBUF if the OS support this feature.
@@ -357,6 +471,54 @@ protected:
         \param size - Received datagram buffer size
     */
     virtual void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) {}
+    //! Handle datagrams batch received notification
+    /*!
+        Notification is called when another batch of datagrams was received
+        in the receive batch mode. Datagram buffers are valid only during
+        the handler call.
+
+        Default implementation calls 'onReceived()' handler for each datagram.
+
+        \param datagrams - Received datagrams array
+        \param count - Count of received datagrams
+    */
+    virtual void onReceivedBatch(const UDPDatagram* datagrams, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            onReceived(datagrams[i].endpoint, datagrams[i].buffer, datagrams[i].size);
+    }
+    //! Handle segmented datagrams received notification
+    /*!
+        Notification is called when another buffer of coalesced datagrams was
+        received in the receive offload mode. All datagrams in the buffer have
+        the given segment size, except the last one which might be shorter.
+
+        Default implementation calls 'onReceived()' handler for each segment.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received buffer of coalesced datagrams
+        \param size - Received buffer size
+        \param segment_size - Single datagram segment size
+    */
+    virtual void onReceivedSegments(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size)
+    {
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        for (size_t offset = 0; offset < size; offset += segment_size)
+            onReceived(endpoint, bytes + offset, std::min(segment_size, size - offset));
+    }
+    //! Handle timestamped datagram received notification
+    /*!
+        Notification is called when another datagram was received in the
+        receive timestamps mode.
+
+        Default implementation calls 'onReceived()' handler.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+        \param timestamp - Receive timestamp of the datagram
+    */
+    virtual void onReceivedTimestamped(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, const PacketTimestamp& timestamp) { onReceived(endpoint, buffer, size); }
     //! Handle datagram sent notification
     /*!
         Notification is called when a datagram was sent to the server.
@@ -368,6 +530,15 @@ protected:
         \param sent - Size of sent datagram buffer
     */
     virtual void onSent(const asio::ip::udp::endpoint& endpoint, size_t sent) {}
+    //! Handle datagram transmit timestamp notification
+    /*!
+        Notification is called when the transmit timestamp of the sent
+        datagram was reported by the OS kernel in the transmit timestamps mode.
+
+        \param id - Counter of the datagram sent by the client socket since connect (starting from 0)
+        \param timestamp - Transmit timestamp of the datagram
+    */
+    virtual void onSentTimestamp(uint32_t id, const PacketTimestamp& timestamp) {}
 
     //! Handle error notification
     /*!
@@ -413,10 +584,26 @@ private:
     bool _sending;
     std::vector<uint8_t> _send_buffer;
     HandlerStorage _send_storage;
+    // Batch buffers
+    std::vector<uint8_t> _receive_batch_buffer;
+    std::vector<UDPDatagram> _receive_batch;
+    std::vector<uint8_t> _send_batch_buffer;
+    std::vector<UDPDatagram> _send_batch;
+    size_t _send_batch_offset;
+    // Segmented send
+    size_t _send_segment_size;
+    size_t _send_segment_offset;
+    bool _send_segment_offload;
     // Options
     bool _option_reuse_address;
     bool _option_reuse_port;
+    size_t _option_receive_batch;
+    size_t _option_receive_batch_size;
+    bool _option_receive_offload;
+    bool _option_receive_timestamps;
+    bool _option_transmit_timestamps;
     bool _option_multicast;
+    std::shared_ptr<UDPRing> _option_receive_ring;
 
     //! Disconnect the client (asynchronous)
     /*!
@@ -427,6 +614,20 @@ private:
 
     //! Try to receive new datagram
     void TryReceive();
+    //! Try to receive new batch of datagrams
+    void TryReceiveBatch();
+    //! Try to receive new buffer of segmented datagrams
+    void TryReceiveSegments();
+    //! Try to receive new datagram with its receive timestamp
+    void TryReceiveTimestamped();
+    //! Try to receive new datagrams into the receive ring
+    void TryReceiveRing();
+    //! Try to receive transmit timestamps from the socket error queue
+    void TryReceiveTransmitTimestamps();
+    //! Try to send the pending batch of datagrams
+    void TrySendBatch();
+    //! Try to send the pending segmented buffer
+    void TrySendSegments();
 
     //! Clear send/receive buffers
     void ClearBuffers();
@@ -0,0 +1,97 @@
+/*!
+    \file udp_offload.h
+    \brief UDP segmentation offload definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_UDP_OFFLOAD_H
+#define CPPSERVER_ASIO_UDP_OFFLOAD_H
+
+#include "asio.h"
+
+namespace CppServer {
+namespace Asio {
+
+//! UDP segmentation offload
+/*!
+    UDP segmentation offload is used to send one large buffer which is split
+    into datagrams of the given segment size by the OS kernel or network card
+    (UDP_SEGMENT, generic segmentation offload on Linux), and to receive
+    several datagrams of the same flow coalesced into one large buffer
+    (UDP_GRO, generic receive offload on Linux).
+
+    Other platforms (or Linux kernels without offload support) fall back
+    to the loop of non-blocking send_to() calls for each segment and to
+    the regular receive of single datagrams with the segment size equal
+    to the datagram size. Segmentation offload support depends on the
+    route and network device, so it is tracked by the caller per socket.
+
+    Both operations never block and return zero on would-block result.
+
+    Not thread-safe.
+*/
+class UDPOffload
+{
+public:
+    UDPOffload() = delete;
+    UDPOffload(const UDPOffload&) = delete;
+    UDPOffload(UDPOffload&&) = delete;
+    ~UDPOffload() = delete;
+
+    UDPOffload& operator=(const UDPOffload&) = delete;
+    UDPOffload& operator=(UDPOffload&&) = delete;
+
+    //! Maximal size of the segmented or coalesced buffer
+    static constexpr size_t MAX_SIZE = 65535;
+    //! Maximal count of segments sent with a single system call
+    static constexpr size_t MAX_SEGMENTS = 64;
+    //! Maximal payload sent with a single system call (UDP and IPv6 headers excluded)
+    static constexpr size_t MAX_PAYLOAD = MAX_SIZE - 8 - 40;
+
+    //! Is the segmentation offload supported by the platform?
+    static bool IsSupported() noexcept;
+
+    //! Enable receive offload for the given socket
+    /*!
+        \param socket - UDP socket
+        \param ec - Error code
+        \return 'true' if the receive offload was successfully enabled, 'false' if the receive offload is not supported
+    */
+    static bool EnableReceiveOffload(asio::ip::udp::socket& socket, asio::error_code& ec);
+
+    //! Send the buffer segmented into datagrams
+    /*!
+        Buffer is split into system calls of at most MAX_SEGMENTS segments
+        and MAX_PAYLOAD bytes. Segment size should not exceed MAX_PAYLOAD
+        bytes. The last segment might be shorter than the segment size.
+
+        \param socket - UDP socket
+        \param endpoint - Endpoint to send
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param segment_size - Single datagram segment size
+        \param offload - Segmentation offload flag of the socket (cleared if the socket route does not support the offload)
+        \param ec - Error code
+        \return Size of sent bytes (always whole segments)
+    */
+    static size_t Send(asio::ip::udp::socket& socket, const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size, bool& offload, asio::error_code& ec);
+
+    //! Receive the coalesced buffer of datagrams
+    /*!
+        \param socket - UDP socket
+        \param endpoint - Endpoint to receive from
+        \param buffer - Buffer to receive
+        \param size - Buffer size (should be at least MAX_SIZE bytes)
+        \param segment_size - Received datagram segment size
+        \param ec - Error code
+        \return Size of received bytes
+    */
+    static size_t Receive(asio::ip::udp::socket& socket, asio::ip::udp::endpoint& endpoint, void* buffer, size_t size, size_t& segment_size, asio::error_code& ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_UDP_OFFLOAD_H
@@ -0,0 +1,168 @@
+/*!
+    \file udp_ring.h
+    \brief UDP datagrams ring definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_UDP_RING_H
+#define CPPSERVER_ASIO_UDP_RING_H
+
+#include "udp_batch.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! UDP datagrams ring
+/*!
+    UDP datagrams ring is a single producer, multiple consumers broadcast
+    ring of received datagrams. The producer (usually the UDP client in
+    the receive ring mode) writes each datagram once into the ring slot,
+    and every subscribed consumer reads all datagrams with its own sequence
+    cursor directly from the ring slots without copying.
+
+    The producer never overwrites datagrams which are not yet released by
+    the slowest consumer: if the ring is full the new datagram is dropped
+    and counted in 'datagrams_dropped()'.
+
+    Producer methods should be called from a single thread. Each consumer
+    should be used by a single thread.
+
+    Lock-free.
+*/
+class UDPRing
+{
+public:
+    //! UDP datagrams ring consumer
+    class Consumer
+    {
+        friend class UDPRing;
+
+    public:
+        Consumer() noexcept : _ring(nullptr), _sequence(0), _state(0) {}
+        Consumer(const Consumer&) = delete;
+        Consumer(Consumer&&) = delete;
+        ~Consumer() = default;
+
+        Consumer& operator=(const Consumer&) = delete;
+        Consumer& operator=(Consumer&&) = delete;
+
+        //! Get the sequence number of the next datagram to read
+        uint64_t sequence() const noexcept { return _sequence.load(std::memory_order_relaxed); }
+        //! Get the count of published datagrams available to read
+        size_t available() const noexcept;
+
+        //! Acquire available datagrams
+        /*!
+            Acquired datagrams are contiguous ring slots, so the count might
+            be less than available datagrams at the end of the ring. Datagrams
+            stay valid until they are released.
+
+            \param datagrams - Pointer to the first acquired datagram
+            \param limit - Maximal count of datagrams to acquire (default is unlimited)
+            \return Count of acquired datagrams
+        */
+        size_t Acquire(const UDPDatagram*& datagrams, size_t limit = (size_t)-1) noexcept;
+        //! Release read datagrams
+        /*!
+            \param count - Count of read datagrams to release
+        */
+        void Release(size_t count) noexcept;
+
+    private:
+        UDPRing* _ring;
+        alignas(64) std::atomic<uint64_t> _sequence;
+        std::atomic<int> _state;
+    };
+
+    //! Initialize the ring with a given capacity and datagram size
+    /*!
+        \param capacity - Ring capacity in datagrams (rounded up to the power of two)
+        \param datagram_size - Maximal datagram size (default is 2048)
+        \param consumers - Maximal count of consumers (default is 64)
+    */
+    explicit UDPRing(size_t capacity, size_t datagram_size = 2048, size_t consumers = 64);
+    UDPRing(const UDPRing&) = delete;
+    UDPRing(UDPRing&&) = delete;
+    ~UDPRing() = default;
+
+    UDPRing& operator=(const UDPRing&) = delete;
+    UDPRing& operator=(UDPRing&&) = delete;
+
+    //! Get the ring capacity in datagrams
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get the maximal datagram size
+    size_t datagram_size() const noexcept { return _datagram_size; }
+
+    //! Get the sequence number of the next published datagram
+    uint64_t published() const noexcept { return _published.load(std::memory_order_acquire); }
+    //! Get the number of datagrams dropped because of the full ring
+    uint64_t datagrams_dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+
+    //! Subscribe a new consumer
+    /*!
+        The new consumer starts reading from the next published datagram.
+
+        \return Subscribed consumer or nullptr if the maximal count of consumers is reached
+    */
+    Consumer* Subscribe() noexcept;
+    //! Unsubscribe the consumer
+    /*!
+        \param consumer - Consumer to unsubscribe
+    */
+    void Unsubscribe(Consumer* consumer) noexcept;
+
+    //! Claim the next ring slot to write the datagram (producer)
+    /*!
+        The claimed slot buffer has 'datagram_size()' bytes. The producer
+        should fill the buffer, the endpoint and the size of the slot and
+        then call 'Publish()'.
+
+        \return Pointer to the datagram buffer of the claimed slot or nullptr if the ring is full
+    */
+    void* Claim() noexcept;
+    //! Publish the claimed ring slot (producer)
+    /*!
+        \param endpoint - Datagram endpoint
+        \param size - Datagram size
+    */
+    void Publish(const asio::ip::udp::endpoint& endpoint, size_t size) noexcept;
+    //! Copy and publish the datagram (producer)
+    /*!
+        \param endpoint - Datagram endpoint
+        \param buffer - Datagram buffer
+        \param size - Datagram size (truncated to 'datagram_size()')
+        \return 'true' if the datagram was published, 'false' if the ring is full
+    */
+    bool Publish(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) noexcept;
+    //! Drop the datagram which does not fit into the full ring (producer)
+    void Drop() noexcept { _dropped.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+    size_t _capacity;
+    size_t _mask;
+    size_t _datagram_size;
+    // Datagrams slots
+    std::vector<uint8_t> _buffer;
+    std::vector<UDPDatagram> _slots;
+    // Consumers
+    std::unique_ptr<Consumer[]> _consumers;
+    size_t _consumers_count;
+    // Producer state
+    alignas(64) std::atomic<uint64_t> _published;
+    uint64_t _gating;
+    std::atomic<uint64_t> _dropped;
+
+    //! Get the minimal sequence of active consumers
+    uint64_t MinSequence(uint64_t published) const noexcept;
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_UDP_RING_H
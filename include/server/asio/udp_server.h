@@ -9,13 +9,29 @@
 #ifndef CPPSERVER_ASIO_UDP_SERVER_H
 #define CPPSERVER_ASIO_UDP_SERVER_H
 
+#include "pacer.h"
 #include "service.h"
+#include "udp_batch.h"
+#include "udp_offload.h"
+#include "udp_session.h"
+#include "udp_xdp.h"
+#include "timestamping.h"
 
 #include "system/uuid.h"
 
+#include <mutex>
+#include <shared_mutex>
+
 namespace CppServer {
 namespace Asio {
 
+//! Send queue drop policy
+enum class DropPolicy
+{
+    DropNewest,         //!< Drop the newest datagram when the send queue is full
+    DropOldest          //!< Drop the oldest pending datagram when the send queue is full
+};
+
 //! UDP server
 /*!
     UDP server is used to send or multicast datagrams to UDP endpoints.
@@ -24,6 +40,8 @@ namespace Asio {
 */
 class UDPServer : public std::enable_shared_from_this<UDPServer>
 {
+    friend class UDPSession;
+
 public:
     //! Initialize UDP server with a given Asio service and port number
     /*!
@@ -81,11 +99,53 @@ public:
     uint64_t datagrams_sent() const noexcept { return _datagrams_sent; }
     //! Get the number datagrams received by the server
     uint64_t datagrams_received() const noexcept { return _datagrams_received; }
+    //! Get the number datagrams dropped by the send queue
+    uint64_t datagrams_dropped() const noexcept { return _datagrams_dropped; }
+    //! Get the number of bytes dropped by the send queue
+    uint64_t bytes_dropped() const noexcept { return _bytes_dropped; }
+    //! Get the number of connected sessions
+    uint64_t connected_sessions() const noexcept { return _sessions_count; }
+    //! Get the send pacer with the achieved and target rate statistic (read without synchronization)
+    const Pacer& pacer() const noexcept { return _pacer; }
+    //! Is the send pacer using SO_TXTIME launch times? ('false' if the transmit time option fell back to the user space pacing)
+    bool pacer_transmit_time() const noexcept { return _pacing_transmit_time; }
+    //! Get the AF_XDP transport
+    const UDPXdp& xdp() const noexcept { return _xdp; }
 
     //! Get the option: reuse address
     bool option_reuse_address() const noexcept { return _option_reuse_address; }
     //! Get the option: reuse port
     bool option_reuse_port() const noexcept { return _option_reuse_port; }
+    //! Get the option: receive batch count
+    size_t option_receive_batch() const noexcept { return _option_receive_batch; }
+    //! Get the option: receive batch datagram size
+    size_t option_receive_batch_size() const noexcept { return _option_receive_batch_size; }
+    //! Get the option: receive offload
+    bool option_receive_offload() const noexcept { return _option_receive_offload; }
+    //! Get the option: receive timestamps
+    bool option_receive_timestamps() const noexcept { return _option_receive_timestamps; }
+    //! Get the option: transmit timestamps
+    bool option_transmit_timestamps() const noexcept { return _option_transmit_timestamps; }
+    //! Get the option: send queue limit
+    size_t option_send_queue() const noexcept { return _option_send_queue; }
+    //! Get the option: send queue drop policy
+    DropPolicy option_send_queue_policy() const noexcept { return _option_send_queue_policy; }
+    //! Get the option: pacing rate
+    uint64_t option_pacing_rate() const noexcept { return _option_pacing_rate; }
+    //! Get the option: pacing rate unit
+    PacingUnit option_pacing_unit() const noexcept { return _option_pacing_unit; }
+    //! Get the option: pacing burst
+    uint64_t option_pacing_burst() const noexcept { return _option_pacing_burst; }
+    //! Get the option: transmit time
+    bool option_transmit_time() const noexcept { return _option_transmit_time; }
+    //! Get the option: AF_XDP network interface
+    const std::string& option_xdp_interface() const noexcept { return _option_xdp_interface; }
+    //! Get the option: AF_XDP network interface queue
+    int option_xdp_queue() const noexcept { return _option_xdp_queue; }
+    //! Get the option: session idle timeout
+    const CppCommon::Timespan& option_session_timeout() const noexcept { return _option_session_timeout; }
+    //! Get the option: multiple sockets
+    bool option_multiple_sockets() const noexcept { return _option_multiple_sockets; }
     //! Get the option: receive buffer size
     size_t option_receive_buffer_size() const;
     //! Get the option: send buffer size
@@ -93,6 +153,8 @@ public:
 
     //! Is the server started?
     bool IsStarted() const noexcept { return _started; }
+    //! Is the server using the AF_XDP transport?
+    bool IsXdp() const noexcept { return _xdp.IsOpened(); }
 
     //! Start the server
     /*!
@@ -125,6 +187,19 @@ public:
     */
     virtual bool Restart();
 
+    //! Disconnect all connected sessions
+    /*!
+        \return 'true' if all sessions were successfully disconnected, 'false' if the server is not started
+    */
+    virtual bool DisconnectAll();
+
+    //! Find the session with a given peer endpoint
+    /*!
+        \param endpoint - Peer endpoint
+        \return Session with a given peer endpoint or null if the session it not connected
+    */
+    std::shared_ptr<UDPSession> FindSession(const asio::ip::udp::endpoint& endpoint);
+
     //! Multicast datagram to the prepared mulicast endpoint (synchronous)
     /*!
         \param buffer - Datagram buffer to multicast
@@ -205,6 +280,10 @@ public:
 
     //! Send datagram into the given endpoint (asynchronous)
     /*!
+        Without the send queue the method fails while another datagram is
+        sending. In the send queue mode the datagram is queued and the method
+        fails only when the full queue drops the newest datagram.
+
         \param endpoint - Endpoint to send
         \param buffer - Datagram buffer to send
         \param size - Datagram buffer size
@@ -256,6 +335,40 @@ public:
     //! Receive datagram from the client (asynchronous)
     virtual void ReceiveAsync();
 
+    //! Send a batch of datagrams (asynchronous)
+    /*!
+        Datagrams are copied into the pooled send batch buffer and sent with
+        as few system calls as possible (sendmmsg() on Linux). The method fails
+        while another datagram or batch is sending.
+
+        \param datagrams - Datagrams array to send
+        \param count - Count of datagrams to send
+        \return 'true' if the batch was successfully queued, 'false' if the batch was not sent
+    */
+    virtual bool SendBatchAsync(const UDPDatagram* datagrams, size_t count);
+
+    //! Send the buffer segmented into datagrams of the given size (asynchronous)
+    /*!
+        The buffer is copied into the main send buffer and sent with a single
+        system call which is split into datagrams by the OS kernel or network
+        card (UDP_SEGMENT on Linux). Other platforms fall back to sending each
+        segment separately. The last segment might be shorter than the segment
+        size. Buffers larger than 64 segments or 64 KB are split into several
+        system calls. The segment size should not exceed the maximal datagram
+        payload ('UDPOffload::MAX_PAYLOAD'). If the socket route does not
+        support the offload, the socket falls back to sending each segment
+        separately until it is closed.
+
+        'onSent()' handler is called once with the whole buffer size.
+
+        \param endpoint - Endpoint to send
+        \param buffer - Buffer to send
+        \param size - Buffer size
+        \param segment_size - Single datagram segment size
+        \return 'true' if the buffer was successfully queued, 'false' if the buffer was not sent
+    */
+    virtual bool SendSegmentedAsync(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size);
+
     //! Setup option: reuse address
     /*!
         This option will enable/disable SO_REUSEADDR if the OS support this feature.
@@ -270,6 +383,140 @@ public:
         \param enable - Enable/disable option
     */
     void SetupReusePort(bool enable) noexcept { _option_reuse_port = enable; }
+    //! Setup option: receive batch
+    /*!
+        This option will enable batched receive of up to 'count' datagrams
+        with a single system call (recvmmsg() on Linux) into the pooled batch
+        buffer. Received datagrams are delivered with 'onReceivedBatch()'
+        handler. Datagrams larger than 'size' bytes are truncated.
+
+        \param count - Maximal count of datagrams in a batch (0 or 1 - disable batching)
+        \param size - Maximal datagram size (default is 2048)
+    */
+    void SetupReceiveBatch(size_t count, size_t size = 2048) noexcept { _option_receive_batch = count; _option_receive_batch_size = size; }
+    //! Setup option: receive offload
+    /*!
+        This option will enable UDP_GRO if the OS support this feature, so
+        several datagrams of the same flow are received coalesced into one
+        buffer. Received buffers are delivered with 'onReceivedSegments()'
+        handler together with the segment size. Without the OS support each
+        datagram is delivered as a single segment.
+
+        The option takes precedence over the receive batch option.
+
+        \param enable - Enable/disable option
+    */
+    void SetupReceiveOffload(bool enable) noexcept { _option_receive_offload = enable; }
+    //! Setup option: packet timestamps
+    /*!
+        This option will enable SO_TIMESTAMPING for the main server socket if
+        the OS support this feature. Received datagrams are delivered with
+        'onReceivedTimestamped()' handler together with the kernel (or network
+        device) receive timestamp. Transmit timestamps are reported with
+        'onSentTimestamp()' handler.
+
+        Receive and segmentation offloads take precedence over the receive
+        timestamps option.
+
+        \param receive - Enable/disable receive timestamps
+        \param transmit - Enable/disable transmit timestamps (default is false)
+    */
+    void SetupTimestamping(bool receive, bool transmit = false) noexcept { _option_receive_timestamps = receive; _option_transmit_timestamps = transmit; }
+    //! Setup option: send queue
+    /*!
+        This option will enable the bounded send queue for 'SendAsync()',
+        'MulticastAsync()' and 'SendBatchAsync()' methods. Queued datagrams
+        are copied into the ring of pooled datagram slots with their endpoints
+        and drained continuously with as few system calls as possible
+        (sendmmsg() on Linux). When the queue is full the newest or the oldest
+        pending datagram is dropped in constant time according to the given
+        policy and counted in 'datagrams_dropped()' statistic.
+
+        \param limit - Maximal count of pending datagrams (0 - disable send queue)
+        \param policy - Drop policy (default is DropPolicy::DropNewest)
+    */
+    void SetupSendQueue(size_t limit, DropPolicy policy = DropPolicy::DropNewest) noexcept { _option_send_queue = limit; _option_send_queue_policy = policy; }
+    //! Setup option: pacing
+    /*!
+        This option will pace datagrams sent with 'SendAsync()', 'MulticastAsync()'
+        and 'SendBatchAsync()' methods with the token bucket of the given rate,
+        so datagrams leave the server evenly spread in time instead of microbursts
+        which overflow receiver buffers. Paced datagrams are sent through the send
+        queue (unbounded if 'SetupSendQueue()' was not called) and waited with the
+        high resolution timer of the server Asio IO service. Achieved and target
+        rates are reported by 'pacer()'.
+
+        \param rate - Pacing rate in units per second (0 - disable pacing)
+        \param unit - Pacing rate unit (default is PacingUnit::Bytes)
+        \param burst - Burst size in units which could be sent at once (default is 0)
+    */
+    void SetupPacing(uint64_t rate, PacingUnit unit = PacingUnit::Bytes, uint64_t burst = 0) noexcept { _option_pacing_rate = rate; _option_pacing_unit = unit; _option_pacing_burst = burst; }
+    //! Setup option: transmit time
+    /*!
+        This option will hand paced datagrams to the OS kernel ahead of time with
+        SO_TXTIME launch times, so the fq queue discipline of the egress
+        interface releases them precisely without the user space timer wake-ups.
+        If no such queue discipline is found on start, the server falls back to
+        the user space pacing, which is reported by 'pacer_transmit_time()'.
+
+        The option is supported only on Linux, otherwise the user space pacing
+        will be used.
+
+        \param enable - Enable/disable option
+    */
+    void SetupTransmitTime(bool enable) noexcept { _option_transmit_time = enable; }
+    //! Setup option: AF_XDP transport
+    /*!
+        This option will receive and send IPv4 datagrams of the server port with
+        the AF_XDP socket bound to the given network interface queue, bypassing
+        the OS network stack ('UDPXdp'). The XDP program is attached in generic
+        (SKB) mode, so any network driver is supported. Received datagrams are
+        delivered with 'onReceivedBatch()' handler and stay valid until the next
+        receive. The XDP program passes datagrams of other network interface
+        queues to the OS network stack, so the regular socket keeps receiving
+        them with the configured receive mode next to the AF_XDP socket.
+        Datagrams to endpoints with unknown link layer address (not multicast
+        and not seen by the receive path) are sent with the regular socket.
+
+        If the AF_XDP socket could not be opened (not Linux, no privileges or
+        no kernel support) the server falls back to the regular socket.
+
+        The AF_XDP path requires privileges and an XDP capable network interface,
+        so it is not verified by the automated tests, only the fallback is.
+
+        \param interface - Network interface name (empty - disable option)
+        \param queue - Network interface queue (default is 0)
+    */
+    void SetupXdp(const std::string& interface, int queue = 0) { _option_xdp_interface = interface; _option_xdp_queue = queue; }
+    //! Setup option: session idle timeout
+    /*!
+        Sessions without received datagrams during the idle timeout are
+        disconnected by the server.
+
+        \param timeout - Session idle timeout (zero - sessions never expire, default is 60 seconds)
+    */
+    void SetupSessionTimeout(const CppCommon::Timespan& timeout) noexcept { _option_session_timeout = timeout; }
+    //! Setup option: multiple sockets
+    /*!
+        This option will open one additional receive socket with SO_REUSEPORT per
+        Asio IO service (or per working thread for the thread-pool design), so the
+        OS kernel will balance incoming datagrams between them. Datagrams are still
+        sent with the main server socket.
+
+        With this option 'onReceived()' handler might be called concurrently from
+        different working threads. The option should not be used for multicast
+        receivers, because each socket will receive its own copy of a datagram.
+
+        Additional sockets receive datagrams one by one, so the option cannot be
+        combined with the receive batch, receive offload, receive timestamps and
+        AF_XDP options: 'Start()' fails with the invalid argument error.
+
+        The option is supported only on Unix systems, otherwise the single socket
+        will be used.
+
+        \param enable - Enable/disable option
+    */
+    void SetupMultipleSockets(bool enable) noexcept { _option_multiple_sockets = enable; }
     //! Setup option: receive buffer size
     /*!
         This option will setup SO_RCVBUF if the OS support this feature.
@@ -285,22 +532,102 @@ public:
     */
     void SetupSendBufferSize(size_t size);
 
+protected:
+    //! Create UDP session factory method
+    /*!
+        The factory is called for each datagram received from a new peer
+        endpoint. Default implementation returns null, so the server works
+        without virtual sessions.
+
+        \param server - UDP server
+        \param endpoint - Peer endpoint
+        \return UDP session or null to handle the datagram without a session
+    */
+    virtual std::shared_ptr<UDPSession> CreateSession(std::shared_ptr<UDPServer> server, const asio::ip::udp::endpoint& endpoint) { return nullptr; }
+
 protected:
     //! Handle server started notification
     virtual void onStarted() {}
     //! Handle server stopped notification
     virtual void onStopped() {}
 
+    //! Handle session connected notification
+    /*!
+        \param session - Connected session
+    */
+    virtual void onConnected(std::shared_ptr<UDPSession>& session) {}
+    //! Handle session disconnected notification
+    /*!
+        \param session - Disconnected session
+    */
+    virtual void onDisconnected(std::shared_ptr<UDPSession>& session) {}
+
     //! Handle datagram received notification
     /*!
         Notification is called when another datagram was received from
         some endpoint.
 
+        Default implementation dispatches the datagram to the session of
+        the endpoint, which is created with 'CreateSession()' factory for
+        a new endpoint.
+
+        With the multiple sockets option the notification is called
+        concurrently from the working threads of all receive sockets,
+        so the handler should be thread-safe.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    virtual void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) { DispatchReceived(endpoint, buffer, size); }
+    //! Handle datagrams batch received notification
+    /*!
+        Notification is called when another batch of datagrams was received
+        in the receive batch mode. Datagram buffers are valid only during
+        the handler call.
+
+        Default implementation calls 'onReceived()' handler for each datagram.
+
+        \param datagrams - Received datagrams array
+        \param count - Count of received datagrams
+    */
+    virtual void onReceivedBatch(const UDPDatagram* datagrams, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            onReceived(datagrams[i].endpoint, datagrams[i].buffer, datagrams[i].size);
+    }
+    //! Handle segmented datagrams received notification
+    /*!
+        Notification is called when another buffer of coalesced datagrams was
+        received in the receive offload mode. All datagrams in the buffer have
+        the given segment size, except the last one which might be shorter.
+
+        Default implementation calls 'onReceived()' handler for each segment.
+
+        \param endpoint - Received endpoint
+        \param buffer - Received buffer of coalesced datagrams
+        \param size - Received buffer size
+        \param segment_size - Single datagram segment size
+    */
+    virtual void onReceivedSegments(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size)
+    {
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        for (size_t offset = 0; offset < size; offset += segment_size)
+            onReceived(endpoint, bytes + offset, std::min(segment_size, size - offset));
+    }
+    //! Handle timestamped datagram received notification
+    /*!
+        Notification is called when another datagram was received in the
+        receive timestamps mode.
+
+        Default implementation calls 'onReceived()' handler.
+
         \param endpoint - Received endpoint
         \param buffer - Received datagram buffer
         \param size - Received datagram buffer size
+        \param timestamp - Receive timestamp of the datagram
     */
-    virtual void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) {}
+    virtual void onReceivedTimestamped(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, const PacketTimestamp& timestamp) { onReceived(endpoint, buffer, size); }
     //! Handle datagram sent notification
     /*!
         Notification is called when a datagram was sent to the client.
@@ -308,10 +635,22 @@ protected:
         This handler could be used to send another datagram to the client
         for instance when the pending size is zero.
 
+        Default implementation dispatches the notification to the session
+        of the endpoint.
+
         \param endpoint - Endpoint of sent datagram
         \param sent - Size of sent datagram buffer
     */
-    virtual void onSent(const asio::ip::udp::endpoint& endpoint, size_t sent) {}
+    virtual void onSent(const asio::ip::udp::endpoint& endpoint, size_t sent) { DispatchSent(endpoint, sent); }
+    //! Handle datagram transmit timestamp notification
+    /*!
+        Notification is called when the transmit timestamp of the sent
+        datagram was reported by the OS kernel in the transmit timestamps mode.
+
+        \param id - Counter of the datagram sent by the server socket (starting from 0)
+        \param timestamp - Transmit timestamp of the datagram
+    */
+    virtual void onSentTimestamp(uint32_t id, const PacketTimestamp& timestamp) {}
 
     //! Handle error notification
     /*!
@@ -341,9 +680,11 @@ private:
     // Server statistic
     uint64_t _bytes_sending;
     uint64_t _bytes_sent;
-    uint64_t _bytes_received;
+    std::atomic<uint64_t> _bytes_received;
     uint64_t _datagrams_sent;
-    uint64_t _datagrams_received;
+    std::atomic<uint64_t> _datagrams_received;
+    std::atomic<uint64_t> _datagrams_dropped;
+    std::atomic<uint64_t> _bytes_dropped;
     // Multicast, receive and send endpoints
     asio::ip::udp::endpoint _multicast_endpoint;
     asio::ip::udp::endpoint _receive_endpoint;
@@ -356,12 +697,160 @@ private:
     bool _sending;
     std::vector<uint8_t> _send_buffer;
     HandlerStorage _send_storage;
+    // Batch buffers
+    std::vector<uint8_t> _receive_batch_buffer;
+    std::vector<UDPDatagram> _receive_batch;
+    std::vector<uint8_t> _send_batch_buffer;
+    std::vector<UDPDatagram> _send_batch;
+    size_t _send_batch_offset;
+    // Send queue (ring of datagram slots which keep their buffers between flushes)
+    struct QueuedDatagram
+    {
+        asio::ip::udp::endpoint endpoint;
+        std::vector<uint8_t> buffer;
+    };
+    std::mutex _send_lock;
+    std::vector<QueuedDatagram> _send_queue;
+    size_t _send_queue_head;
+    size_t _send_queue_count;
+    std::vector<QueuedDatagram> _send_queue_flush;
+    // Send pacing
+    Pacer _pacer;
+    bool _pacing_transmit_time;
+    std::vector<uint64_t> _send_launch_times;
+    asio::steady_timer _pacing_timer;
+    // AF_XDP transport
+    UDPXdp _xdp;
+    std::vector<UDPDatagram> _xdp_batch;
+    bool _xdp_receiving;
+    HandlerStorage _xdp_storage;
+#if defined(__linux__)
+    std::unique_ptr<asio::posix::stream_descriptor> _xdp_descriptor;
+#endif
+    // Segmented send
+    size_t _send_segment_size;
+    size_t _send_segment_offset;
+    bool _send_segment_offload;
+    // Additional server receivers (multiple sockets mode)
+    struct Receiver
+    {
+        std::shared_ptr<asio::io_service> io_service;
+        asio::io_service::strand strand;
+        asio::ip::udp::socket socket;
+        asio::ip::udp::endpoint endpoint;
+        std::atomic<bool> receiving;
+        std::vector<uint8_t> buffer;
+        HandlerStorage storage;
+
+        explicit Receiver(std::shared_ptr<asio::io_service> service) : io_service(service), strand(*service), socket(*service), receiving(false) {}
+    };
+    std::vector<std::shared_ptr<Receiver>> _receivers;
+    // Server sessions (open-addressing hash table with linear probing)
+    std::shared_mutex _sessions_lock;
+    std::vector<std::shared_ptr<UDPSession>> _sessions;
+    std::atomic<size_t> _sessions_count;
+    asio::system_timer _sessions_timer;
     // Options
     bool _option_reuse_address;
     bool _option_reuse_port;
+    size_t _option_receive_batch;
+    size_t _option_receive_batch_size;
+    bool _option_receive_offload;
+    bool _option_receive_timestamps;
+    bool _option_transmit_timestamps;
+    size_t _option_send_queue;
+    DropPolicy _option_send_queue_policy;
+    uint64_t _option_pacing_rate;
+    PacingUnit _option_pacing_unit;
+    uint64_t _option_pacing_burst;
+    bool _option_transmit_time;
+    std::string _option_xdp_interface;
+    int _option_xdp_queue;
+    CppCommon::Timespan _option_session_timeout;
+    bool _option_multiple_sockets;
+
+    //! Open the given socket
+    /*!
+        \param socket - Socket to open
+    */
+    void OpenSocket(asio::ip::udp::socket& socket);
 
     //! Try to receive new datagram
     void TryReceive();
+    //! Try to receive new batch of datagrams
+    void TryReceiveBatch();
+    //! Try to receive new buffer of segmented datagrams
+    void TryReceiveSegments();
+    //! Try to receive new datagram with its receive timestamp
+    void TryReceiveTimestamped();
+    //! Try to receive new batch of datagrams with the AF_XDP transport
+    void TryReceiveXdp();
+    //! Try to receive transmit timestamps from the socket error queue
+    void TryReceiveTransmitTimestamps();
+    //! Try to send the pending batch of datagrams
+    void TrySendBatch();
+    //! Try to send the pending segmented buffer
+    void TrySendSegments();
+    //! Send datagrams with the AF_XDP transport and the rest with the socket (non-blocking)
+    /*!
+        \param datagrams - Datagrams array to send
+        \param count - Count of datagrams to send
+        \param ec - Error code
+        \return Count of sent datagrams
+    */
+    size_t SendDatagrams(const UDPDatagram* datagrams, size_t count, asio::error_code& ec);
+    //! Queue datagram into the send queue
+    /*!
+        \param endpoint - Endpoint to send
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return 'true' if the datagram was successfully queued, 'false' if the datagram was dropped
+    */
+    bool SendQueued(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size);
+    //! Try to send the send queue
+    void TrySendQueue();
+    //! Send datagrams of the flush batch allowed by the pacer
+    /*!
+        \param first - Index of the first datagram to send
+        \param count - Count of pending datagrams
+        \param ec - Error code
+        \return Count of sent datagrams
+    */
+    size_t SendPaced(size_t first, size_t count, asio::error_code& ec);
+    //! Wait for the pacing delay and continue sending the send queue
+    /*!
+        \param delay - Pacing delay in nanoseconds
+    */
+    void TrySendPaced(uint64_t delay);
+    //! Try to receive new datagram with the given additional receiver
+    /*!
+        \param receiver - Additional receiver
+    */
+    void TryReceive(std::shared_ptr<Receiver> receiver);
+
+    //! Find the session slot with a given peer endpoint
+    /*!
+        \param endpoint - Peer endpoint
+        \return Slot of the session with a given peer endpoint or the empty slot
+    */
+    size_t FindSessionSlot(const asio::ip::udp::endpoint& endpoint) const;
+    //! Register a new session or find the registered one
+    /*!
+        \param endpoint - Peer endpoint
+        \return Registered session or null if sessions are not created
+    */
+    std::shared_ptr<UDPSession> RegisterSession(const asio::ip::udp::endpoint& endpoint);
+    //! Unregister the given session
+    /*!
+        \param session - Session to unregister
+    */
+    void UnregisterSession(const std::shared_ptr<UDPSession>& session);
+    //! Dispatch the received datagram to the session
+    void DispatchReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size);
+    //! Dispatch the sent datagram notification to the session
+    void DispatchSent(const asio::ip::udp::endpoint& endpoint, size_t sent);
+    //! Disconnect idle sessions
+    void ExpireSessions();
 
     //! Clear send/receive buffers
     void ClearBuffers();
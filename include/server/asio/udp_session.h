@@ -0,0 +1,242 @@
+/*!
+    \file udp_session.h
+    \brief UDP session definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_UDP_SESSION_H
+#define CPPSERVER_ASIO_UDP_SESSION_H
+
+#include "service.h"
+
+#include "system/uuid.h"
+
+namespace CppServer {
+namespace Asio {
+
+class UDPServer;
+
+//! UDP session
+/*!
+    UDP session is a virtual session of the UDP server for the single peer
+    endpoint. Sessions are created by the server for each new endpoint which
+    sends a datagram, and are disconnected after the idle timeout without
+    received datagrams.
+
+    Datagrams are sent with the main server socket by default. Hot peers
+    might open a dedicated connected UDP socket which skips the route lookup
+    and the endpoint demultiplexing for each datagram.
+
+    Thread-safe.
+*/
+class UDPSession : public std::enable_shared_from_this<UDPSession>
+{
+    friend class UDPServer;
+
+public:
+    //! Initialize the session with a given server and peer endpoint
+    /*!
+        \param server - Connected server
+        \param endpoint - Peer endpoint
+    */
+    UDPSession(std::shared_ptr<UDPServer> server, const asio::ip::udp::endpoint& endpoint);
+    UDPSession(const UDPSession&) = delete;
+    UDPSession(UDPSession&&) = delete;
+    virtual ~UDPSession() = default;
+
+    UDPSession& operator=(const UDPSession&) = delete;
+    UDPSession& operator=(UDPSession&&) = delete;
+
+    //! Get the session Id
+    const CppCommon::UUID& id() const noexcept { return _id; }
+
+    //! Get the server
+    std::shared_ptr<UDPServer>& server() noexcept { return _server; }
+    //! Get the Asio IO service
+    std::shared_ptr<asio::io_service>& io_service() noexcept { return _io_service; }
+    //! Get the Asio service strand for serialized handler execution
+    asio::io_service::strand& strand() noexcept { return _strand; }
+    //! Get the peer endpoint
+    const asio::ip::udp::endpoint& endpoint() const noexcept { return _endpoint; }
+    //! Get the connected session socket
+    asio::ip::udp::socket& socket() noexcept { return _socket; }
+
+    //! Get the number of bytes sent by the session
+    uint64_t bytes_sent() const noexcept { return _bytes_sent; }
+    //! Get the number of bytes received by the session
+    uint64_t bytes_received() const noexcept { return _bytes_received; }
+    //! Get the number datagrams sent by the session
+    uint64_t datagrams_sent() const noexcept { return _datagrams_sent; }
+    //! Get the number datagrams received by the session
+    uint64_t datagrams_received() const noexcept { return _datagrams_received; }
+    //! Get the timestamp of the last received datagram (nanoseconds)
+    uint64_t last_activity() const noexcept { return _last_activity; }
+
+    //! Is the session connected?
+    bool IsConnected() const noexcept { return _connected; }
+    //! Is the session socket connected?
+    bool IsSocketConnected() const noexcept { return _socket_connected; }
+
+    //! Disconnect the session
+    /*!
+        \return 'true' if the section was successfully disconnected, 'false' if the section is already disconnected
+    */
+    virtual bool Disconnect();
+
+    //! Open the dedicated connected socket for the session
+    /*!
+        The connected socket is bound to the server endpoint with SO_REUSEPORT
+        and connected to the peer endpoint, so the OS kernel delivers datagrams
+        of the peer directly to the session socket and sends datagrams with
+        the cached route. The server must be started with the reuse port
+        option (or with multiple sockets), otherwise the method fails with
+        'operation not supported' error.
+
+        Datagrams received with the connected socket are handled with the
+        session Asio service, which might be another working thread than
+        the one that receives datagrams of the server socket.
+
+        The method is supported only on Unix systems.
+
+        \return 'true' if the connected socket was successfully opened, 'false' if the connected socket is not supported
+    */
+    virtual bool ConnectSocket();
+
+    //! Send datagram to the peer (synchronous)
+    /*!
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const void* buffer, size_t size);
+    //! Send text to the peer (synchronous)
+    /*!
+        \param text - Text to send
+        \return Size of sent datagram
+    */
+    virtual size_t Send(const std::string_view& text) { return Send(text.data(), text.size()); }
+
+    //! Send datagram to the peer (asynchronous)
+    /*!
+        Without the connected socket the datagram is sent with the server
+        'SendAsync()' method (and its send queue if enabled). With the
+        connected socket the method fails while another datagram is sending.
+
+        \param buffer - Datagram buffer to send
+        \param size - Datagram buffer size
+        \return 'true' if the datagram was successfully sent, 'false' if the datagram was not sent
+    */
+    virtual bool SendAsync(const void* buffer, size_t size);
+    //! Send text to the peer (asynchronous)
+    /*!
+        \param text - Text to send
+        \return 'true' if the text was successfully sent, 'false' if the text was not sent
+    */
+    virtual bool SendAsync(const std::string_view& text) { return SendAsync(text.data(), text.size()); }
+
+protected:
+    //! Handle session connected notification
+    virtual void onConnected() {}
+    //! Handle session disconnected notification
+    virtual void onDisconnected() {}
+
+    //! Handle datagram received notification
+    /*!
+        Notification is called when another datagram was received from
+        the peer. It might be called from different working threads in
+        the multiple sockets mode of the server.
+
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    virtual void onReceived(const void* buffer, size_t size) {}
+    //! Handle raw datagram received notification
+    /*!
+        Notification is called for each received datagram before any
+        datagram processing. Protocol sessions (e.g. reliable UDP) might
+        override it to decode datagrams into messages.
+
+        Default implementation calls 'onReceived()' handler.
+
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    virtual void onReceivedDatagram(const void* buffer, size_t size) { onReceived(buffer, size); }
+    //! Handle datagram sent notification
+    /*!
+        \param sent - Size of sent datagram buffer
+    */
+    virtual void onSent(size_t sent) {}
+
+    //! Handle error notification
+    /*!
+        \param error - Error code
+        \param category - Error category
+        \param message - Error message
+    */
+    virtual void onError(int error, const std::string& category, const std::string& message) {}
+
+private:
+    // Session Id
+    CppCommon::UUID _id;
+    // Session server & endpoint
+    std::shared_ptr<UDPServer> _server;
+    asio::ip::udp::endpoint _endpoint;
+    // Asio IO service
+    std::shared_ptr<asio::io_service> _io_service;
+    // Asio service strand for serialized handler execution
+    asio::io_service::strand _strand;
+    bool _strand_required;
+    // Session connected socket
+    asio::ip::udp::socket _socket;
+    std::atomic<bool> _connected;
+    std::atomic<bool> _socket_connected;
+    // Session statistic
+    std::atomic<uint64_t> _bytes_sent;
+    std::atomic<uint64_t> _bytes_received;
+    std::atomic<uint64_t> _datagrams_sent;
+    std::atomic<uint64_t> _datagrams_received;
+    std::atomic<uint64_t> _last_activity;
+    // Receive buffer
+    bool _receiving;
+    std::vector<uint8_t> _receive_buffer;
+    HandlerStorage _receive_storage;
+    // Send buffer
+    std::atomic<bool> _sending;
+    std::vector<uint8_t> _send_buffer;
+    HandlerStorage _send_storage;
+
+    //! Connect the session
+    void Connect();
+    //! Disconnect the session
+    /*!
+        \param dispatch - Dispatch flag
+        \return 'true' if the session was successfully disconnected, 'false' if the session is already disconnected
+    */
+    bool Disconnect(bool dispatch);
+
+    //! Handle the received datagram
+    /*!
+        \param buffer - Received datagram buffer
+        \param size - Received datagram buffer size
+    */
+    void Received(const void* buffer, size_t size);
+    //! Handle the sent datagram
+    /*!
+        \param sent - Size of sent datagram buffer
+    */
+    void Sent(size_t sent);
+
+    //! Try to receive new datagram with the connected socket
+    void TryReceive();
+
+    //! Send error notification
+    void SendError(std::error_code ec);
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_UDP_SESSION_H
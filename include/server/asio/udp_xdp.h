@@ -0,0 +1,158 @@
+/*!
+    \file udp_xdp.h
+    \brief UDP AF_XDP transport definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPSERVER_ASIO_UDP_XDP_H
+#define CPPSERVER_ASIO_UDP_XDP_H
+
+#include "udp_batch.h"
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace CppServer {
+namespace Asio {
+
+//! UDP AF_XDP transport
+/*!
+    UDP AF_XDP transport bypasses the OS network stack for IPv4 UDP datagrams
+    of the given port on the given network interface queue. The XDP program
+    attached to the interface in generic (SKB) mode redirects matching frames
+    into the AF_XDP socket, which shares the UMEM frames area with the user
+    space through the fill/RX and TX/completion rings. Received datagrams are
+    parsed in place without copying.
+
+    Generic mode works with any network driver (e.g. veth pairs), the native
+    driver mode is not used. Frames with IP options, IP fragments and IPv6
+    are left to the OS network stack.
+
+    Datagrams are transmitted only to endpoints with the known link layer
+    address: multicast groups and clients seen by the receive path. Other
+    datagrams should be sent with the regular socket.
+
+    Only Linux is supported, 'Open()' fails on other platforms.
+
+    Receive methods should be called from a single thread. Send method is
+    thread-safe.
+*/
+class UDPXdp
+{
+public:
+    //! Frame size of the UMEM frames area
+    static const size_t FRAME_SIZE = 2048;
+    //! Size of Ethernet, IPv4 and UDP headers
+    static const size_t HEADERS_SIZE = 42;
+
+    UDPXdp() noexcept;
+    UDPXdp(const UDPXdp&) = delete;
+    UDPXdp(UDPXdp&&) = delete;
+    ~UDPXdp() { Close(); }
+
+    UDPXdp& operator=(const UDPXdp&) = delete;
+    UDPXdp& operator=(UDPXdp&&) = delete;
+
+    //! Get the native AF_XDP socket handle (-1 if not opened)
+    int native_handle() const noexcept { return _socket; }
+
+    //! Get the number of datagrams received with the AF_XDP socket
+    uint64_t datagrams_received() const noexcept { return _datagrams_received; }
+    //! Get the number of datagrams sent with the AF_XDP socket
+    uint64_t datagrams_sent() const noexcept { return _datagrams_sent; }
+
+    //! Is the AF_XDP transport supported?
+    static bool IsSupported() noexcept;
+
+    //! Is the AF_XDP socket opened?
+    bool IsOpened() const noexcept { return _socket >= 0; }
+
+    //! Open the AF_XDP socket and attach the XDP program to the network interface queue
+    /*!
+        \param interface - Network interface name
+        \param queue - Network interface queue
+        \param port - UDP port to redirect into the AF_XDP socket
+        \param frames - Count of UMEM frames (half for receive, half for transmit, default is 4096)
+        \param ec - Error code
+        \return 'true' if the AF_XDP socket was successfully opened, 'false' if the AF_XDP transport is not available
+    */
+    bool Open(const std::string& interface, int queue, int port, size_t frames, asio::error_code& ec);
+    //! Detach the XDP program and close the AF_XDP socket
+    void Close() noexcept;
+
+    //! Receive a batch of datagrams (non-blocking)
+    /*!
+        Received datagrams point into the UMEM frames and stay valid until
+        'Release()' is called.
+
+        \param datagrams - Received datagrams array of 'count' entries
+        \param count - Maximal count of datagrams to receive
+        \return Count of received datagrams
+    */
+    size_t Receive(UDPDatagram* datagrams, size_t count);
+    //! Release frames of received datagrams back to the fill ring
+    void Release();
+
+    //! Send a batch of datagrams (non-blocking)
+    /*!
+        Datagrams are sent in order and sending stops on the first datagram
+        which could not be sent: the endpoint link layer address is unknown,
+        the datagram does not fit into the frame or the TX ring is full.
+
+        \param datagrams - Datagrams array to send
+        \param count - Count of datagrams to send
+        \param ec - Error code
+        \return Count of sent datagrams
+    */
+    size_t Send(const UDPDatagram* datagrams, size_t count, asio::error_code& ec);
+
+private:
+    // Memory mapped ring
+    struct Ring
+    {
+        uint32_t* producer;
+        uint32_t* consumer;
+        void* descriptors;
+        uint32_t size;
+        void* map;
+        size_t map_size;
+    };
+
+    int _socket;
+    int _program;
+    int _map;
+    int _link;
+    uint16_t _port;
+    // UMEM frames area and rings
+    uint8_t* _umem;
+    size_t _umem_size;
+    size_t _frames;
+    Ring _fill;
+    Ring _completion;
+    Ring _rx;
+    Ring _tx;
+    uint32_t _rx_peeked;
+    // Interface link layer and network addresses
+    std::array<uint8_t, 6> _mac;
+    uint32_t _address;
+    // Link layer addresses of seen clients
+    std::mutex _tx_lock;
+    std::unordered_map<uint32_t, std::array<uint8_t, 6>> _neighbors;
+    std::vector<uint64_t> _tx_frames;
+    // Statistic
+    uint64_t _datagrams_received;
+    uint64_t _datagrams_sent;
+
+    //! Reclaim transmitted frames from the completion ring
+    void Complete();
+};
+
+} // namespace Asio
+} // namespace CppServer
+
+#endif // CPPSERVER_ASIO_UDP_XDP_H
@@ -0,0 +1,157 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/dtls_server.h"
+#include "server/asio/service.h"
+#include "system/cpu.h"
+
+#include <iostream>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+class EchoSession : public DTLSSession
+{
+public:
+    using DTLSSession::DTLSSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Resend the message back to the client
+        SendAsync(buffer, size);
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Session caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+class EchoServer : public DTLSServer
+{
+public:
+    using DTLSServer::DTLSServer;
+
+protected:
+    std::shared_ptr<DTLSSession> CreateSession(std::shared_ptr<DTLSServer> server, const asio::ip::udp::endpoint& endpoint) override
+    {
+        return std::make_shared<EchoSession>(server, endpoint);
+    }
+
+protected:
+    void onStarted() override
+    {
+        // Start receive datagrams
+        ReceiveAsync();
+    }
+
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override
+    {
+        // Dispatch the datagram to the DTLS session
+        DTLSServer::onReceived(endpoint, buffer, size);
+
+        // Continue receive datagrams
+        ReceiveAsync();
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(3333).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-b", "--batch").dest("batch").action("store").type("int").set_default(1).help("Count of datagrams received in a batch (1 - no batching). Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Server port
+    int port = options.get("port");
+    int threads = options.get("threads");
+    int batch = options.get("batch");
+
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads << std::endl;
+    std::cout << "Receive batch: " << batch << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create and prepare a new DTLS server context
+    auto context = std::make_shared<SSLContext>(SSL_CTX_new(DTLS_server_method()));
+    context->set_password_callback([](size_t max_length, asio::ssl::context::password_purpose purpose) -> std::string { return "qwerty"; });
+    context->use_certificate_chain_file("../tools/certificates/server.pem");
+    context->use_private_key_file("../tools/certificates/server.pem", asio::ssl::context::pem);
+
+    // Create a new echo server
+    auto server = std::make_shared<EchoServer>(service, context, port);
+    server->SetupReuseAddress(true);
+    server->SetupReusePort(true);
+    server->SetupReceiveBatch(batch);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Press Enter to stop the server or '!' to restart the server..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        // Restart the server
+        if (line == "!")
+        {
+            std::cout << "Server restarting...";
+            server->Restart();
+            std::cout << "Done!" << std::endl;
+            continue;
+        }
+    }
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Cookies sent: " << server->cookies_sent() << std::endl;
+    std::cout << "Cookies verified: " << server->cookies_verified() << std::endl;
+    std::cout << "Handshakes: " << server->handshakes() << std::endl;
+    std::cout << "Failed handshakes: " << server->handshakes_failed() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,290 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/ssl_client.h"
+#include "server/asio/ssl_server.h"
+#include "server/asio/tcp_client.h"
+#include "server/asio/tcp_server.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::atomic<uint64_t> total_errors(0);
+
+// Resident memory of the current process
+uint64_t ResidentMemory()
+{
+#if defined(__linux__)
+    uint64_t size = 0;
+    uint64_t resident = 0;
+    std::ifstream statm("/proc/self/statm");
+    statm >> size >> resident;
+    return resident * (uint64_t)sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+class TCPEchoSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+    void onError(int error, const std::string& category, const std::string& message) override { ++total_errors; }
+};
+
+class TCPEchoServer : public TCPServer
+{
+public:
+    using TCPServer::TCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(std::shared_ptr<TCPServer> server) override { return std::make_shared<TCPEchoSession>(server); }
+    void onError(int error, const std::string& category, const std::string& message) override { ++total_errors; }
+};
+
+class TCPIdleClient : public TCPClient
+{
+public:
+    using TCPClient::TCPClient;
+
+protected:
+    void onConnected() override { SendAsync("ping"); }
+    void onError(int error, const std::string& category, const std::string& message) override { ++total_errors; }
+};
+
+class SSLEchoSession : public SSLSession
+{
+public:
+    using SSLSession::SSLSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+    void onError(int error, const std::string& category, const std::string& message) override { ++total_errors; }
+};
+
+class SSLEchoServer : public SSLServer
+{
+public:
+    using SSLServer::SSLServer;
+
+protected:
+    std::shared_ptr<SSLSession> CreateSession(std::shared_ptr<SSLServer> server) override { return std::make_shared<SSLEchoSession>(server); }
+    void onError(int error, const std::string& category, const std::string& message) override { ++total_errors; }
+};
+
+class SSLIdleClient : public SSLClient
+{
+public:
+    using SSLClient::SSLClient;
+
+protected:
+    void onHandshaked() override { SendAsync("ping"); }
+    void onError(int error, const std::string& category, const std::string& message) override { ++total_errors; }
+};
+
+// Connect idle clients and return the resident memory with all of them connected
+template <class TClient, class TContext>
+uint64_t ConnectIdleClients(std::vector<std::shared_ptr<TClient>>& clients, const std::shared_ptr<Service>& service, const TContext& context, const std::string& address, int port, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        std::shared_ptr<TClient> client;
+        if constexpr (std::is_same_v<TClient, SSLIdleClient>)
+            client = std::make_shared<TClient>(service, context, address, port);
+        else
+            client = std::make_shared<TClient>(service, address, port);
+        client->ConnectAsync();
+        clients.emplace_back(client);
+    }
+
+    // Wait for all echoed messages
+    for (auto& client : clients)
+        while (client->bytes_received() != 4)
+            Thread::Yield();
+
+    return ResidentMemory();
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(2222).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-c", "--clients").dest("clients").action("store").type("int").set_default(1000).help("Count of idle clients. Default: %default");
+    parser.add_option("-m", "--mode").dest("mode").set_default("ssl").help("Connection mode (tcp, ssl). Default: %default");
+    parser.add_option("-i", "--idle-release").dest("idle_release").action("store").type("int").set_default(0).help("Idle release interval of SSL sessions in milliseconds (0 - disabled). Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int threads_count = options.get("threads");
+    int clients_count = options.get("clients");
+    std::string mode(options.get("mode"));
+    int idle_release = options.get("idle_release");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Idle clients: " << clients_count << std::endl;
+    std::cout << "Connection mode: " << mode << std::endl;
+    if (mode == "ssl")
+        std::cout << "Idle release interval: " << idle_release << " ms" << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads_count);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    uint64_t memory_start = ResidentMemory();
+    uint64_t memory_connected = 0;
+    uint64_t memory_idle = 0;
+
+    if (mode == "tcp")
+    {
+        // Create and start a new echo server
+        auto server = std::make_shared<TCPEchoServer>(service, port);
+        server->SetupReuseAddress(true);
+        std::cout << "Server starting...";
+        server->Start();
+        while (!server->IsStarted())
+            Thread::Yield();
+        std::cout << "Done!" << std::endl;
+
+        // Connect idle clients
+        std::cout << "Clients connecting...";
+        std::vector<std::shared_ptr<TCPIdleClient>> clients;
+        memory_connected = ConnectIdleClients(clients, service, nullptr, address, port, clients_count);
+        memory_idle = memory_connected;
+        std::cout << "Done!" << std::endl;
+
+        // Disconnect idle clients
+        std::cout << "Clients disconnecting...";
+        for (auto& client : clients)
+            client->DisconnectAsync();
+        while (server->connected_sessions() != 0)
+            Thread::Yield();
+        std::cout << "Done!" << std::endl;
+
+        // Stop the server
+        std::cout << "Server stopping...";
+        server->Stop();
+        while (server->IsStarted())
+            Thread::Yield();
+        std::cout << "Done!" << std::endl;
+    }
+    else
+    {
+        // Create and prepare a new SSL server context
+        auto server_context = std::make_shared<SSLContext>(asio::ssl::context::tlsv12);
+        server_context->set_password_callback([](size_t max_length, asio::ssl::context::password_purpose purpose) -> std::string { return "qwerty"; });
+        server_context->use_certificate_chain_file("../tools/certificates/server.pem");
+        server_context->use_private_key_file("../tools/certificates/server.pem", asio::ssl::context::pem);
+        server_context->use_tmp_dh_file("../tools/certificates/dh4096.pem");
+
+        // Create and start a new echo server
+        auto server = std::make_shared<SSLEchoServer>(service, server_context, port);
+        server->SetupReuseAddress(true);
+        server->SetupIdleRelease(Timespan::milliseconds(idle_release));
+        std::cout << "Server starting...";
+        server->Start();
+        while (!server->IsStarted())
+            Thread::Yield();
+        std::cout << "Done!" << std::endl;
+
+        // Create and prepare a new SSL client context
+        auto client_context = std::make_shared<SSLContext>(asio::ssl::context::tlsv12);
+        client_context->set_default_verify_paths();
+        client_context->set_root_certs();
+        client_context->set_verify_mode(asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert);
+        client_context->load_verify_file("../tools/certificates/ca.pem");
+
+        // Connect idle clients
+        std::cout << "Clients connecting...";
+        std::vector<std::shared_ptr<SSLIdleClient>> clients;
+        memory_connected = ConnectIdleClients(clients, service, client_context, address, port, clients_count);
+        std::cout << "Done!" << std::endl;
+
+        // Wait for idle sessions
+        if (idle_release > 0)
+        {
+            std::cout << "Sessions idling...";
+            while (server->sessions_idle() != (uint64_t)clients_count)
+                Thread::Yield();
+            std::cout << "Done!" << std::endl;
+        }
+        memory_idle = ResidentMemory();
+
+        // Disconnect idle clients
+        std::cout << "Clients disconnecting...";
+        for (auto& client : clients)
+            client->DisconnectAsync();
+        while (server->connected_sessions() != 0)
+            Thread::Yield();
+        std::cout << "Done!" << std::endl;
+
+        // Stop the server
+        std::cout << "Server stopping...";
+        server->Stop();
+        while (server->IsStarted())
+            Thread::Yield();
+        std::cout << "Done!" << std::endl;
+    }
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+
+    std::cout << std::endl;
+
+    // Memory of both connection sides (session and client) in the same process
+    std::cout << "Resident memory at start: " << memory_start / 1024 << " KiB" << std::endl;
+    std::cout << "Resident memory of connected clients: " << memory_connected / 1024 << " KiB" << std::endl;
+    std::cout << "Resident memory of idle clients: " << memory_idle / 1024 << " KiB" << std::endl;
+    if (clients_count > 0)
+    {
+        std::cout << "Memory per connection: " << (int64_t)(memory_connected - memory_start) / clients_count << " bytes" << std::endl;
+        std::cout << "Memory per idle connection: " << (int64_t)(memory_idle - memory_start) / clients_count << " bytes" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,312 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/connection_pool.h"
+#include "server/asio/service.h"
+#include "server/asio/ssl_server.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::vector<uint8_t> message_to_send;
+
+std::atomic<uint64_t> total_errors(0);
+std::atomic<uint64_t> total_calls(0);
+std::atomic<uint64_t> total_failed(0);
+std::atomic<uint64_t> total_latency(0);
+std::atomic<int> active_callers(0);
+
+class EchoSession : public SSLSession
+{
+public:
+    using SSLSession::SSLSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Resend the message back to the client
+        SendAsync(buffer, size);
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Session caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class EchoServer : public SSLServer
+{
+public:
+    using SSLServer::SSLServer;
+
+protected:
+    std::shared_ptr<SSLSession> CreateSession(std::shared_ptr<SSLServer> server) override
+    {
+        return std::make_shared<EchoSession>(server);
+    }
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class CallClient : public PooledSSLClient
+{
+public:
+    using PooledSSLClient::PooledSSLClient;
+
+    // Send the call message and invoke the completion handler with the echo
+    void Call(const std::function<void(bool)>& completion)
+    {
+        _received = 0;
+        _completion = completion;
+        SendAsync(message_to_send.data(), message_to_send.size());
+    }
+
+protected:
+    void onDisconnected() override
+    {
+        PooledSSLClient::onDisconnected();
+
+        // Fail the pending call
+        Complete(false);
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        _received += size;
+        if (_received >= message_to_send.size())
+            Complete(true);
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Client caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+
+private:
+    size_t _received{0};
+    std::function<void(bool)> _completion;
+
+    void Complete(bool success)
+    {
+        auto completion = std::move(_completion);
+        _completion = nullptr;
+        if (completion)
+            completion(success);
+    }
+};
+
+class CallPool : public ConnectionPool<CallClient>
+{
+public:
+    CallPool(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context)
+        : ConnectionPool<CallClient>(service),
+          _context(context)
+    {
+    }
+
+protected:
+    std::shared_ptr<CallClient> CreateClient(std::shared_ptr<Service> service, const asio::ip::tcp::endpoint& endpoint) override
+    {
+        return std::make_shared<CallClient>(service, _context, endpoint);
+    }
+
+private:
+    std::shared_ptr<SSLContext> _context;
+};
+
+// Perform calls one by one with connections checked out of the pool
+void Call(std::shared_ptr<CallPool> pool, const asio::ip::tcp::endpoint& endpoint, int calls)
+{
+    if (calls <= 0)
+    {
+        --active_callers;
+        return;
+    }
+
+    uint64_t timestamp = Timestamp::nano();
+    pool->CheckoutAsync(endpoint, [pool, endpoint, calls, timestamp](std::shared_ptr<CallClient> client)
+    {
+        if (client == nullptr)
+        {
+            ++total_failed;
+            Call(pool, endpoint, calls - 1);
+            return;
+        }
+
+        client->Call([pool, endpoint, calls, timestamp, client](bool success)
+        {
+            if (success)
+            {
+                total_latency += Timestamp::nano() - timestamp;
+                ++total_calls;
+            }
+            else
+                ++total_failed;
+
+            pool->Return(client);
+            Call(pool, endpoint, calls - 1);
+        });
+    });
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(2222).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-c", "--callers").dest("callers").action("store").type("int").set_default(100).help("Count of concurrent callers. Default: %default");
+    parser.add_option("-n", "--calls").dest("calls").action("store").type("int").set_default(100000).help("Count of calls to perform. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+    parser.add_option("--min").dest("min").action("store").type("int").set_default(0).help("Minimal count of pooled connections. Default: %default");
+    parser.add_option("--max").dest("max").action("store").type("int").set_default(16).help("Maximal count of pooled connections. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int threads_count = options.get("threads");
+    int callers_count = options.get("callers");
+    int calls_count = options.get("calls");
+    int message_size = options.get("size");
+    int min_connections = options.get("min");
+    int max_connections = options.get("max");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Concurrent callers: " << callers_count << std::endl;
+    std::cout << "Calls to perform: " << calls_count << std::endl;
+    std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Pooled connections: " << min_connections << "-" << max_connections << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare a message to send
+    message_to_send.resize(message_size, 0);
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads_count);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create and prepare a new SSL server context
+    auto server_context = std::make_shared<SSLContext>(asio::ssl::context::tlsv12);
+    server_context->set_password_callback([](size_t max_length, asio::ssl::context::password_purpose purpose) -> std::string { return "qwerty"; });
+    server_context->use_certificate_chain_file("../tools/certificates/server.pem");
+    server_context->use_private_key_file("../tools/certificates/server.pem", asio::ssl::context::pem);
+    server_context->use_tmp_dh_file("../tools/certificates/dh4096.pem");
+
+    // Create a new echo server
+    auto server = std::make_shared<EchoServer>(service, server_context, port);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create and prepare a new SSL client context
+    auto client_context = std::make_shared<SSLContext>(asio::ssl::context::tlsv12);
+    client_context->set_default_verify_paths();
+    client_context->set_root_certs();
+    client_context->set_verify_mode(asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert);
+    client_context->load_verify_file("../tools/certificates/ca.pem");
+
+    // Create and start a new connection pool
+    asio::ip::tcp::endpoint endpoint(asio::ip::make_address(address), (unsigned short)port);
+    auto pool = std::make_shared<CallPool>(service, client_context);
+    pool->SetupConnections(min_connections, max_connections);
+    pool->Start();
+
+    // Warmup the minimal count of connections
+    std::cout << "Pool warming up...";
+    pool->Warmup(endpoint);
+    while (pool->idle_connections() < (size_t)min_connections)
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    uint64_t timestamp_start = Timestamp::nano();
+
+    // Perform calls
+    std::cout << "Processing...";
+    active_callers = callers_count;
+    for (int i = 0; i < callers_count; ++i)
+        Call(pool, endpoint, (calls_count / callers_count) + ((i < (calls_count % callers_count)) ? 1 : 0));
+    while (active_callers > 0)
+        Thread::Sleep(100);
+    std::cout << "Done!" << std::endl;
+
+    uint64_t timestamp_stop = Timestamp::nano();
+
+    // Stop the connection pool
+    std::cout << "Pool stopping...";
+    pool->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+    std::cout << "Failed calls: " << total_failed << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total calls: " << total_calls << std::endl;
+    if (total_calls > 0)
+    {
+        std::cout << "Call latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(total_latency / total_calls) << std::endl;
+        std::cout << "Call throughput: " << total_calls * 1000000000 / (timestamp_stop - timestamp_start) << " calls/s" << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    std::cout << "Pool checkouts: " << pool->checkouts() << std::endl;
+    std::cout << "Pool hit rate: " << pool->hit_rate() * 100.0 << "%" << std::endl;
+    std::cout << "Pool connects: " << pool->connects() << std::endl;
+    std::cout << "Pool failed connects: " << pool->connects_failed() << std::endl;
+    std::cout << "Pool wait time (avg): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(pool->wait_time_avg().total()) << std::endl;
+    std::cout << "Pool wait time (max): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(pool->wait_time_max().total()) << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/ssl_client.h"
+#include "server/asio/ssl_server.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::vector<uint8_t> message_to_send;
+
+std::atomic<uint64_t> total_errors(0);
+std::atomic<uint64_t> total_requests(0);
+std::atomic<uint64_t> total_early(0);
+std::atomic<uint64_t> total_latency(0);
+
+class EchoSession : public SSLSession
+{
+public:
+    using SSLSession::SSLSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Resend the message back to the client
+        SendAsync(buffer, size);
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Session caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class EchoServer : public SSLServer
+{
+public:
+    using SSLServer::SSLServer;
+
+protected:
+    std::shared_ptr<SSLSession> CreateSession(std::shared_ptr<SSLServer> server) override
+    {
+        return std::make_shared<EchoSession>(server);
+    }
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class RequestClient : public SSLClient
+{
+public:
+    RequestClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, int port, int requests)
+        : SSLClient(service, context, address, port),
+          _requests(requests),
+          _received(0),
+          _timestamp(0),
+          _done(false)
+    {
+    }
+
+    bool done() const noexcept { return _done; }
+
+    void Request()
+    {
+        _received = 0;
+        _timestamp = Timestamp::nano();
+
+        // Queue the request to send it as early data with the resumed session
+        if (option_early_data())
+            SendAsync(message_to_send.data(), message_to_send.size());
+
+        ConnectAsync();
+    }
+
+protected:
+    void onHandshaked() override
+    {
+        // Send the request after the handshake
+        if (!option_early_data())
+            SendAsync(message_to_send.data(), message_to_send.size());
+    }
+
+    void onDisconnected() override
+    {
+        // Reconnect with the last session
+        if (--_requests > 0)
+            Request();
+        else
+            _done = true;
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        _received += size;
+        if (_received >= message_to_send.size())
+        {
+            // Update the time to the first response
+            ++total_requests;
+            total_latency += Timestamp::nano() - _timestamp;
+            if (IsEarlyDataAccepted())
+                ++total_early;
+
+            DisconnectAsync();
+        }
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Client caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+
+private:
+    int _requests;
+    size_t _received;
+    uint64_t _timestamp;
+    std::atomic<bool> _done;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(2222).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-c", "--clients").dest("clients").action("store").type("int").set_default(100).help("Count of working clients. Default: %default");
+    parser.add_option("-n", "--requests").dest("requests").action("store").type("int").set_default(10000).help("Count of requests to perform, one per connection. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single request size. Default: %default");
+    parser.add_option("-e", "--early-data").dest("early_data").action("store_true").help("Send requests as TLS 1.3 early data");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int threads_count = options.get("threads");
+    int clients_count = options.get("clients");
+    int requests_count = options.get("requests");
+    int message_size = options.get("size");
+    bool early_data = options.get("early_data");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Working clients: " << clients_count << std::endl;
+    std::cout << "Requests to perform: " << requests_count << std::endl;
+    std::cout << "Request size: " << message_size << std::endl;
+    std::cout << "Early data: " << (early_data ? "enabled" : "disabled") << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare a message to send
+    message_to_send.resize(message_size, 0);
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads_count);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create and prepare a new TLS 1.3 server context with the session cache required for early data
+    auto server_context = std::make_shared<SSLContext>(asio::ssl::context::tlsv13);
+    server_context->set_password_callback([](size_t max_length, asio::ssl::context::password_purpose purpose) -> std::string { return "qwerty"; });
+    server_context->use_certificate_chain_file("../tools/certificates/server.pem");
+    server_context->use_private_key_file("../tools/certificates/server.pem", asio::ssl::context::pem);
+    server_context->use_tmp_dh_file("../tools/certificates/dh4096.pem");
+    server_context->set_session_cache(clients_count * 4);
+
+    // Create a new echo server
+    auto server = std::make_shared<EchoServer>(service, server_context, port);
+    server->SetupEarlyData(early_data ? 16384 : 0);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    while (!server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Create and prepare a new TLS 1.3 client context
+    auto client_context = std::make_shared<SSLContext>(asio::ssl::context::tlsv13);
+    client_context->set_default_verify_paths();
+    client_context->set_root_certs();
+    client_context->set_verify_mode(asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert);
+    client_context->load_verify_file("../tools/certificates/ca.pem");
+
+    // Create request clients
+    std::vector<std::shared_ptr<RequestClient>> clients;
+    for (int i = 0; i < clients_count; ++i)
+    {
+        auto client = std::make_shared<RequestClient>(service, client_context, address, port, requests_count / clients_count);
+        client->SetupEarlyData(early_data);
+        clients.emplace_back(client);
+    }
+
+    uint64_t timestamp_start = Timestamp::nano();
+
+    // Perform requests
+    std::cout << "Requesting...";
+    for (auto& client : clients)
+        client->Request();
+    for (auto& client : clients)
+        while (!client->done())
+            Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    uint64_t timestamp_stop = Timestamp::nano();
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    while (server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total requests: " << total_requests << std::endl;
+    std::cout << "Requests sent as early data: " << total_early << std::endl;
+    std::cout << "Server resumed handshakes: " << server->handshakes_resumed() << std::endl;
+    std::cout << "Server accepted early data: " << server->early_data_accepted() << std::endl;
+    std::cout << "Server rejected early data: " << server->early_data_rejected() << std::endl;
+    if (total_requests > 0)
+    {
+        std::cout << "Time to first response: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(total_latency / total_requests) << std::endl;
+        std::cout << "Request throughput: " << total_requests * 1000000000 / (timestamp_stop - timestamp_start) << " requests/s" << std::endl;
+    }
+
+    return 0;
+}
@@ -4,6 +4,7 @@
 
 #include "server/asio/service.h"
 #include "server/asio/ssl_client.h"
+#include "server/asio/ssl_ktls.h"
 
 #include "benchmark/reporter_console.h"
 #include "system/cpu.h"
@@ -27,6 +28,8 @@ std::atomic<uint64_t> timestamp_stop(0);
 std::atomic<uint64_t> total_errors(0);
 std::atomic<uint64_t> total_bytes(0);
 std::atomic<uint64_t> total_messages(0);
+std::atomic<uint64_t> total_socket_reads(0);
+std::atomic<uint64_t> total_socket_writes(0);
 
 class EchoClient : public SSLClient
 {
@@ -95,7 +98,13 @@ private:
     void ReceiveMessage()
     {
         if (--_messages_input == 0)
+        {
+            // Update socket statistic of the memory BIO before the disconnect
+            total_socket_reads += socket_reads();
+            total_socket_writes += socket_writes();
+
             DisconnectAsync();
+        }
     }
 };
 
@@ -109,6 +118,8 @@ int main(int argc, char** argv)
     parser.add_option("-c", "--clients").dest("clients").action("store").type("int").set_default(100).help("Count of working clients. Default: %default");
     parser.add_option("-m", "--messages").dest("messages").action("store").type("int").set_default(1000000).help("Count of messages to send. Default: %default");
     parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+    parser.add_option("-k", "--ktls").dest("ktls").action("store_true").help("Offload the encryption to the kernel TLS");
+    parser.add_option("-b", "--memory-bio").dest("memory_bio").action("store_true").help("Use the memory BIO over pooled buffers instead of Asio SSL stream");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -126,6 +137,8 @@ int main(int argc, char** argv)
     int clients_count = options.get("clients");
     int messages_count = options.get("messages");
     int message_size = options.get("size");
+    bool ktls = options.get("ktls");
+    bool memory_bio = options.get("memory_bio");
 
     std::cout << "Server address: " << address << std::endl;
     std::cout << "Server port: " << port << std::endl;
@@ -133,6 +146,8 @@ int main(int argc, char** argv)
     std::cout << "Working clients: " << clients_count << std::endl;
     std::cout << "Messages to send: " << messages_count << std::endl;
     std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Kernel TLS: " << (ktls ? (SSLKernelStream::IsSupported() ? "enabled" : "not supported") : "disabled") << std::endl;
+    std::cout << "Memory BIO: " << (memory_bio ? "enabled" : "disabled") << std::endl;
 
     std::cout << std::endl;
 
@@ -161,6 +176,8 @@ int main(int argc, char** argv)
         // Create echo client
         auto client = std::make_shared<EchoClient>(service, context, address, port, messages_count / clients_count);
         // client->SetupNoDelay(true);
+        client->SetupKernelTLS(ktls);
+        client->SetupMemoryBIO(memory_bio);
         clients.emplace_back(client);
     }
 
@@ -206,6 +223,11 @@ int main(int argc, char** argv)
     {
         std::cout << "Message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_messages) << std::endl;
         std::cout << "Message throughput: " << total_messages * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+        if (memory_bio)
+        {
+            std::cout << "Socket reads per message: " << (double)total_socket_reads / total_messages << std::endl;
+            std::cout << "Socket writes per message: " << (double)total_socket_writes / total_messages << std::endl;
+        }
     }
 
     return 0;
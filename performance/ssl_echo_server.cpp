@@ -55,6 +55,9 @@ int main(int argc, char** argv)
 
     parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(2222).help("Server port. Default: %default");
     parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-k", "--ktls").dest("ktls").action("store_true").help("Offload the encryption to the kernel TLS");
+    parser.add_option("-d", "--dynamic-records").dest("dynamic_records").action("store_true").help("Send small TLS records to new and idle sessions");
+    parser.add_option("-b", "--memory-bio").dest("memory_bio").action("store_true").help("Use the memory BIO over pooled buffers instead of Asio SSL stream");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -68,9 +71,15 @@ int main(int argc, char** argv)
     // Server port
     int port = options.get("port");
     int threads = options.get("threads");
+    bool ktls = options.get("ktls");
+    bool dynamic_records = options.get("dynamic_records");
+    bool memory_bio = options.get("memory_bio");
 
     std::cout << "Server port: " << port << std::endl;
     std::cout << "Working threads: " << threads << std::endl;
+    std::cout << "Kernel TLS: " << (ktls ? (SSLKernelStream::IsSupported() ? "enabled" : "not supported") : "disabled") << std::endl;
+    std::cout << "Dynamic TLS records: " << (dynamic_records ? "enabled" : "disabled") << std::endl;
+    std::cout << "Memory BIO: " << (memory_bio ? "enabled" : "disabled") << std::endl;
 
     std::cout << std::endl;
 
@@ -92,6 +101,9 @@ int main(int argc, char** argv)
     // Create a new echo server
     auto server = std::make_shared<EchoServer>(service, context, port);
     // server->SetupNoDelay(true);
+    server->SetupKernelTLS(ktls);
+    server->SetupDynamicRecords(dynamic_records);
+    server->SetupMemoryBIO(memory_bio);
     server->SetupReuseAddress(true);
     server->SetupReusePort(true);
 
@@ -119,6 +131,27 @@ int main(int argc, char** argv)
         }
     }
 
+    // Print TLS records statistic
+    if (dynamic_records)
+    {
+        std::cout << "TLS records sent: " << server->records_sent() << std::endl;
+        std::cout << "TLS records full: " << server->records_full() << std::endl;
+        std::cout << "TLS records coalesced: " << server->records_coalesced() << std::endl;
+        if (server->records_sent() > 0)
+            std::cout << "TLS record average size: " << server->bytes_sent() / server->records_sent() << std::endl;
+    }
+
+    // Print socket statistic of disconnected sessions
+    if (memory_bio)
+    {
+        std::cout << "Socket reads: " << server->socket_reads() << std::endl;
+        std::cout << "Socket writes: " << server->socket_writes() << std::endl;
+        if (server->socket_reads() > 0)
+            std::cout << "Bytes per socket read: " << server->bytes_received() / server->socket_reads() << std::endl;
+        if (server->socket_writes() > 0)
+            std::cout << "Bytes per socket write: " << server->bytes_sent() / server->socket_writes() << std::endl;
+    }
+
     // Stop the server
     std::cout << "Server stopping...";
     server->Stop();
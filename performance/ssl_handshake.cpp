@@ -0,0 +1,294 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/ssl_client.h"
+#include "server/asio/ssl_server.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::vector<uint8_t> message_to_send;
+
+std::atomic<uint64_t> total_errors(0);
+std::atomic<uint64_t> total_handshakes(0);
+std::atomic<uint64_t> total_resumed(0);
+
+class EchoSession : public SSLSession
+{
+public:
+    using SSLSession::SSLSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Resend the message back to the client
+        SendAsync(buffer, size);
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Session caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class EchoServer : public SSLServer
+{
+public:
+    using SSLServer::SSLServer;
+
+protected:
+    std::shared_ptr<SSLSession> CreateSession(std::shared_ptr<SSLServer> server) override
+    {
+        return std::make_shared<EchoSession>(server);
+    }
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class HandshakeClient : public SSLClient
+{
+public:
+    HandshakeClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, int port, int handshakes)
+        : SSLClient(service, context, address, port),
+          _handshakes(handshakes),
+          _received(0),
+          _done(false)
+    {
+    }
+
+    bool done() const noexcept { return _done; }
+
+protected:
+    void onHandshaked() override
+    {
+        ++total_handshakes;
+        if (IsResumed())
+            ++total_resumed;
+
+        // Echo a single message to receive TLS 1.3 session tickets
+        _received = 0;
+        SendAsync(message_to_send.data(), message_to_send.size());
+    }
+
+    void onDisconnected() override
+    {
+        // Reconnect with the last session
+        if (--_handshakes > 0)
+            ConnectAsync();
+        else
+            _done = true;
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        _received += size;
+        if (_received >= message_to_send.size())
+            DisconnectAsync();
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Client caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+
+private:
+    int _handshakes;
+    size_t _received;
+    std::atomic<bool> _done;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(2222).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-c", "--clients").dest("clients").action("store").type("int").set_default(100).help("Count of working clients. Default: %default");
+    parser.add_option("-n", "--handshakes").dest("handshakes").action("store").type("int").set_default(10000).help("Count of handshakes to perform. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+    parser.add_option("-r", "--resumption").dest("resumption").set_default("tickets").help("Session resumption mode (none, cache, tickets). Default: %default");
+    parser.add_option("--tls13").dest("tls13").action("store_true").help("Use TLS 1.3 protocol");
+    parser.add_option("-w", "--handshake-threads").dest("handshake_threads").action("store").type("int").set_default(0).help("Count of handshake service threads (0 - handshake on session threads). Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int threads_count = options.get("threads");
+    int clients_count = options.get("clients");
+    int handshakes_count = options.get("handshakes");
+    int message_size = options.get("size");
+    std::string resumption(options.get("resumption"));
+    bool tls13 = options.get("tls13");
+    int handshake_threads = options.get("handshake_threads");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Working clients: " << clients_count << std::endl;
+    std::cout << "Handshakes to perform: " << handshakes_count << std::endl;
+    std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Session resumption: " << resumption << std::endl;
+    std::cout << "Protocol: " << (tls13 ? "TLS 1.3" : "TLS 1.2") << std::endl;
+    std::cout << "Handshake threads: " << handshake_threads << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare a message to send
+    message_to_send.resize(message_size, 0);
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads_count);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create and start a new handshake service
+    std::shared_ptr<Service> handshake_service;
+    if (handshake_threads > 0)
+    {
+        std::cout << "Handshake service starting...";
+        handshake_service = std::make_shared<Service>(handshake_threads);
+        handshake_service->Start();
+        std::cout << "Done!" << std::endl;
+    }
+
+    // Create and prepare a new SSL server context
+    auto server_context = std::make_shared<SSLContext>(tls13 ? asio::ssl::context::tlsv13 : asio::ssl::context::tlsv12);
+    server_context->set_password_callback([](size_t max_length, asio::ssl::context::password_purpose purpose) -> std::string { return "qwerty"; });
+    server_context->use_certificate_chain_file("../tools/certificates/server.pem");
+    server_context->use_private_key_file("../tools/certificates/server.pem", asio::ssl::context::pem);
+    server_context->use_tmp_dh_file("../tools/certificates/dh4096.pem");
+    if (resumption == "cache")
+    {
+        server_context->set_session_cache(clients_count * 2);
+        server_context->set_session_tickets(false);
+    }
+    else if (resumption == "tickets")
+    {
+        server_context->set_session_cache(0);
+        server_context->set_session_tickets(true);
+        server_context->rotate_ticket_key(SSLTicketKey::Generate());
+    }
+    else
+    {
+        server_context->set_session_cache(0);
+        server_context->set_session_tickets(false);
+    }
+
+    // Create a new echo server
+    auto server = std::make_shared<EchoServer>(service, server_context, port);
+    server->SetupHandshakeService(handshake_service);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    while (!server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Create and prepare a new SSL client context
+    auto client_context = std::make_shared<SSLContext>(tls13 ? asio::ssl::context::tlsv13 : asio::ssl::context::tlsv12);
+    client_context->set_default_verify_paths();
+    client_context->set_root_certs();
+    client_context->set_verify_mode(asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert);
+    client_context->load_verify_file("../tools/certificates/ca.pem");
+
+    // Create handshake clients
+    std::vector<std::shared_ptr<HandshakeClient>> clients;
+    for (int i = 0; i < clients_count; ++i)
+    {
+        auto client = std::make_shared<HandshakeClient>(service, client_context, address, port, handshakes_count / clients_count);
+        client->SetupSessionResumption(resumption != "none");
+        clients.emplace_back(client);
+    }
+
+    uint64_t timestamp_start = Timestamp::nano();
+
+    // Connect clients
+    std::cout << "Handshaking...";
+    for (auto& client : clients)
+        client->ConnectAsync();
+    for (auto& client : clients)
+        while (!client->done())
+            Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    uint64_t timestamp_stop = Timestamp::nano();
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    while (server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the handshake service
+    if (handshake_service)
+    {
+        std::cout << "Handshake service stopping...";
+        handshake_service->Stop();
+        std::cout << "Done!" << std::endl;
+    }
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total handshakes: " << total_handshakes << std::endl;
+    std::cout << "Client resumed handshakes: " << total_resumed << std::endl;
+    std::cout << "Server full handshakes: " << server->handshakes_full() << std::endl;
+    std::cout << "Server resumed handshakes: " << server->handshakes_resumed() << std::endl;
+    uint64_t server_handshakes = server->handshakes_full() + server->handshakes_resumed();
+    if (server_handshakes > 0)
+    {
+        std::cout << "Server handshake latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(server->handshake_latency_total() / server_handshakes) << " (max " << CppBenchmark::ReporterConsole::GenerateTimePeriod(server->handshake_latency_max()) << ")" << std::endl;
+        std::cout << "Server handshake queueing: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(server->handshake_queue_total() / server_handshakes) << " (max " << CppBenchmark::ReporterConsole::GenerateTimePeriod(server->handshake_queue_max()) << ")" << std::endl;
+    }
+    if (total_handshakes > 0)
+    {
+        std::cout << "Handshake latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_handshakes) << std::endl;
+        std::cout << "Handshake throughput: " << total_handshakes * 1000000000 / (timestamp_stop - timestamp_start) << " handshakes/s" << std::endl;
+    }
+
+    return 0;
+}
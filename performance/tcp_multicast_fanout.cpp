@@ -0,0 +1,188 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/tcp_client.h"
+#include "server/asio/tcp_server.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::atomic<uint64_t> total_errors(0);
+std::atomic<uint64_t> total_bytes(0);
+
+class FanoutServer : public TCPServer
+{
+public:
+    using TCPServer::TCPServer;
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class FanoutClient : public TCPClient
+{
+public:
+    FanoutClient(std::shared_ptr<Service> service, const std::string& address, int port)
+        : TCPClient(service, address, port),
+          _connected(false)
+    {
+    }
+
+    bool connected() const noexcept { return _connected; }
+
+protected:
+    void onConnected() override { _connected = true; }
+    void onDisconnected() override { _connected = false; }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        total_bytes += size;
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Client caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+
+private:
+    std::atomic<bool> _connected;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(1111).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-c", "--subscribers").dest("subscribers").action("store").type("int").set_default(100000).help("Maximal count of subscribers (starting from 1000, x10 each step). Default: %default");
+    parser.add_option("-m", "--messages").dest("messages").action("store").type("int").set_default(100).help("Count of broadcast messages per step. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int threads_count = options.get("threads");
+    int subscribers_count = options.get("subscribers");
+    int messages_count = options.get("messages");
+    int message_size = options.get("size");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Maximal subscribers: " << subscribers_count << std::endl;
+    std::cout << "Messages per step: " << messages_count << std::endl;
+    std::cout << "Message size: " << message_size << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads_count);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new fan-out server
+    auto server = std::make_shared<FanoutServer>(service, port);
+    server->SetupReuseAddress(true);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    while (!server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare message to broadcast
+    std::vector<uint8_t> message_to_send(message_size);
+
+    // Scale subscribers from 1000 to the given maximum
+    std::vector<std::shared_ptr<FanoutClient>> clients;
+    for (int subscribers = 1000; subscribers <= subscribers_count; subscribers *= 10)
+    {
+        // Connect additional subscribers
+        while ((int)clients.size() < subscribers)
+        {
+            auto client = std::make_shared<FanoutClient>(service, address, port);
+            client->ConnectAsync();
+            clients.emplace_back(client);
+        }
+        for (auto& client : clients)
+            while (!client->connected())
+                Thread::Yield();
+        while (server->connected_sessions() != clients.size())
+            Thread::Yield();
+
+        // Broadcast messages and wait for all subscribers to receive them
+        total_bytes = 0;
+        uint64_t expected = (uint64_t)messages_count * message_size * clients.size();
+        uint64_t timestamp_start = Timestamp::nano();
+        for (int i = 0; i < messages_count; ++i)
+            server->Multicast(message_to_send.data(), message_to_send.size());
+        while (total_bytes < expected)
+            Thread::Yield();
+        uint64_t timestamp_stop = Timestamp::nano();
+
+        std::cout << "Subscribers: " << clients.size() << std::endl;
+        std::cout << "Broadcast time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+        std::cout << "Broadcast latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / messages_count) << std::endl;
+        std::cout << "Delivery throughput: " << (uint64_t)messages_count * clients.size() * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+        std::cout << std::endl;
+    }
+
+    // Disconnect clients
+    std::cout << "Clients disconnecting...";
+    for (auto& client : clients)
+        client->DisconnectAsync();
+    for (auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,258 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/tcp_client.h"
+#include "server/asio/tcp_server.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::atomic<uint64_t> total_errors(0);
+std::atomic<uint64_t> total_bytes(0);
+std::atomic<uint64_t> total_subscriptions(0);
+
+// Topic subscribers count
+std::vector<std::atomic<uint64_t>> topic_subscribers;
+
+class PubSubSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Each received 32-bit value is a topic index to subscribe
+        _pending.append((const char*)buffer, size);
+        size_t offset = 0;
+        for (; offset + sizeof(uint32_t) <= _pending.size(); offset += sizeof(uint32_t))
+        {
+            uint32_t topic;
+            std::memcpy(&topic, _pending.data() + offset, sizeof(uint32_t));
+            if (Subscribe(std::to_string(topic)))
+                ++topic_subscribers[topic];
+            ++total_subscriptions;
+        }
+        _pending.erase(0, offset);
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Session caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+
+private:
+    std::string _pending;
+};
+
+class PubSubServer : public TCPServer
+{
+public:
+    using TCPServer::TCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(std::shared_ptr<TCPServer> server) override { return std::make_shared<PubSubSession>(server); }
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class PubSubClient : public TCPClient
+{
+public:
+    PubSubClient(std::shared_ptr<Service> service, const std::string& address, int port, std::vector<uint32_t> topics)
+        : TCPClient(service, address, port),
+          _topics(std::move(topics))
+    {
+    }
+
+protected:
+    void onConnected() override
+    {
+        // Send topics to subscribe
+        SendAsync(_topics.data(), _topics.size() * sizeof(uint32_t));
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        total_bytes += size;
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Client caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+
+private:
+    std::vector<uint32_t> _topics;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(1111).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-c", "--clients").dest("clients").action("store").type("int").set_default(1000).help("Count of subscribed clients. Default: %default");
+    parser.add_option("-n", "--topics").dest("topics").action("store").type("int").set_default(10000).help("Count of topics. Default: %default");
+    parser.add_option("-k", "--subscriptions").dest("subscriptions").action("store").type("int").set_default(100).help("Count of topics subscribed by each client. Default: %default");
+    parser.add_option("-z", "--skew").dest("skew").action("store").type("float").set_default(1.0).help("Zipf skew of topic popularity (0 - uniform). Default: %default");
+    parser.add_option("-m", "--messages").dest("messages").action("store").type("int").set_default(1000000).help("Count of published messages. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int threads_count = options.get("threads");
+    int clients_count = options.get("clients");
+    int topics_count = options.get("topics");
+    int subscriptions_count = options.get("subscriptions");
+    double skew = (double)options.get("skew");
+    int messages_count = options.get("messages");
+    int message_size = options.get("size");
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Clients: " << clients_count << std::endl;
+    std::cout << "Topics: " << topics_count << std::endl;
+    std::cout << "Subscriptions per client: " << subscriptions_count << std::endl;
+    std::cout << "Topic popularity skew: " << skew << std::endl;
+    std::cout << "Messages: " << messages_count << std::endl;
+    std::cout << "Message size: " << message_size << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare Zipf distribution of topic popularity
+    std::vector<double> weights(topics_count);
+    for (int i = 0; i < topics_count; ++i)
+        weights[i] = 1.0 / std::pow((double)(i + 1), skew);
+    std::discrete_distribution<uint32_t> popularity(weights.begin(), weights.end());
+    std::mt19937 generator(0);
+
+    topic_subscribers = std::vector<std::atomic<uint64_t>>(topics_count);
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads_count);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new publish/subscribe server
+    auto server = std::make_shared<PubSubServer>(service, port);
+    server->SetupReuseAddress(true);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    while (!server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Create and connect clients with skewed subscriptions
+    std::cout << "Clients subscribing...";
+    std::vector<std::shared_ptr<PubSubClient>> clients;
+    for (int i = 0; i < clients_count; ++i)
+    {
+        std::vector<uint32_t> topics(subscriptions_count);
+        for (auto& topic : topics)
+            topic = popularity(generator);
+        auto client = std::make_shared<PubSubClient>(service, address, port, topics);
+        client->ConnectAsync();
+        clients.emplace_back(client);
+    }
+    while (total_subscriptions < (uint64_t)clients_count * subscriptions_count)
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare topics and message to publish
+    std::vector<std::string> topics(topics_count);
+    for (int i = 0; i < topics_count; ++i)
+        topics[i] = std::to_string(i);
+    std::vector<uint8_t> message_to_send(message_size);
+
+    // Publish messages into topics with the same popularity and wait for all subscribers to receive them
+    uint64_t expected = 0;
+    uint64_t timestamp_start = Timestamp::nano();
+    for (int i = 0; i < messages_count; ++i)
+    {
+        uint32_t topic = popularity(generator);
+        expected += topic_subscribers[topic] * message_size;
+        server->Publish(topics[topic], message_to_send.data(), message_to_send.size());
+    }
+    uint64_t timestamp_publish = Timestamp::nano();
+    while (total_bytes < expected)
+        Thread::Yield();
+    uint64_t timestamp_stop = Timestamp::nano();
+
+    std::cout << "Publish time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_publish - timestamp_start) << std::endl;
+    std::cout << "Publish latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_publish - timestamp_start) / messages_count) << std::endl;
+    std::cout << "Publish throughput: " << (uint64_t)messages_count * 1000000000 / (timestamp_publish - timestamp_start) << " msg/s" << std::endl;
+    std::cout << "Delivery time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Delivery throughput: " << (expected / message_size) * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+    std::cout << "Delivered messages: " << expected / message_size << std::endl;
+
+    std::cout << std::endl;
+
+    // Disconnect clients
+    std::cout << "Clients disconnecting...";
+    for (auto& client : clients)
+        client->DisconnectAsync();
+    for (auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+
+    return 0;
+}
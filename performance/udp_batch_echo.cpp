@@ -0,0 +1,293 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/udp_client.h"
+#include "server/asio/udp_server.h"
+
+#include "benchmark/reporter_console.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::vector<uint8_t> message_to_send;
+
+std::atomic<uint64_t> timestamp_start(0);
+std::atomic<uint64_t> timestamp_stop(0);
+
+std::atomic<uint64_t> total_errors(0);
+std::atomic<uint64_t> total_echoed(0);
+std::atomic<uint64_t> total_sent(0);
+std::atomic<uint64_t> total_received(0);
+
+class EchoServer : public UDPServer
+{
+public:
+    using UDPServer::UDPServer;
+
+protected:
+    void onStarted() override
+    {
+        // Start receive datagrams
+        ReceiveAsync();
+    }
+
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override
+    {
+        // Resend the message back to the client
+        if (SendAsync(endpoint, buffer, size))
+            ++total_echoed;
+
+        // Continue receive datagrams
+        ReceiveAsync();
+    }
+
+    void onReceivedBatch(const UDPDatagram* datagrams, size_t count) override
+    {
+        // Resend the whole batch back to clients
+        if (SendBatchAsync(datagrams, count))
+            total_echoed += count;
+
+        // Continue receive datagrams
+        ReceiveAsync();
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+};
+
+class EchoClient : public UDPClient
+{
+public:
+    EchoClient(std::shared_ptr<Service> service, const std::string& address, int port, int messages, int batch)
+        : UDPClient(service, address, port),
+          _connected(false),
+          _messages(messages),
+          _batch(batch),
+          _sent(0)
+    {
+    }
+
+    bool connected() const noexcept { return _connected; }
+    bool completed() const noexcept { return _messages <= 0; }
+
+protected:
+    void onConnected() override
+    {
+        _connected = true;
+
+        // Start receive datagrams
+        ReceiveAsync();
+
+        SendMessages();
+    }
+
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override
+    {
+        timestamp_stop = Timestamp::nano();
+        ++total_received;
+
+        // Continue receive datagrams
+        ReceiveAsync();
+    }
+
+    void onReceivedBatch(const UDPDatagram* datagrams, size_t count) override
+    {
+        timestamp_stop = Timestamp::nano();
+        total_received += count;
+
+        // Continue receive datagrams
+        ReceiveAsync();
+    }
+
+    void onSent(const asio::ip::udp::endpoint& endpoint, size_t sent) override
+    {
+        ++total_sent;
+
+        // Send the next batch when the current one is sent
+        if (++_sent == _batch)
+        {
+            _sent = 0;
+            SendMessages();
+        }
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Client caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+
+private:
+    std::atomic<bool> _connected;
+    std::atomic<int> _messages;
+    int _batch;
+    int _sent;
+
+    void SendMessages()
+    {
+        if (_messages <= 0)
+            return;
+
+        _messages -= _batch;
+        if (_batch > 1)
+        {
+            std::vector<UDPDatagram> datagrams(_batch, UDPDatagram(endpoint(), message_to_send.data(), message_to_send.size()));
+            SendBatchAsync(datagrams.data(), datagrams.size());
+        }
+        else
+            SendAsync(message_to_send.data(), message_to_send.size());
+    }
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-a", "--address").dest("address").set_default("127.0.0.1").help("Server address. Default: %default");
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(3333).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
+    parser.add_option("-c", "--clients").dest("clients").action("store").type("int").set_default(10).help("Count of working clients. Default: %default");
+    parser.add_option("-m", "--messages").dest("messages").action("store").type("int").set_default(10000000).help("Count of messages to send. Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+    parser.add_option("-b", "--batch").dest("batch").action("store").type("int").set_default(64).help("Count of datagrams in a batch (1 - no batching). Default: %default");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Benchmark parameters
+    std::string address(options.get("address"));
+    int port = options.get("port");
+    int threads_count = options.get("threads");
+    int clients_count = options.get("clients");
+    int messages_count = options.get("messages");
+    int message_size = options.get("size");
+    int batch = std::max((int)options.get("batch"), 1);
+
+    std::cout << "Server address: " << address << std::endl;
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads_count << std::endl;
+    std::cout << "Working clients: " << clients_count << std::endl;
+    std::cout << "Messages to send: " << messages_count << std::endl;
+    std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Batch size: " << batch << std::endl;
+
+    std::cout << std::endl;
+
+    // Prepare a message to send
+    message_to_send.resize(message_size, 0);
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads_count);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new echo server
+    auto server = std::make_shared<EchoServer>(service, port);
+    server->SetupReuseAddress(true);
+    server->SetupReusePort(true);
+    server->SetupReceiveBatch(batch, message_size);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    while (!server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Create echo clients
+    std::vector<std::shared_ptr<EchoClient>> clients;
+    for (int i = 0; i < clients_count; ++i)
+    {
+        auto client = std::make_shared<EchoClient>(service, address, port, messages_count / clients_count, batch);
+        client->SetupReceiveBatch(batch, message_size);
+        clients.emplace_back(client);
+    }
+
+    timestamp_start = Timestamp::nano();
+
+    // Connect clients
+    std::cout << "Clients connecting...";
+    for (auto& client : clients)
+        client->ConnectAsync();
+    for (auto& client : clients)
+        while (!client->connected())
+            Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Wait for sending all messages and receiving the rest of echoed datagrams
+    std::cout << "Processing...";
+    for (auto& client : clients)
+        while (!client->completed())
+            Thread::Sleep(100);
+    uint64_t received = 0;
+    do
+    {
+        received = total_received;
+        Thread::Sleep(100);
+    } while (received != total_received);
+    std::cout << "Done!" << std::endl;
+
+    // Disconnect clients
+    std::cout << "Clients disconnecting...";
+    for (auto& client : clients)
+        client->DisconnectAsync();
+    for (auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    while (server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+
+    std::cout << std::endl;
+
+    uint64_t duration = timestamp_stop - timestamp_start;
+    std::cout << "Total time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(duration) << std::endl;
+    std::cout << "Datagrams sent: " << total_sent << std::endl;
+    std::cout << "Datagrams echoed: " << total_echoed << std::endl;
+    std::cout << "Datagrams received: " << total_received << std::endl;
+    if (duration > 0)
+    {
+        std::cout << "Send throughput: " << total_sent * 1000000000 / duration << " pps" << std::endl;
+        std::cout << "Echo throughput: " << total_received * 1000000000 / duration << " pps" << std::endl;
+    }
+
+    return 0;
+}
@@ -39,6 +39,8 @@ int main(int argc, char** argv)
     parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(CPU::PhysicalCores()).help("Count of working threads. Default: %default");
     parser.add_option("-m", "--messages").dest("messages").action("store").type("int").set_default(1000000).help("Rate of messages per second to send. Default: %default");
     parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(32).help("Single message size. Default: %default");
+    parser.add_option("--paced").dest("paced").action("store_true").help("Pace messages with the server send pacer instead of the sleep loop");
+    parser.add_option("--txtime").dest("txtime").action("store_true").help("Pace messages with SO_TXTIME launch times (requires fq qdisc)");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -55,12 +57,15 @@ int main(int argc, char** argv)
     int threads = options.get("threads");
     int messages_rate = options.get("messages");
     int message_size = options.get("size");
+    bool paced = options.get("paced") || options.get("txtime");
+    bool txtime = options.get("txtime");
 
     std::cout << "Server address: " << address << std::endl;
     std::cout << "Server port: " << port << std::endl;
     std::cout << "Working threads: " << threads << std::endl;
     std::cout << "Messages rate: " << messages_rate << std::endl;
     std::cout << "Message size: " << message_size << std::endl;
+    std::cout << "Pacing: " << (txtime ? "SO_TXTIME" : (paced ? "token bucket" : "none")) << std::endl;
 
     std::cout << std::endl;
 
@@ -76,6 +81,12 @@ int main(int argc, char** argv)
     auto server = std::make_shared<MulticastServer>(service, 0);
     server->SetupReuseAddress(true);
     server->SetupReusePort(true);
+    if (paced)
+    {
+        server->SetupSendQueue(messages_rate);
+        server->SetupPacing(messages_rate, PacingUnit::Packets);
+        server->SetupTransmitTime(txtime);
+    }
 
     // Start the server
     std::cout << "Server starting...";
@@ -84,13 +95,22 @@ int main(int argc, char** argv)
 
     // Start the multicasting thread
     std::atomic<bool> multicasting(true);
-    auto multicaster = std::thread([&server, &multicasting, messages_rate, message_size]()
+    auto multicaster = std::thread([&server, &multicasting, messages_rate, message_size, paced]()
     {
         // Prepare message to multicast
         std::vector<uint8_t> message_to_send(message_size);
 
+        // Paced multicasting loop keeps the send queue filled
+        while (paced && multicasting)
+        {
+            if (server->bytes_pending() < (uint64_t)(messages_rate * message_size / 10))
+                server->MulticastAsync(message_to_send.data(), message_to_send.size());
+            else
+                Thread::Sleep(1);
+        }
+
         // Multicasting loop
-        while (multicasting)
+        while (!paced && multicasting)
         {
             auto start = UtcTimestamp();
             for (int i = 0; i < messages_rate; ++i)
@@ -129,6 +149,14 @@ int main(int argc, char** argv)
     multicasting = false;
     multicaster.join();
 
+    // Report the pacing rate
+    if (paced)
+    {
+        std::cout << "Pacing target rate: " << server->pacer().rate() << " msg/s" << std::endl;
+        std::cout << "Pacing achieved rate: " << (uint64_t)server->pacer().achieved_rate() << " msg/s" << std::endl;
+        std::cout << "Pacing throttles: " << server->pacer().throttles() << std::endl;
+    }
+
     // Stop the server
     std::cout << "Server stopping...";
     server->Stop();
@@ -0,0 +1,212 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "server/asio/service.h"
+#include "server/asio/udp_server.h"
+#include "system/cpu.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+#include <OptionParser.h>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+std::atomic<uint64_t> total_errors(0);
+std::atomic<uint64_t> total_received(0);
+std::atomic<uint64_t> total_echoed(0);
+
+class EchoServer : public UDPServer
+{
+public:
+    EchoServer(const std::shared_ptr<Service>& service, int port, bool echo)
+        : UDPServer(service, port),
+          _echo(echo)
+    {
+    }
+
+protected:
+    void onStarted() override
+    {
+        // Start receive datagrams
+        ReceiveAsync();
+    }
+
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override
+    {
+        ++total_received;
+
+        // Resend the message back to the client
+        if (_echo && SendAsync(endpoint, buffer, size))
+            ++total_echoed;
+
+        // Continue receive datagrams
+        ReceiveAsync();
+    }
+
+    void onReceivedBatch(const UDPDatagram* datagrams, size_t count) override
+    {
+        total_received += count;
+
+        // Resend the whole batch back to clients
+        if (_echo && SendBatchAsync(datagrams, count))
+            total_echoed += count;
+
+        // Continue receive datagrams
+        ReceiveAsync();
+    }
+
+    void onError(int error, const std::string& category, const std::string& message) override
+    {
+        std::cout << "Server caught an error with code " << error << " and category '" << category << "': " << message << std::endl;
+        ++total_errors;
+    }
+
+private:
+    bool _echo;
+};
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-p", "--port").dest("port").action("store").type("int").set_default(3333).help("Server port. Default: %default");
+    parser.add_option("-t", "--threads").dest("threads").action("store").type("int").set_default(1).help("Count of working threads. Default: %default");
+    parser.add_option("-i", "--interface").dest("interface").set_default("").help("Network interface for the AF_XDP transport (empty - socket transport). Default: %default");
+    parser.add_option("-q", "--queue").dest("queue").action("store").type("int").set_default(0).help("Network interface queue for the AF_XDP transport. Default: %default");
+    parser.add_option("-b", "--batch").dest("batch").action("store").type("int").set_default(64).help("Count of datagrams in a socket receive batch (1 - no batching). Default: %default");
+    parser.add_option("-s", "--size").dest("size").action("store").type("int").set_default(2048).help("Maximal datagram size. Default: %default");
+    parser.add_option("--no-echo").dest("no-echo").action("store_true").help("Count received datagrams without echoing them back");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Server parameters
+    int port = options.get("port");
+    int threads = options.get("threads");
+    std::string interface(options.get("interface"));
+    int queue = options.get("queue");
+    int batch = std::max((int)options.get("batch"), 1);
+    int size = options.get("size");
+    bool echo = !options.get("no-echo");
+
+    std::cout << "Server port: " << port << std::endl;
+    std::cout << "Working threads: " << threads << std::endl;
+    std::cout << "Network interface: " << (interface.empty() ? "none" : interface) << std::endl;
+    std::cout << "Network interface queue: " << queue << std::endl;
+    std::cout << "Batch size: " << batch << std::endl;
+    std::cout << "Echo: " << (echo ? "yes" : "no") << std::endl;
+
+    std::cout << std::endl;
+
+    // Create a new Asio service
+    auto service = std::make_shared<Service>(threads);
+
+    // Start the Asio service
+    std::cout << "Asio service starting...";
+    service->Start();
+    std::cout << "Done!" << std::endl;
+
+    // Create a new echo server
+    auto server = std::make_shared<EchoServer>(service, port, echo);
+    server->SetupReuseAddress(true);
+    server->SetupReusePort(true);
+    server->SetupReceiveBatch(batch, size);
+    if (!interface.empty())
+        server->SetupXdp(interface, queue);
+
+    // Start the server
+    std::cout << "Server starting...";
+    server->Start();
+    while (!server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << "Transport: " << (server->IsXdp() ? "AF_XDP" : "socket") << std::endl;
+
+    // Start the reporting thread
+    std::atomic<bool> reporting(true);
+    auto reporter = std::thread([&server, &reporting]()
+    {
+        uint64_t received = total_received;
+        uint64_t echoed = total_echoed;
+        uint64_t timestamp = Timestamp::nano();
+        while (reporting)
+        {
+            Thread::Sleep(1000);
+
+            uint64_t current = Timestamp::nano();
+            uint64_t duration = current - timestamp;
+            uint64_t received_delta = total_received - received;
+            uint64_t echoed_delta = total_echoed - echoed;
+            if ((duration > 0) && (received_delta > 0))
+            {
+                std::cout << "Receive throughput: " << received_delta * 1000000000 / duration << " pps";
+                std::cout << ", echo throughput: " << echoed_delta * 1000000000 / duration << " pps";
+                if (server->IsXdp())
+                    std::cout << ", AF_XDP received/sent: " << server->xdp().datagrams_received() << "/" << server->xdp().datagrams_sent();
+                std::cout << std::endl;
+            }
+
+            received = total_received;
+            echoed = total_echoed;
+            timestamp = current;
+        }
+    });
+
+    std::cout << "Press Enter to stop the server or '!' to restart the server..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line.empty())
+            break;
+
+        // Restart the server
+        if (line == "!")
+        {
+            std::cout << "Server restarting...";
+            server->Restart();
+            std::cout << "Done!" << std::endl;
+            std::cout << "Transport: " << (server->IsXdp() ? "AF_XDP" : "socket") << std::endl;
+            continue;
+        }
+    }
+
+    // Stop the reporting thread
+    reporting = false;
+    reporter.join();
+
+    // Stop the server
+    std::cout << "Server stopping...";
+    server->Stop();
+    while (server->IsStarted())
+        Thread::Yield();
+    std::cout << "Done!" << std::endl;
+
+    // Stop the Asio service
+    std::cout << "Asio service stopping...";
+    service->Stop();
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    std::cout << "Errors: " << total_errors << std::endl;
+    std::cout << "Datagrams received: " << total_received << std::endl;
+    std::cout << "Datagrams echoed: " << total_echoed << std::endl;
+
+    return 0;
+}
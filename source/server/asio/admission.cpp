@@ -0,0 +1,146 @@
+/*!
+    \file admission.cpp
+    \brief Admission control implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/admission.h"
+
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace CppServer {
+namespace Asio {
+
+AdmissionControl::AdmissionControl() noexcept
+    : _max_sessions(0),
+      _accept_rate(0),
+      _accept_burst(1),
+      _target_delay(0),
+      _min_limit(1),
+      _tokens(0),
+      _tokens_timestamp(0),
+      _limit(std::numeric_limits<size_t>::max()),
+      _queue_delay(0),
+      _admitted(0),
+      _rejected(0)
+{
+}
+
+void AdmissionControl::SetupAcceptRate(double rate, size_t burst)
+{
+    std::lock_guard<std::mutex> locker(_lock);
+
+    _accept_rate = std::max(rate, 0.0);
+    _accept_burst = std::max(burst, (size_t)1);
+    _tokens = (double)_accept_burst;
+    _tokens_timestamp = CppCommon::Timestamp::nano();
+}
+
+void AdmissionControl::SetupAdaptiveLimit(const CppCommon::Timespan& target_delay, size_t min_limit)
+{
+    std::lock_guard<std::mutex> locker(_lock);
+
+    _target_delay = target_delay.total();
+    _min_limit = std::max(min_limit, (size_t)1);
+    _limit = std::numeric_limits<size_t>::max();
+}
+
+void AdmissionControl::SetupRejectResponse(const void* buffer, size_t size)
+{
+    std::lock_guard<std::mutex> locker(_lock);
+
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _reject_response.assign(bytes, bytes + size);
+}
+
+bool AdmissionControl::Admit(size_t sessions)
+{
+    std::lock_guard<std::mutex> locker(_lock);
+
+    bool admit = true;
+
+    // Check the maximal count of sessions
+    size_t max_sessions = _max_sessions;
+    if ((max_sessions > 0) && (sessions >= max_sessions))
+        admit = false;
+
+    // Check the adaptive concurrency limit
+    if (admit && IsAdaptive() && (sessions >= _limit))
+        admit = false;
+
+    // Check the token bucket accept rate
+    double accept_rate = _accept_rate;
+    if (admit && (accept_rate > 0))
+    {
+        // Refill tokens for the elapsed time
+        uint64_t timestamp = CppCommon::Timestamp::nano();
+        double elapsed = (double)(timestamp - _tokens_timestamp) / 1000000000.0;
+        _tokens = std::min(_tokens + elapsed * accept_rate, (double)_accept_burst);
+        _tokens_timestamp = timestamp;
+
+        if (_tokens >= 1.0)
+            _tokens -= 1.0;
+        else
+            admit = false;
+    }
+
+    // Update statistic
+    if (admit)
+        ++_admitted;
+    else
+        ++_rejected;
+
+    return admit;
+}
+
+void AdmissionControl::Update(const CppCommon::Timespan& delay, size_t sessions)
+{
+    std::lock_guard<std::mutex> locker(_lock);
+
+    _queue_delay = delay.total();
+
+    if (!IsAdaptive())
+        return;
+
+    size_t limit = _limit;
+    if (delay.total() > _target_delay)
+    {
+        // Multiplicative decrease starting from the current load
+        limit = std::min(limit, sessions);
+        limit = std::max(limit - limit / 4, _min_limit);
+    }
+    else
+    {
+        // Additive increase while the limit stays close to the current load
+        if (limit < std::numeric_limits<size_t>::max())
+        {
+            limit += std::max(limit / 16, (size_t)1);
+            if (limit > 2 * sessions + _min_limit)
+                limit = std::numeric_limits<size_t>::max();
+        }
+    }
+    size_t max_sessions = _max_sessions;
+    if ((max_sessions > 0) && (limit > max_sessions))
+        limit = max_sessions;
+    _limit = limit;
+}
+
+void AdmissionControl::Reset()
+{
+    std::lock_guard<std::mutex> locker(_lock);
+
+    _tokens = (double)_accept_burst;
+    _tokens_timestamp = CppCommon::Timestamp::nano();
+    _limit = std::numeric_limits<size_t>::max();
+    _queue_delay = 0;
+    _admitted = 0;
+    _rejected = 0;
+}
+
+} // namespace Asio
+} // namespace CppServer
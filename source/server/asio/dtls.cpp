@@ -0,0 +1,462 @@
+/*!
+    \file dtls.cpp
+    \brief DTLS protocol implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/dtls.h"
+
+#include <openssl/hmac.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppServer {
+namespace Asio {
+
+DTLSProtocol::DTLSProtocol()
+    : _ssl(nullptr),
+      _address(BIO_ADDR_new()),
+      _server(false),
+      _listening(false),
+      _handshaked(false),
+      _closed(false),
+      _failed(false),
+      _error(0),
+      _input(nullptr),
+      _input_size(0),
+      _cookie_secret(),
+      _messages_sent(0),
+      _messages_received(0),
+      _datagrams_sent(0),
+      _datagrams_received(0),
+      _retransmits(0),
+      _cookies_sent(0),
+      _option_mtu(1400)
+{
+}
+
+DTLSProtocol::~DTLSProtocol()
+{
+    Close();
+    BIO_ADDR_free(_address);
+}
+
+bool DTLSProtocol::IsPending() const
+{
+    if ((_ssl == nullptr) || _failed)
+        return false;
+
+    struct timeval tv;
+    return (DTLSv1_get_timeout(_ssl, &tv) == 1);
+}
+
+CppCommon::Timespan DTLSProtocol::timeout() const
+{
+    if ((_ssl == nullptr) || _failed)
+        return CppCommon::Timespan::zero();
+
+    struct timeval tv;
+    if (DTLSv1_get_timeout(_ssl, &tv) != 1)
+        return CppCommon::Timespan::zero();
+
+    return CppCommon::Timespan::microseconds((int64_t)tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+void DTLSProtocol::SetupCookie(const uint8_t* secret, const std::string& peer)
+{
+    std::memcpy(_cookie_secret, secret, COOKIE_SECRET_SIZE);
+    _cookie_peer = peer;
+}
+
+bool DTLSProtocol::Open(SSL_CTX* context, bool server)
+{
+    Close();
+
+    _ssl = SSL_new(context);
+    if (_ssl == nullptr)
+        return false;
+
+    BIO_METHOD* method = Method();
+    BIO* bio = (method != nullptr) ? BIO_new(method) : nullptr;
+    if (bio == nullptr)
+    {
+        SSL_free(_ssl);
+        _ssl = nullptr;
+        return false;
+    }
+
+    BIO_set_data(bio, this);
+    BIO_set_init(bio, 1);
+
+    // The SSL object takes the ownership of the datagram BIO
+    SSL_set_bio(_ssl, bio, bio);
+    SSL_set_app_data(_ssl, this);
+
+    // There is no socket to query, so the MTU is set explicitly
+    SSL_set_options(_ssl, SSL_OP_NO_QUERY_MTU);
+    SSL_set_mtu(_ssl, (long)_option_mtu);
+
+    if (server)
+        SSL_set_accept_state(_ssl);
+    else
+        SSL_set_connect_state(_ssl);
+
+    // Reset the protocol state
+    _server = server;
+    _listening = server;
+    _handshaked = false;
+    _closed = false;
+    _failed = false;
+    _error = 0;
+    _read_buffer.resize(MAX_PAYLOAD);
+    _pending.clear();
+    _output.clear();
+    _delivered.clear();
+
+    // Reset statistic
+    _messages_sent = 0;
+    _messages_received = 0;
+    _datagrams_sent = 0;
+    _datagrams_received = 0;
+    _retransmits = 0;
+    _cookies_sent = 0;
+
+    return true;
+}
+
+void DTLSProtocol::Close()
+{
+    if (_ssl == nullptr)
+        return;
+
+    // Free the SSL object together with the datagram BIO
+    SSL_free(_ssl);
+    _ssl = nullptr;
+
+    _listening = false;
+    _handshaked = false;
+    _input = nullptr;
+    _input_size = 0;
+    _pending.clear();
+}
+
+bool DTLSProtocol::Connect()
+{
+    if ((_ssl == nullptr) || _server || _failed)
+        return false;
+
+    ERR_clear_error();
+
+    // Send ClientHello
+    return Handshake();
+}
+
+bool DTLSProtocol::Listen(const void* buffer, size_t size)
+{
+    if ((_ssl == nullptr) || !_server)
+        return false;
+
+    ++_datagrams_received;
+    _input = (const uint8_t*)buffer;
+    _input_size = size;
+
+    ERR_clear_error();
+
+    // Reply with HelloVerifyRequest or accept ClientHello with the valid cookie
+    int result = DTLSv1_listen(_ssl, _address);
+
+    ERR_clear_error();
+
+    _input = nullptr;
+    _input_size = 0;
+    return (result > 0);
+}
+
+bool DTLSProtocol::Send(const void* buffer, size_t size)
+{
+    if ((_ssl == nullptr) || _failed || _closed)
+        return false;
+
+    if (size > MAX_PAYLOAD)
+        return false;
+
+    // Queue the message until the handshake is completed
+    if (!_handshaked)
+    {
+        _pending.push(buffer, size);
+        return true;
+    }
+
+    ERR_clear_error();
+
+    return Write(buffer, size);
+}
+
+bool DTLSProtocol::Input(const void* buffer, size_t size)
+{
+    if ((_ssl == nullptr) || _failed)
+        return false;
+
+    ++_datagrams_received;
+    _input = (const uint8_t*)buffer;
+    _input_size = size;
+
+    ERR_clear_error();
+
+    bool result = true;
+
+    // Verify the cookie of ClientHello before the handshake
+    if (_listening)
+    {
+        int listen = DTLSv1_listen(_ssl, _address);
+        if (listen > 0)
+            _listening = false;
+        else if (listen < 0)
+            result = Fail(listen);
+    }
+
+    // Continue the handshake with the received flight
+    if (result && !_listening && !_handshaked)
+        result = Handshake();
+
+    // Decrypt all records of the datagram
+    if (result && _handshaked)
+        result = Read();
+
+    _input = nullptr;
+    _input_size = 0;
+    return result;
+}
+
+void DTLSProtocol::Flush()
+{
+    if ((_ssl == nullptr) || _failed)
+        return;
+
+    ERR_clear_error();
+
+    // Retransmit the last flight of the handshake if its timer is expired
+    int result = DTLSv1_handle_timeout(_ssl);
+    if (result > 0)
+        ++_retransmits;
+    else if (result < 0)
+        Fail(result);
+}
+
+void DTLSProtocol::Shutdown()
+{
+    if ((_ssl == nullptr) || _failed || !_handshaked)
+        return;
+
+    ERR_clear_error();
+
+    // Do not wait for the close notify alert of the peer
+    SSL_shutdown(_ssl);
+
+    ERR_clear_error();
+}
+
+void DTLSProtocol::TakeOutput(RUDPQueue& queue)
+{
+    queue.clear();
+    std::swap(queue, _output);
+}
+
+void DTLSProtocol::TakeDelivered(RUDPQueue& queue)
+{
+    queue.clear();
+    std::swap(queue, _delivered);
+}
+
+void DTLSProtocol::SetupCookieExchange(SSL_CTX* context)
+{
+    SSL_CTX_set_cookie_generate_cb(context, CookieGenerate);
+    SSL_CTX_set_cookie_verify_cb(context, CookieVerify);
+}
+
+bool DTLSProtocol::Handshake()
+{
+    int result = SSL_do_handshake(_ssl);
+    if (result == 1)
+    {
+        _handshaked = true;
+
+        // Send messages queued during the handshake
+        const uint8_t* message = _pending.buffer.data();
+        for (size_t size : _pending.sizes)
+        {
+            if (!Write(message, size))
+                return false;
+            message += size;
+        }
+        _pending.clear();
+        return true;
+    }
+
+    int error = SSL_get_error(_ssl, result);
+    if ((error == SSL_ERROR_WANT_READ) || (error == SSL_ERROR_WANT_WRITE))
+        return true;
+
+    return Fail(result);
+}
+
+bool DTLSProtocol::Read()
+{
+    for (;;)
+    {
+        size_t read = 0;
+        if (SSL_read_ex(_ssl, _read_buffer.data(), _read_buffer.size(), &read) == 1)
+        {
+            ++_messages_received;
+            _delivered.push(_read_buffer.data(), read);
+            continue;
+        }
+
+        int error = SSL_get_error(_ssl, 0);
+        if ((error == SSL_ERROR_WANT_READ) || (error == SSL_ERROR_WANT_WRITE))
+            return true;
+
+        // Clean shutdown of the peer
+        if (error == SSL_ERROR_ZERO_RETURN)
+        {
+            _closed = true;
+            return true;
+        }
+
+        return Fail(0);
+    }
+}
+
+bool DTLSProtocol::Write(const void* buffer, size_t size)
+{
+    // Each message is encrypted into the single DTLS record
+    size_t written = 0;
+    if (SSL_write_ex(_ssl, buffer, size, &written) == 1)
+    {
+        ++_messages_sent;
+        return true;
+    }
+
+    int error = SSL_get_error(_ssl, 0);
+    if ((error == SSL_ERROR_WANT_READ) || (error == SSL_ERROR_WANT_WRITE))
+        return false;
+
+    return Fail(0);
+}
+
+bool DTLSProtocol::Fail(int result)
+{
+    _error = ERR_get_error();
+    if (_error == 0)
+        _error = ERR_PACK(ERR_LIB_SSL, 0, SSL_R_PROTOCOL_IS_SHUTDOWN);
+    _failed = true;
+
+    ERR_clear_error();
+    return false;
+}
+
+BIO_METHOD* DTLSProtocol::Method()
+{
+    static BIO_METHOD* method = []()
+    {
+        BIO_METHOD* result = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "CppServer datagram BIO");
+        if (result != nullptr)
+        {
+            BIO_meth_set_write(result, BioWrite);
+            BIO_meth_set_read(result, BioRead);
+            BIO_meth_set_ctrl(result, BioCtrl);
+        }
+        return result;
+    }();
+    return method;
+}
+
+int DTLSProtocol::BioWrite(BIO* bio, const char* data, int size)
+{
+    BIO_clear_retry_flags(bio);
+
+    DTLSProtocol* protocol = (DTLSProtocol*)BIO_get_data(bio);
+    if ((protocol == nullptr) || (size < 0))
+        return -1;
+
+    // Each write is the single datagram
+    ++protocol->_datagrams_sent;
+    protocol->_output.push(data, (size_t)size);
+    return size;
+}
+
+int DTLSProtocol::BioRead(BIO* bio, char* data, int size)
+{
+    BIO_clear_retry_flags(bio);
+
+    DTLSProtocol* protocol = (DTLSProtocol*)BIO_get_data(bio);
+    if ((protocol == nullptr) || (size < 0))
+        return -1;
+
+    // Wait for the next received datagram
+    if (protocol->_input == nullptr)
+    {
+        BIO_set_retry_read(bio);
+        return -1;
+    }
+
+    // Each read is the single datagram, the rest of the truncated datagram is dropped
+    size_t read = std::min(protocol->_input_size, (size_t)size);
+    std::memcpy(data, protocol->_input, read);
+    protocol->_input = nullptr;
+    protocol->_input_size = 0;
+    return (int)read;
+}
+
+long DTLSProtocol::BioCtrl(BIO* bio, int cmd, long num, void* ptr)
+{
+    switch (cmd)
+    {
+        case BIO_CTRL_FLUSH:
+        case BIO_CTRL_DGRAM_SET_CONNECTED:
+        case BIO_CTRL_DGRAM_SET_PEER:
+        case BIO_CTRL_DGRAM_SET_NEXT_TIMEOUT:
+            return 1;
+        case BIO_CTRL_DGRAM_GET_MTU_OVERHEAD:
+            // IPv4 and UDP headers
+            return 28;
+        default:
+            return 0;
+    }
+}
+
+int DTLSProtocol::CookieGenerate(SSL* ssl, unsigned char* cookie, unsigned int* length)
+{
+    DTLSProtocol* protocol = (DTLSProtocol*)SSL_get_app_data(ssl);
+    if (protocol == nullptr)
+        return 0;
+
+    ++protocol->_cookies_sent;
+    protocol->Cookie(cookie, length);
+    return 1;
+}
+
+int DTLSProtocol::CookieVerify(SSL* ssl, const unsigned char* cookie, unsigned int length)
+{
+    DTLSProtocol* protocol = (DTLSProtocol*)SSL_get_app_data(ssl);
+    if (protocol == nullptr)
+        return 0;
+
+    unsigned char expected[EVP_MAX_MD_SIZE];
+    unsigned int expected_length = 0;
+    protocol->Cookie(expected, &expected_length);
+    return ((length == expected_length) && (CRYPTO_memcmp(cookie, expected, length) == 0)) ? 1 : 0;
+}
+
+void DTLSProtocol::Cookie(unsigned char* cookie, unsigned int* length) const
+{
+    // HMAC-SHA256 of the peer identity, so the server keeps no state for unverified peers
+    if (HMAC(EVP_sha256(), _cookie_secret, (int)COOKIE_SECRET_SIZE, (const unsigned char*)_cookie_peer.data(), _cookie_peer.size(), cookie, length) == nullptr)
+        *length = 0;
+}
+
+} // namespace Asio
+} // namespace CppServer
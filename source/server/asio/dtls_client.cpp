@@ -0,0 +1,357 @@
+/*!
+    \file dtls_client.cpp
+    \brief DTLS client implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/dtls_client.h"
+
+namespace CppServer {
+namespace Asio {
+
+DTLSClient::DTLSClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, int port)
+    : UDPClient(service, address, port),
+      _context(context),
+      _handshaked(false),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false),
+      _option_mtu(1400)
+{
+    assert((context != nullptr) && "SSL context is invalid!");
+    if (context == nullptr)
+        throw CppCommon::ArgumentException("SSL context is invalid!");
+}
+
+DTLSClient::DTLSClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, const std::string& scheme)
+    : UDPClient(service, address, scheme),
+      _context(context),
+      _handshaked(false),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false),
+      _option_mtu(1400)
+{
+    assert((context != nullptr) && "SSL context is invalid!");
+    if (context == nullptr)
+        throw CppCommon::ArgumentException("SSL context is invalid!");
+}
+
+DTLSClient::DTLSClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const asio::ip::udp::endpoint& endpoint)
+    : UDPClient(service, endpoint),
+      _context(context),
+      _handshaked(false),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false),
+      _option_mtu(1400)
+{
+    assert((context != nullptr) && "SSL context is invalid!");
+    if (context == nullptr)
+        throw CppCommon::ArgumentException("SSL context is invalid!");
+}
+
+bool DTLSClient::Connect()
+{
+    if (!UDPClient::Connect())
+        return false;
+
+    // Start the handshake
+    Handshake();
+
+    return true;
+}
+
+bool DTLSClient::Connect(std::shared_ptr<UDPResolver> resolver)
+{
+    if (!UDPClient::Connect(resolver))
+        return false;
+
+    // Start the handshake
+    Handshake();
+
+    return true;
+}
+
+bool DTLSClient::Disconnect()
+{
+    if (!IsConnected())
+        return false;
+
+    RUDPQueue output;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Send the close notify alert and close the protocol
+        _protocol.Shutdown();
+        _protocol.TakeOutput(output);
+        _protocol.Close();
+        _handshaked = false;
+
+        // Cancel the handshake retransmission timer
+        asio::error_code ec;
+        _flush_timer.cancel(ec);
+    }
+
+    // Send protocol datagrams
+    Output(output);
+
+    return UDPClient::Disconnect();
+}
+
+size_t DTLSClient::Send(const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    if (!IsConnected())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    // Start the handshake if the client was connected with the asynchronous resolver
+    Handshake();
+
+    RUDPQueue output;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Encrypt the message or queue it until the handshake is completed
+        if (!_protocol.Send(buffer, size))
+            return 0;
+
+        _protocol.TakeOutput(output);
+    }
+
+    // Send protocol datagrams
+    Output(output);
+
+    return size;
+}
+
+bool DTLSClient::SendAsync(const void* buffer, size_t size)
+{
+    if (size == 0)
+        return IsConnected();
+
+    return (Send(buffer, size) > 0);
+}
+
+void DTLSClient::ReceiveAsync()
+{
+    // Start the handshake if the client was connected with the asynchronous resolver
+    Handshake();
+
+    UDPClient::ReceiveAsync();
+}
+
+void DTLSClient::onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size)
+{
+    // Skip datagrams from other endpoints
+    if (endpoint == this->endpoint())
+    {
+        RUDPQueue output;
+        bool handshaked;
+        bool closed;
+        unsigned long error = 0;
+        {
+            std::scoped_lock locker(_protocol_lock);
+
+            if (!_protocol.IsOpened())
+                return;
+
+            // Input the datagram into the protocol
+            bool before = _protocol.IsHandshaked();
+            if (!_protocol.Input(buffer, size))
+                error = _protocol.error();
+            handshaked = !before && _protocol.IsHandshaked();
+            closed = _protocol.IsClosed();
+            _protocol.TakeOutput(output);
+        }
+
+        // Send protocol datagrams
+        Output(output);
+
+        // Call the client handshaked handler
+        if (handshaked)
+        {
+            _handshaked = true;
+            onHandshaked();
+        }
+
+        // Deliver decrypted messages
+        Deliver();
+
+        // Disconnect on the protocol error or the close notify alert of the server
+        if ((error != 0) || closed)
+        {
+            if (error != 0)
+                SendError(error);
+            DisconnectAsync();
+            return;
+        }
+
+        // Schedule handshake retransmissions
+        ScheduleFlush();
+    }
+
+    // Receive the next datagram
+    UDPClient::ReceiveAsync();
+}
+
+void DTLSClient::Handshake()
+{
+    if (!IsConnected())
+        return;
+
+    RUDPQueue output;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        if (_protocol.IsOpened())
+            return;
+
+        // Open the protocol and send ClientHello
+        _handshaked = false;
+        _protocol.SetupMTU(_option_mtu);
+        if (!_protocol.Open(_context->native_handle(), false))
+            return;
+        _protocol.Connect();
+        _protocol.TakeOutput(output);
+    }
+
+    // Send protocol datagrams
+    Output(output);
+
+    // Receive the server handshake flights
+    UDPClient::ReceiveAsync();
+
+    // Schedule handshake retransmissions
+    ScheduleFlush();
+}
+
+void DTLSClient::Flush()
+{
+    if (!IsConnected())
+        return;
+
+    RUDPQueue output;
+    unsigned long error;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Retransmit the last handshake flight
+        _protocol.Flush();
+        error = _protocol.IsFailed() ? _protocol.error() : 0;
+        _protocol.TakeOutput(output);
+    }
+
+    // Send protocol datagrams
+    Output(output);
+
+    // Disconnect on the protocol error
+    if (error != 0)
+    {
+        SendError(error);
+        DisconnectAsync();
+        return;
+    }
+
+    // Schedule handshake retransmissions
+    ScheduleFlush();
+}
+
+void DTLSClient::ScheduleFlush()
+{
+    if (!IsConnected())
+        return;
+
+    std::scoped_lock locker(_protocol_lock);
+
+    if (_flushing || !_protocol.IsPending())
+        return;
+
+    _flushing = true;
+
+    // Async wait for the handshake retransmission timeout with the flush handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const std::error_code& ec)
+    {
+        {
+            std::scoped_lock locker(_protocol_lock);
+            _flushing = false;
+        }
+
+        if (ec || !IsConnected())
+            return;
+
+        // Flush the protocol
+        Flush();
+    };
+    _flush_timer.expires_from_now(std::chrono::nanoseconds(_protocol.timeout().total()));
+    if (service()->IsStrandRequired())
+        _flush_timer.async_wait(bind_executor(strand(), async_wait_handler));
+    else
+        _flush_timer.async_wait(async_wait_handler);
+}
+
+void DTLSClient::Output(const RUDPQueue& output)
+{
+    const uint8_t* datagram = output.buffer.data();
+    for (size_t size : output.sizes)
+    {
+        UDPClient::Send(endpoint(), datagram, size);
+        datagram += size;
+    }
+}
+
+void DTLSClient::Deliver()
+{
+    RUDPQueue delivered;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Only one thread delivers messages to keep their order
+        if (_delivering)
+            return;
+
+        _protocol.TakeDelivered(delivered);
+        if (delivered.empty())
+            return;
+
+        _delivering = true;
+    }
+
+    for (;;)
+    {
+        // Call the message received handler for each decrypted message
+        const uint8_t* message = delivered.buffer.data();
+        for (size_t size : delivered.sizes)
+        {
+            onReceived(message, size);
+            message += size;
+        }
+
+        // Take messages decrypted in the meantime by other threads
+        std::scoped_lock locker(_protocol_lock);
+        _protocol.TakeDelivered(delivered);
+        if (delivered.empty())
+        {
+            _delivering = false;
+            return;
+        }
+    }
+}
+
+void DTLSClient::SendError(unsigned long error)
+{
+    asio::error_code ec((int)error, asio::error::get_ssl_category());
+    onError(ec.value(), ec.category().name(), ec.message());
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,138 @@
+/*!
+    \file dtls_server.cpp
+    \brief DTLS server implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/dtls_server.h"
+
+#include <openssl/rand.h>
+
+namespace CppServer {
+namespace Asio {
+
+DTLSServer::DTLSServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, int port, InternetProtocol protocol)
+    : UDPServer(service, port, protocol),
+      _context(context),
+      _cookies_sent(0),
+      _cookies_verified(0),
+      _handshakes(0),
+      _handshakes_failed(0),
+      _option_mtu(1400)
+{
+    assert((context != nullptr) && "SSL context is invalid!");
+    if (context == nullptr)
+        throw CppCommon::ArgumentException("SSL context is invalid!");
+
+    PrepareCookieExchange();
+}
+
+DTLSServer::DTLSServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, int port)
+    : UDPServer(service, address, port),
+      _context(context),
+      _cookies_sent(0),
+      _cookies_verified(0),
+      _handshakes(0),
+      _handshakes_failed(0),
+      _option_mtu(1400)
+{
+    assert((context != nullptr) && "SSL context is invalid!");
+    if (context == nullptr)
+        throw CppCommon::ArgumentException("SSL context is invalid!");
+
+    PrepareCookieExchange();
+}
+
+DTLSServer::DTLSServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const asio::ip::udp::endpoint& endpoint)
+    : UDPServer(service, endpoint),
+      _context(context),
+      _cookies_sent(0),
+      _cookies_verified(0),
+      _handshakes(0),
+      _handshakes_failed(0),
+      _option_mtu(1400)
+{
+    assert((context != nullptr) && "SSL context is invalid!");
+    if (context == nullptr)
+        throw CppCommon::ArgumentException("SSL context is invalid!");
+
+    PrepareCookieExchange();
+}
+
+void DTLSServer::PrepareCookieExchange()
+{
+    // Generate the cookie secret key of the server
+    if (RAND_bytes(_cookie_secret, (int)sizeof(_cookie_secret)) != 1)
+        throw CppCommon::SystemException("Failed to generate the DTLS cookie secret!");
+
+    // Install cookie callbacks and open the stateless listener protocol
+    DTLSProtocol::SetupCookieExchange(_context->native_handle());
+    if (!_listener.Open(_context->native_handle(), true))
+        throw CppCommon::SystemException("Failed to create the DTLS listener!");
+}
+
+void DTLSServer::onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size)
+{
+    // Dispatch datagrams of registered peers to their sessions
+    if (FindSession(endpoint))
+    {
+        UDPServer::onReceived(endpoint, buffer, size);
+        return;
+    }
+
+    // Stateless cookie exchange with the unknown peer
+    RUDPQueue output;
+    bool verified;
+    {
+        std::scoped_lock locker(_listener_lock);
+
+        _listener.SetupCookie(_cookie_secret, PeerIdentity(endpoint));
+        verified = _listener.Listen(buffer, size);
+        _listener.TakeOutput(output);
+    }
+
+    // Send HelloVerifyRequest
+    const uint8_t* datagram = output.buffer.data();
+    for (size_t datagram_size : output.sizes)
+    {
+        ++_cookies_sent;
+        Send(endpoint, datagram, datagram_size);
+        datagram += datagram_size;
+    }
+
+    // Create a new session for ClientHello with the valid cookie
+    if (verified)
+    {
+        ++_cookies_verified;
+        UDPServer::onReceived(endpoint, buffer, size);
+    }
+}
+
+std::shared_ptr<UDPSession> DTLSServer::CreateSession(std::shared_ptr<UDPServer> server, const asio::ip::udp::endpoint& endpoint)
+{
+    return CreateSession(std::static_pointer_cast<DTLSServer>(server), endpoint);
+}
+
+std::string DTLSServer::PeerIdentity(const asio::ip::udp::endpoint& endpoint)
+{
+    // Peer address bytes and port number
+    std::string peer;
+    if (endpoint.address().is_v4())
+    {
+        auto bytes = endpoint.address().to_v4().to_bytes();
+        peer.assign((const char*)bytes.data(), bytes.size());
+    }
+    else
+    {
+        auto bytes = endpoint.address().to_v6().to_bytes();
+        peer.assign((const char*)bytes.data(), bytes.size());
+    }
+    unsigned short port = endpoint.port();
+    peer.append((const char*)&port, sizeof(port));
+    return peer;
+}
+
+} // namespace Asio
+} // namespace CppServer
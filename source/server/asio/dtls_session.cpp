@@ -0,0 +1,265 @@
+/*!
+    \file dtls_session.cpp
+    \brief DTLS session implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/dtls_session.h"
+#include "server/asio/dtls_server.h"
+
+namespace CppServer {
+namespace Asio {
+
+DTLSSession::DTLSSession(std::shared_ptr<DTLSServer> server, const asio::ip::udp::endpoint& endpoint)
+    : UDPSession(server, endpoint),
+      _dtls_server(server),
+      _handshaked(false),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false)
+{
+    // The session is created for ClientHello with the verified cookie, which is verified again by the session protocol
+    _protocol.SetupMTU(server->option_mtu());
+    _protocol.SetupCookie(server->_cookie_secret, DTLSServer::PeerIdentity(endpoint));
+    _protocol.Open(server->context()->native_handle(), true);
+}
+
+bool DTLSSession::Disconnect()
+{
+    if (!IsConnected())
+        return false;
+
+    RUDPQueue output;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Send the close notify alert
+        _protocol.Shutdown();
+        _protocol.TakeOutput(output);
+
+        // Cancel the handshake retransmission timer
+        asio::error_code ec;
+        _flush_timer.cancel(ec);
+    }
+
+    // Send protocol datagrams
+    Output(output);
+
+    return UDPSession::Disconnect();
+}
+
+size_t DTLSSession::Send(const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    if (!IsConnected())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    RUDPQueue output;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Encrypt the message or queue it until the handshake is completed
+        if (!_protocol.Send(buffer, size))
+            return 0;
+
+        _protocol.TakeOutput(output);
+    }
+
+    // Send protocol datagrams
+    Output(output);
+
+    return size;
+}
+
+bool DTLSSession::SendAsync(const void* buffer, size_t size)
+{
+    if (size == 0)
+        return IsConnected();
+
+    return (Send(buffer, size) > 0);
+}
+
+void DTLSSession::onReceivedDatagram(const void* buffer, size_t size)
+{
+    RUDPQueue output;
+    bool handshaked;
+    bool closed;
+    unsigned long error = 0;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Input the datagram into the protocol
+        bool before = _protocol.IsHandshaked();
+        if (!_protocol.Input(buffer, size))
+            error = _protocol.error();
+        handshaked = !before && _protocol.IsHandshaked();
+        closed = _protocol.IsClosed();
+        _protocol.TakeOutput(output);
+    }
+
+    // Send protocol datagrams
+    Output(output);
+
+    // Call the session handshaked handler
+    if (handshaked)
+    {
+        _handshaked = true;
+        ++_dtls_server->_handshakes;
+        onHandshaked();
+    }
+
+    // Deliver decrypted messages
+    Deliver();
+
+    // Disconnect on the protocol error
+    if (error != 0)
+    {
+        if (!_handshaked)
+            ++_dtls_server->_handshakes_failed;
+        SendError(error);
+        UDPSession::Disconnect();
+        return;
+    }
+
+    // Disconnect on the close notify alert of the peer
+    if (closed)
+    {
+        Disconnect();
+        return;
+    }
+
+    // Schedule handshake retransmissions
+    ScheduleFlush();
+}
+
+void DTLSSession::Flush()
+{
+    if (!IsConnected())
+        return;
+
+    RUDPQueue output;
+    unsigned long error;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Retransmit the last handshake flight
+        _protocol.Flush();
+        error = _protocol.IsFailed() ? _protocol.error() : 0;
+        _protocol.TakeOutput(output);
+    }
+
+    // Send protocol datagrams
+    Output(output);
+
+    // Disconnect on the protocol error
+    if (error != 0)
+    {
+        if (!_handshaked)
+            ++_dtls_server->_handshakes_failed;
+        SendError(error);
+        UDPSession::Disconnect();
+        return;
+    }
+
+    // Schedule handshake retransmissions
+    ScheduleFlush();
+}
+
+void DTLSSession::ScheduleFlush()
+{
+    if (!IsConnected())
+        return;
+
+    std::scoped_lock locker(_protocol_lock);
+
+    if (_flushing || !_protocol.IsPending())
+        return;
+
+    _flushing = true;
+
+    // Async wait for the handshake retransmission timeout with the flush handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const std::error_code& ec)
+    {
+        {
+            std::scoped_lock locker(_protocol_lock);
+            _flushing = false;
+        }
+
+        if (ec || !IsConnected())
+            return;
+
+        // Flush the protocol
+        Flush();
+    };
+    _flush_timer.expires_from_now(std::chrono::nanoseconds(_protocol.timeout().total()));
+    if (server()->service()->IsStrandRequired())
+        _flush_timer.async_wait(bind_executor(strand(), async_wait_handler));
+    else
+        _flush_timer.async_wait(async_wait_handler);
+}
+
+void DTLSSession::Output(const RUDPQueue& output)
+{
+    const uint8_t* datagram = output.buffer.data();
+    for (size_t size : output.sizes)
+    {
+        UDPSession::Send(datagram, size);
+        datagram += size;
+    }
+}
+
+void DTLSSession::Deliver()
+{
+    RUDPQueue delivered;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Only one thread delivers messages to keep their order
+        if (_delivering)
+            return;
+
+        _protocol.TakeDelivered(delivered);
+        if (delivered.empty())
+            return;
+
+        _delivering = true;
+    }
+
+    for (;;)
+    {
+        // Call the message received handler for each decrypted message
+        const uint8_t* message = delivered.buffer.data();
+        for (size_t size : delivered.sizes)
+        {
+            onReceived(message, size);
+            message += size;
+        }
+
+        // Take messages decrypted in the meantime by other threads
+        std::scoped_lock locker(_protocol_lock);
+        _protocol.TakeDelivered(delivered);
+        if (delivered.empty())
+        {
+            _delivering = false;
+            return;
+        }
+    }
+}
+
+void DTLSSession::SendError(unsigned long error)
+{
+    asio::error_code ec((int)error, asio::error::get_ssl_category());
+    onError(ec.value(), ec.category().name(), ec.message());
+}
+
+} // namespace Asio
+} // namespace CppServer
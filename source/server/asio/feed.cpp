@@ -0,0 +1,419 @@
+/*!
+    \file feed.cpp
+    \brief Sequenced feed protocol implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/feed.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+static inline void Write32(uint8_t* buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+    buffer[2] = (uint8_t)(value >> 16);
+    buffer[3] = (uint8_t)(value >> 24);
+}
+
+static inline void Write64(uint8_t* buffer, uint64_t value)
+{
+    Write32(buffer, (uint32_t)value);
+    Write32(buffer + 4, (uint32_t)(value >> 32));
+}
+
+static inline uint32_t Read32(const uint8_t* buffer)
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+static inline uint64_t Read64(const uint8_t* buffer)
+{
+    return (uint64_t)Read32(buffer) | ((uint64_t)Read32(buffer + 4) << 32);
+}
+
+//! @endcond
+
+void FeedQueue::push(uint64_t sequence, const void* data, size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    buffer.insert(buffer.end(), bytes, bytes + size);
+    entries.push_back({ sequence, size, 0 });
+}
+
+void FeedProtocol::WriteHeader(uint8_t* buffer, uint64_t sequence) noexcept
+{
+    Write64(buffer, sequence);
+}
+
+uint64_t FeedProtocol::ReadHeader(const uint8_t* buffer) noexcept
+{
+    return Read64(buffer);
+}
+
+void FeedProtocol::WriteRequest(uint8_t* buffer, uint64_t sequence, uint32_t count) noexcept
+{
+    Write64(buffer, sequence);
+    Write32(buffer + 8, count);
+}
+
+FeedRange FeedProtocol::ReadRequest(const uint8_t* buffer) noexcept
+{
+    return { Read64(buffer), Read32(buffer + 8) };
+}
+
+void FeedProtocol::WriteRecord(uint8_t* buffer, uint32_t size, uint64_t sequence) noexcept
+{
+    Write32(buffer, size);
+    Write64(buffer + 4, sequence);
+}
+
+void FeedProtocol::ReadRecord(const uint8_t* buffer, uint32_t& size, uint64_t& sequence) noexcept
+{
+    size = Read32(buffer);
+    sequence = Read64(buffer + 4);
+}
+
+void FeedProtocol::WriteUnavailable(uint8_t* buffer, uint64_t sequence, uint32_t count) noexcept
+{
+    WriteRecord(buffer, UNAVAILABLE, sequence);
+    Write32(buffer + RECORD_SIZE, count);
+}
+
+uint32_t FeedProtocol::ReadUnavailable(const uint8_t* buffer) noexcept
+{
+    return Read32(buffer + RECORD_SIZE);
+}
+
+FeedHistory::FeedHistory(size_t capacity, size_t message_size)
+    : _capacity(std::max(capacity, (size_t)1)),
+      _message_size(message_size),
+      _buffer(_capacity * _message_size),
+      _sizes(_capacity, 0),
+      _first(1),
+      _next(1)
+{
+}
+
+uint64_t FeedHistory::first() const
+{
+    std::scoped_lock locker(_lock);
+    return _first;
+}
+
+uint64_t FeedHistory::next() const
+{
+    std::scoped_lock locker(_lock);
+    return _next;
+}
+
+uint64_t FeedHistory::Store(const void* buffer, size_t size)
+{
+    if (size > _message_size)
+        return 0;
+
+    std::scoped_lock locker(_lock);
+
+    // Overwrite the oldest slot
+    uint64_t sequence = _next++;
+    size_t slot = (size_t)(sequence % _capacity);
+    if (size > 0)
+        std::memcpy(_buffer.data() + slot * _message_size, buffer, size);
+    _sizes[slot] = size;
+    if ((_next - _first) > _capacity)
+        _first = _next - _capacity;
+
+    return sequence;
+}
+
+size_t FeedHistory::Copy(uint64_t sequence, uint64_t count, FeedQueue& queue) const
+{
+    std::scoped_lock locker(_lock);
+
+    uint64_t begin = std::max(sequence, _first);
+    uint64_t end = std::min(((sequence + count) < sequence) ? _next : (sequence + count), _next);
+    for (uint64_t current = begin; current < end; ++current)
+    {
+        size_t slot = (size_t)(current % _capacity);
+        queue.push(current, _buffer.data() + slot * _message_size, _sizes[slot]);
+    }
+
+    return (end > begin) ? (size_t)(end - begin) : 0;
+}
+
+void FeedHistory::Clear()
+{
+    std::scoped_lock locker(_lock);
+    _first = 1;
+    _next = 1;
+}
+
+FeedReceiver::FeedReceiver()
+    : _option_reorder_window(4096),
+      _option_reorder_delay(CppCommon::Timespan::milliseconds(1)),
+      _option_retransmit_timeout(CppCommon::Timespan::milliseconds(100)),
+      _option_retransmit_attempts(3)
+{
+    Reset();
+}
+
+void FeedReceiver::Reset()
+{
+    // Reset receive state
+    _next = 0;
+    _highest = 0;
+    _reorder.clear();
+    _gaps.clear();
+
+    // Reset requests & delivered queues
+    _requests.clear();
+    _delivered.clear();
+
+    // Reset statistic
+    _messages_received = 0;
+    _messages_recovered = 0;
+    _messages_lost = 0;
+    _messages_reordered = 0;
+    _messages_duplicated = 0;
+    _gaps_detected = 0;
+    _requests_sent = 0;
+    _packets_invalid = 0;
+}
+
+bool FeedReceiver::Input(const void* buffer, size_t size, uint64_t timestamp)
+{
+    if ((buffer == nullptr) || (size < FeedProtocol::HEADER_SIZE))
+    {
+        ++_packets_invalid;
+        return false;
+    }
+
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    uint64_t sequence = FeedProtocol::ReadHeader(bytes);
+    if (sequence == 0)
+    {
+        ++_packets_invalid;
+        return false;
+    }
+
+    // Synchronize with the first received message
+    if (_next == 0)
+    {
+        _next = sequence;
+        _highest = sequence - 1;
+    }
+
+    InputMessage(sequence, bytes + FeedProtocol::HEADER_SIZE, size - FeedProtocol::HEADER_SIZE, timestamp, false);
+    return true;
+}
+
+void FeedReceiver::Recover(uint64_t sequence, const void* buffer, size_t size, uint64_t timestamp)
+{
+    // Skip recovered messages before the synchronization
+    if ((_next == 0) || (sequence == 0))
+        return;
+
+    if (InputMessage(sequence, (const uint8_t*)buffer, size, timestamp, true))
+        ++_messages_recovered;
+}
+
+void FeedReceiver::Unavailable(uint64_t sequence, uint64_t count)
+{
+    if ((_next == 0) || (count == 0))
+        return;
+
+    uint64_t end = sequence + count;
+    if (end < sequence)
+        end = (uint64_t)-1;
+
+    MarkLost(sequence, end);
+}
+
+bool FeedReceiver::InputMessage(uint64_t sequence, const uint8_t* payload, size_t size, uint64_t timestamp, bool recovered)
+{
+    // Skip already delivered and already buffered messages
+    if ((sequence < _next) || (_reorder.find(sequence) != _reorder.end()))
+    {
+        ++_messages_duplicated;
+        return false;
+    }
+
+    if (sequence > _highest)
+    {
+        // Open a new gap before the message
+        if (sequence > (_highest + 1))
+        {
+            _gaps.emplace(_highest + 1, Gap{ sequence, timestamp, 0, 0, false });
+            ++_gaps_detected;
+        }
+        _highest = sequence;
+    }
+    else
+    {
+        // Fill the message into the gap it belongs to
+        auto it = _gaps.upper_bound(sequence);
+        if (it != _gaps.begin())
+        {
+            --it;
+            if (sequence < it->second.end)
+            {
+                uint64_t begin = it->first;
+                Gap gap = it->second;
+                _gaps.erase(it);
+                if (begin < sequence)
+                {
+                    Gap left = gap;
+                    left.end = sequence;
+                    _gaps.emplace(begin, left);
+                }
+                if ((sequence + 1) < gap.end)
+                    _gaps.emplace(sequence + 1, gap);
+            }
+        }
+        if (!recovered)
+            ++_messages_reordered;
+    }
+
+    // Buffer the message until all previous messages are delivered
+    if (sequence == _next)
+    {
+        _delivered.push(sequence, payload, size);
+        ++_messages_received;
+        ++_next;
+    }
+    else
+        _reorder.emplace(sequence, std::vector<uint8_t>(payload, payload + size));
+
+    // Deliver contiguous messages
+    Deliver();
+
+    // Declare the oldest gaps lost while the reorder buffer overflows
+    while ((_reorder.size() > option_reorder_window()) && !_gaps.empty())
+    {
+        _gaps.begin()->second.lost = true;
+        Deliver();
+    }
+
+    return true;
+}
+
+void FeedReceiver::MarkLost(uint64_t sequence, uint64_t end)
+{
+    // Find the first gap overlapping with the lost range
+    auto it = _gaps.upper_bound(sequence);
+    if (it != _gaps.begin())
+    {
+        auto prev = std::prev(it);
+        if (prev->second.end > sequence)
+            it = prev;
+    }
+
+    while ((it != _gaps.end()) && (it->first < end))
+    {
+        uint64_t begin = it->first;
+        Gap gap = it->second;
+        it = _gaps.erase(it);
+
+        // Split the gap into the received part before, the lost part and the received part after
+        uint64_t lost_begin = std::max(begin, sequence);
+        uint64_t lost_end = std::min(gap.end, end);
+        if (begin < lost_begin)
+        {
+            Gap left = gap;
+            left.end = lost_begin;
+            _gaps.emplace(begin, left);
+        }
+        Gap lost = gap;
+        lost.end = lost_end;
+        lost.lost = true;
+        _gaps.emplace(lost_begin, lost);
+        if (lost_end < gap.end)
+            it = _gaps.emplace(lost_end, gap).first;
+    }
+
+    // Skip lost gaps
+    Deliver();
+}
+
+void FeedReceiver::Flush(uint64_t timestamp)
+{
+    for (auto& [begin, gap] : _gaps)
+    {
+        if (gap.lost)
+            continue;
+
+        // Wait for reordered packets and for the previous retransmit response
+        if ((timestamp < (gap.detected + (uint64_t)option_reorder_delay().total())) || (timestamp < gap.deadline))
+            continue;
+
+        // Declare the gap lost after all retransmit attempts
+        if (gap.attempts >= option_retransmit_attempts())
+        {
+            gap.lost = true;
+            continue;
+        }
+
+        // Request the gap from the retransmit service
+        uint64_t count = std::min(gap.end - begin, (uint64_t)0xFFFFFFFF);
+        _requests.push_back({ begin, count });
+        ++_requests_sent;
+        ++gap.attempts;
+        gap.deadline = timestamp + (uint64_t)option_retransmit_timeout().total();
+    }
+
+    // Skip lost gaps
+    Deliver();
+}
+
+void FeedReceiver::Deliver()
+{
+    for (;;)
+    {
+        // Deliver the next buffered message
+        auto message = _reorder.begin();
+        if ((message != _reorder.end()) && (message->first == _next))
+        {
+            _delivered.push(_next, message->second.data(), message->second.size());
+            ++_messages_received;
+            ++_next;
+            _reorder.erase(message);
+            continue;
+        }
+
+        // Skip the next lost gap
+        auto gap = _gaps.begin();
+        if ((gap != _gaps.end()) && (gap->first == _next) && gap->second.lost)
+        {
+            _delivered.push_lost(_next, gap->second.end - _next);
+            _messages_lost += gap->second.end - _next;
+            _next = gap->second.end;
+            _gaps.erase(gap);
+            continue;
+        }
+
+        break;
+    }
+}
+
+void FeedReceiver::TakeRequests(std::vector<FeedRange>& requests)
+{
+    requests.clear();
+    std::swap(requests, _requests);
+}
+
+void FeedReceiver::TakeDelivered(FeedQueue& queue)
+{
+    queue.clear();
+    std::swap(queue, _delivered);
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,308 @@
+/*!
+    \file feed_client.cpp
+    \brief Sequenced feed client implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/feed_client.h"
+#include "server/asio/tcp_client.h"
+
+#include "time/timestamp.h"
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+// Retransmit client sends retransmit requests and reads retransmit responses
+class FeedClient::Recovery : public TCPClient
+{
+public:
+    Recovery(std::shared_ptr<Service> service, const std::string& address, int port, std::weak_ptr<UDPClient> owner)
+        : TCPClient(service, address, port),
+          _owner(owner)
+    {
+    }
+
+    void Request(const std::vector<FeedRange>& requests)
+    {
+        {
+            std::scoped_lock locker(_requests_lock);
+
+            // Queue retransmit requests until the client is connected
+            for (const auto& request : requests)
+            {
+                size_t offset = _requests.size();
+                _requests.resize(offset + FeedProtocol::REQUEST_SIZE);
+                FeedProtocol::WriteRequest(_requests.data() + offset, request.sequence, (uint32_t)request.count);
+            }
+        }
+
+        if (IsConnected())
+            SendRequests();
+        else
+            ConnectAsync();
+    }
+
+protected:
+    void onConnected() override
+    {
+        // Drop the response tail of the previous connection
+        _response.clear();
+
+        SendRequests();
+    }
+
+    void onReceived(const void* buffer, size_t size) override
+    {
+        auto owner = _owner.lock();
+        if (!owner)
+            return;
+
+        auto& client = static_cast<FeedClient&>(*owner);
+
+        // Input all complete retransmit response records
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        _response.insert(_response.end(), bytes, bytes + size);
+        size_t consumed = client.Recover(_response.data(), _response.size());
+        _response.erase(_response.begin(), _response.begin() + consumed);
+
+        // Deliver recovered messages
+        client.Deliver();
+        client.ScheduleFlush();
+    }
+
+private:
+    std::weak_ptr<UDPClient> _owner;
+    std::mutex _requests_lock;
+    std::vector<uint8_t> _requests;
+    std::vector<uint8_t> _response;
+
+    void SendRequests()
+    {
+        std::scoped_lock locker(_requests_lock);
+
+        if (!_requests.empty() && SendAsync(_requests.data(), _requests.size()))
+            _requests.clear();
+    }
+};
+
+//! @endcond
+
+FeedClient::FeedClient(std::shared_ptr<Service> service, const std::string& address, int port)
+    : UDPClient(service, address, port),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false),
+      _option_recovery_port(0),
+      _option_flush_interval(CppCommon::Timespan::milliseconds(1))
+{
+}
+
+FeedClient::FeedClient(std::shared_ptr<Service> service, const asio::ip::udp::endpoint& endpoint)
+    : UDPClient(service, endpoint),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false),
+      _option_recovery_port(0),
+      _option_flush_interval(CppCommon::Timespan::milliseconds(1))
+{
+}
+
+FeedClient::~FeedClient()
+{
+    // Disconnect the retransmit client
+    if (_recovery)
+        _recovery->DisconnectAsync();
+}
+
+void FeedClient::onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size)
+{
+    std::vector<FeedRange> requests;
+    {
+        std::scoped_lock locker(_receiver_lock);
+
+        // Input the feed packet and flush gaps
+        uint64_t timestamp = CppCommon::Timestamp::nano();
+        _receiver.Input(buffer, size, timestamp);
+        _receiver.Flush(timestamp);
+        _receiver.TakeRequests(requests);
+    }
+
+    // Send retransmit requests
+    Request(requests);
+
+    // Deliver received messages
+    Deliver();
+
+    // Schedule gaps recovery
+    ScheduleFlush();
+
+    // Receive the next feed packet
+    ReceiveAsync();
+}
+
+void FeedClient::Flush()
+{
+    std::vector<FeedRange> requests;
+    {
+        std::scoped_lock locker(_receiver_lock);
+
+        // Flush expired gaps
+        _receiver.Flush(CppCommon::Timestamp::nano());
+        _receiver.TakeRequests(requests);
+    }
+
+    // Send retransmit requests
+    Request(requests);
+
+    // Deliver lost ranges
+    Deliver();
+
+    // Schedule gaps recovery
+    ScheduleFlush();
+}
+
+void FeedClient::ScheduleFlush()
+{
+    {
+        std::scoped_lock locker(_receiver_lock);
+
+        if (_flushing || !_receiver.IsPending())
+            return;
+
+        _flushing = true;
+    }
+
+    // Async wait for the next flush with the flush handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const std::error_code& ec)
+    {
+        {
+            std::scoped_lock locker(_receiver_lock);
+            _flushing = false;
+        }
+
+        if (ec)
+            return;
+
+        // Flush the receiver
+        Flush();
+    };
+    _flush_timer.expires_from_now(std::chrono::nanoseconds(_option_flush_interval.total()));
+    if (service()->IsStrandRequired())
+        _flush_timer.async_wait(bind_executor(strand(), async_wait_handler));
+    else
+        _flush_timer.async_wait(async_wait_handler);
+}
+
+void FeedClient::Request(const std::vector<FeedRange>& requests)
+{
+    if (requests.empty())
+        return;
+
+    // Without the retransmit server requested gaps are lost
+    if (_option_recovery_address.empty())
+    {
+        std::scoped_lock locker(_receiver_lock);
+        for (const auto& request : requests)
+            _receiver.Unavailable(request.sequence, request.count);
+        return;
+    }
+
+    std::shared_ptr<Recovery> recovery;
+    {
+        std::scoped_lock locker(_receiver_lock);
+
+        // Create the retransmit client on the first request
+        if (!_recovery)
+            _recovery = std::make_shared<Recovery>(service(), _option_recovery_address, _option_recovery_port, this->shared_from_this());
+        recovery = _recovery;
+    }
+
+    recovery->Request(requests);
+}
+
+size_t FeedClient::Recover(const uint8_t* buffer, size_t size)
+{
+    std::scoped_lock locker(_receiver_lock);
+
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+
+    size_t offset = 0;
+    while ((size - offset) >= FeedProtocol::RECORD_SIZE)
+    {
+        uint32_t record_size;
+        uint64_t sequence;
+        FeedProtocol::ReadRecord(buffer + offset, record_size, sequence);
+
+        if (record_size == FeedProtocol::UNAVAILABLE)
+        {
+            if ((size - offset) < FeedProtocol::UNAVAILABLE_SIZE)
+                break;
+
+            // Declare unavailable messages lost
+            _receiver.Unavailable(sequence, FeedProtocol::ReadUnavailable(buffer + offset));
+            offset += FeedProtocol::UNAVAILABLE_SIZE;
+        }
+        else
+        {
+            if ((size - offset) < (FeedProtocol::RECORD_SIZE + record_size))
+                break;
+
+            // Input the recovered message
+            _receiver.Recover(sequence, buffer + offset + FeedProtocol::RECORD_SIZE, record_size, timestamp);
+            offset += FeedProtocol::RECORD_SIZE + record_size;
+        }
+    }
+
+    return offset;
+}
+
+void FeedClient::Deliver()
+{
+    FeedQueue delivered;
+    {
+        std::scoped_lock locker(_receiver_lock);
+
+        // Only one thread delivers messages to keep their order
+        if (_delivering)
+            return;
+
+        _receiver.TakeDelivered(delivered);
+        if (delivered.empty())
+            return;
+
+        _delivering = true;
+    }
+
+    for (;;)
+    {
+        // Call handlers for each delivered message and lost range
+        const uint8_t* message = delivered.buffer.data();
+        for (const auto& entry : delivered.entries)
+        {
+            if (entry.lost > 0)
+                onLost(entry.sequence, entry.lost);
+            else
+            {
+                onReceived(entry.sequence, message, entry.size);
+                message += entry.size;
+            }
+        }
+
+        // Take messages delivered in the meantime by other threads
+        std::scoped_lock locker(_receiver_lock);
+        _receiver.TakeDelivered(delivered);
+        if (delivered.empty())
+        {
+            _delivering = false;
+            return;
+        }
+    }
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,59 @@
+/*!
+    \file feed_publisher.cpp
+    \brief Sequenced feed publisher implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/feed_publisher.h"
+
+#include <cstring>
+
+namespace CppServer {
+namespace Asio {
+
+FeedPublisher::FeedPublisher(std::shared_ptr<Service> service, int port, std::shared_ptr<FeedHistory> history)
+    : UDPServer(service, port),
+      _history(history),
+      _messages_published(0)
+{
+    assert((history != nullptr) && "Feed history is invalid!");
+    if (history == nullptr)
+        throw CppCommon::ArgumentException("Feed history is invalid!");
+}
+
+uint64_t FeedPublisher::Publish(const void* buffer, size_t size)
+{
+    assert(((buffer != nullptr) || (size == 0)) && "Pointer to the buffer should not be null!");
+    if ((buffer == nullptr) && (size > 0))
+        return 0;
+
+    if (!IsStarted())
+        return 0;
+
+    // Publish messages one by one to keep sequence numbers in order on the wire
+    std::scoped_lock locker(_publish_lock);
+
+    // Store the message into the feed history
+    uint64_t sequence = _history->Store(buffer, size);
+    if (sequence == 0)
+        return 0;
+
+    // Prepare the feed packet
+    _packet.resize(FeedProtocol::HEADER_SIZE + size);
+    FeedProtocol::WriteHeader(_packet.data(), sequence);
+    if (size > 0)
+        std::memcpy(_packet.data() + FeedProtocol::HEADER_SIZE, buffer, size);
+
+    // Multicast the feed packet
+    Multicast(_packet.data(), _packet.size());
+
+    // Update statistic
+    ++_messages_published;
+
+    return sequence;
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,114 @@
+/*!
+    \file feed_retransmit.cpp
+    \brief Sequenced feed retransmit server implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/feed_retransmit.h"
+
+#include <algorithm>
+
+namespace CppServer {
+namespace Asio {
+
+FeedRetransmitSession::FeedRetransmitSession(std::shared_ptr<TCPServer> server, std::shared_ptr<FeedHistory> history)
+    : TCPSession(server),
+      _history(history)
+{
+}
+
+void FeedRetransmitSession::onReceived(const void* buffer, size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _request.insert(_request.end(), bytes, bytes + size);
+
+    // Respond to all complete retransmit requests at once
+    _response.clear();
+    size_t offset = 0;
+    while ((_request.size() - offset) >= FeedProtocol::REQUEST_SIZE)
+    {
+        FeedRange range = FeedProtocol::ReadRequest(_request.data() + offset);
+        offset += FeedProtocol::REQUEST_SIZE;
+        Respond(range.sequence, range.count);
+    }
+    _request.erase(_request.begin(), _request.begin() + offset);
+
+    if (!_response.empty())
+        SendAsync(_response.data(), _response.size());
+}
+
+void FeedRetransmitSession::Respond(uint64_t sequence, uint64_t count)
+{
+    auto server = std::static_pointer_cast<FeedRetransmitServer>(this->server());
+
+    if ((sequence == 0) || (count == 0))
+        return;
+
+    uint64_t end = sequence + count;
+    if (end < sequence)
+        end = (uint64_t)-1;
+
+    // Copy stored messages of the requested range
+    _messages.clear();
+    size_t copied = _history->Copy(sequence, count, _messages);
+    uint64_t first = (copied > 0) ? _messages.entries.front().sequence : end;
+    uint64_t last = (copied > 0) ? (_messages.entries.back().sequence + 1) : end;
+
+    // Messages before the history are not available any more
+    if (first > sequence)
+        RespondUnavailable(sequence, first - sequence);
+
+    // Append records of stored messages
+    const uint8_t* message = _messages.buffer.data();
+    for (const auto& entry : _messages.entries)
+    {
+        size_t offset = _response.size();
+        _response.resize(offset + FeedProtocol::RECORD_SIZE + entry.size);
+        FeedProtocol::WriteRecord(_response.data() + offset, (uint32_t)entry.size, entry.sequence);
+        std::copy(message, message + entry.size, _response.data() + offset + FeedProtocol::RECORD_SIZE);
+        message += entry.size;
+    }
+
+    // Messages after the history are not published
+    if ((copied > 0) && (last < end))
+        RespondUnavailable(last, end - last);
+
+    // Update statistic
+    ++server->_requests_served;
+    server->_messages_retransmitted += copied;
+}
+
+void FeedRetransmitSession::RespondUnavailable(uint64_t sequence, uint64_t count)
+{
+    auto server = std::static_pointer_cast<FeedRetransmitServer>(this->server());
+
+    while (count > 0)
+    {
+        uint32_t chunk = (uint32_t)std::min(count, (uint64_t)0xFFFFFFFF);
+
+        size_t offset = _response.size();
+        _response.resize(offset + FeedProtocol::UNAVAILABLE_SIZE);
+        FeedProtocol::WriteUnavailable(_response.data() + offset, sequence, chunk);
+
+        server->_messages_unavailable += chunk;
+        sequence += chunk;
+        count -= chunk;
+    }
+}
+
+FeedRetransmitServer::FeedRetransmitServer(std::shared_ptr<Service> service, int port, std::shared_ptr<FeedHistory> history)
+    : TCPServer(service, port),
+      _history(history),
+      _requests_served(0),
+      _messages_retransmitted(0),
+      _messages_unavailable(0)
+{
+    assert((history != nullptr) && "Feed history is invalid!");
+    if (history == nullptr)
+        throw CppCommon::ArgumentException("Feed history is invalid!");
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,337 @@
+/*!
+    \file pacer.cpp
+    \brief Send pacer implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/pacer.h"
+
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <ifaddrs.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#if !defined(SO_TXTIME)
+#define SO_TXTIME 61
+#endif
+#if !defined(SCM_TXTIME)
+#define SCM_TXTIME SO_TXTIME
+#endif
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+// Default Linux timer slack: shorter delays are not precise with timers
+static const uint64_t SHORT_DELAY_THRESHOLD = 50000;
+
+#if defined(__linux__)
+
+// SO_TXTIME socket option value (struct sock_txtime)
+struct TransmitTimeConfig
+{
+    clockid_t clockid;
+    uint32_t flags;
+};
+
+// Message headers reused by all launch time batches of the current thread
+static thread_local std::vector<mmsghdr> txtime_headers;
+static thread_local std::vector<iovec> txtime_vectors;
+static thread_local std::vector<uint8_t> txtime_controls;
+
+// Find the network interface index of the given local address (0 - any network interface)
+static int FindInterface(const asio::ip::address& address)
+{
+    if (address.is_unspecified())
+        return 0;
+
+    int index = -1;
+    ifaddrs* interfaces = nullptr;
+    if (::getifaddrs(&interfaces) != 0)
+        return index;
+
+    for (ifaddrs* it = interfaces; it != nullptr; it = it->ifa_next)
+    {
+        if (it->ifa_addr == nullptr)
+            continue;
+
+        if (address.is_v4() && (it->ifa_addr->sa_family == AF_INET))
+        {
+            const sockaddr_in* inet = (const sockaddr_in*)it->ifa_addr;
+            if (std::memcmp(&inet->sin_addr, address.to_v4().to_bytes().data(), 4) == 0)
+                index = (int)::if_nametoindex(it->ifa_name);
+        }
+        else if (address.is_v6() && (it->ifa_addr->sa_family == AF_INET6))
+        {
+            const sockaddr_in6* inet6 = (const sockaddr_in6*)it->ifa_addr;
+            if (std::memcmp(&inet6->sin6_addr, address.to_v6().to_bytes().data(), 16) == 0)
+                index = (int)::if_nametoindex(it->ifa_name);
+        }
+        if (index > 0)
+            break;
+    }
+
+    ::freeifaddrs(interfaces);
+    return index;
+}
+
+// Check the network interface for the fq queue discipline with the netlink queue disciplines dump
+static bool CheckTransmitTimeQdisc(int index)
+{
+    int handle = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (handle < 0)
+        return false;
+
+    struct
+    {
+        nlmsghdr header;
+        tcmsg message;
+    } request;
+    std::memset(&request, 0, sizeof(request));
+    request.header.nlmsg_len = NLMSG_LENGTH(sizeof(tcmsg));
+    request.header.nlmsg_type = RTM_GETQDISC;
+    request.header.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+    request.message.tcm_family = AF_UNSPEC;
+
+    bool found = false;
+    bool done = (::send(handle, &request, request.header.nlmsg_len, 0) < 0);
+    std::vector<uint8_t> buffer(32768);
+    while (!done)
+    {
+        ssize_t received = ::recv(handle, buffer.data(), buffer.size(), 0);
+        if (received <= 0)
+            break;
+
+        int length = (int)received;
+        for (nlmsghdr* header = (nlmsghdr*)buffer.data(); NLMSG_OK(header, length); header = NLMSG_NEXT(header, length))
+        {
+            if ((header->nlmsg_type == NLMSG_DONE) || (header->nlmsg_type == NLMSG_ERROR))
+            {
+                done = true;
+                break;
+            }
+            if (header->nlmsg_type != RTM_NEWQDISC)
+                continue;
+
+            // Skip queue disciplines of other network interfaces
+            const tcmsg* message = (const tcmsg*)NLMSG_DATA(header);
+            if ((index > 0) && (message->tcm_ifindex != index))
+                continue;
+
+            // Root or child queue discipline of the kind
+            int attributes = (int)(header->nlmsg_len - NLMSG_LENGTH(sizeof(tcmsg)));
+            for (rtattr* attribute = (rtattr*)((uint8_t*)message + NLMSG_ALIGN(sizeof(tcmsg))); RTA_OK(attribute, attributes); attribute = RTA_NEXT(attribute, attributes))
+            {
+                if (attribute->rta_type == TCA_KIND)
+                {
+                    // The etf queue discipline is not accepted: it uses CLOCK_TAI
+                    // and drops datagrams of sockets with another launch time clock
+                    const char* kind = (const char*)RTA_DATA(attribute);
+                    if (std::strcmp(kind, "fq") == 0)
+                        found = true;
+                }
+            }
+        }
+    }
+
+    ::close(handle);
+    return found;
+}
+
+#endif
+
+//! @endcond
+
+Pacer::Pacer() noexcept
+    : _rate(0),
+      _unit(PacingUnit::Bytes),
+      _burst(0),
+      _departure(0),
+      _remainder(0),
+      _tolerance(0),
+      _started(0),
+      _units_paced(0),
+      _messages_paced(0),
+      _bytes_paced(0),
+      _throttles(0)
+{
+}
+
+double Pacer::achieved_rate() const noexcept
+{
+    if (_started == 0)
+        return 0.0;
+
+    uint64_t elapsed = CppCommon::Timestamp::nano() - _started;
+    if (elapsed == 0)
+        return 0.0;
+
+    return (double)_units_paced * 1000000000.0 / (double)elapsed;
+}
+
+void Pacer::Setup(uint64_t rate, PacingUnit unit, uint64_t burst) noexcept
+{
+    _rate = rate;
+    _unit = unit;
+    _burst = burst;
+    Reset();
+}
+
+void Pacer::Reset() noexcept
+{
+    _departure = 0;
+    _remainder = 0;
+    _tolerance = (_rate > 0) ? (_burst * 1000000000 / _rate) : 0;
+    _started = 0;
+    _units_paced = 0;
+    _messages_paced = 0;
+    _bytes_paced = 0;
+    _throttles = 0;
+}
+
+uint64_t Pacer::Delay(uint64_t timestamp, uint64_t horizon) const noexcept
+{
+    if (_rate == 0)
+        return 0;
+
+    uint64_t allowed = timestamp + _tolerance + horizon;
+    return (_departure > allowed) ? (_departure - allowed) : 0;
+}
+
+uint64_t Pacer::Consume(uint64_t timestamp, size_t size) noexcept
+{
+    uint64_t units = (_unit == PacingUnit::Bytes) ? size : 1;
+
+    // Update statistic
+    if (_started == 0)
+        _started = timestamp;
+    _units_paced += units;
+    ++_messages_paced;
+    _bytes_paced += size;
+
+    if (_rate == 0)
+        return timestamp;
+
+    // Departure time of the message is allowed to be ahead by the burst tolerance
+    uint64_t departure = (_departure > (timestamp + _tolerance)) ? (_departure - _tolerance) : timestamp;
+
+    // Move the scheduling clock by the message cost (keep the remainder to avoid rounding drift)
+    uint64_t cost = units * 1000000000 + _remainder;
+    _departure = std::max(_departure, timestamp) + cost / _rate;
+    _remainder = cost % _rate;
+
+    return departure;
+}
+
+bool Pacer::IsShortDelay(uint64_t delay) noexcept
+{
+    return (delay <= SHORT_DELAY_THRESHOLD);
+}
+
+bool Pacer::IsTransmitTimeSupported() noexcept
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool Pacer::EnableTransmitTime(asio::ip::udp::socket& socket, asio::error_code& ec)
+{
+    ec.clear();
+
+#if defined(__linux__)
+    // Launch times are ignored without the fq queue discipline of the egress interface
+    asio::error_code ignored;
+    auto endpoint = socket.local_endpoint(ignored);
+    int index = ignored ? -1 : FindInterface(endpoint.address());
+    if ((index < 0) || !CheckTransmitTimeQdisc(index))
+        return false;
+
+    // Launch times use the monotonic clock of 'CppCommon::Timestamp::nano()' as the fq queue discipline expects
+    TransmitTimeConfig config;
+    config.clockid = CLOCK_MONOTONIC;
+    config.flags = 0;
+
+    if (::setsockopt(socket.native_handle(), SOL_SOCKET, SO_TXTIME, &config, sizeof(config)) != 0)
+    {
+        if ((errno != ENOPROTOOPT) && (errno != EINVAL) && (errno != EOPNOTSUPP))
+            ec = std::error_code(errno, std::system_category());
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t Pacer::Send(asio::ip::udp::socket& socket, const UDPDatagram* datagrams, const uint64_t* launch_times, size_t count, asio::error_code& ec)
+{
+#if defined(__linux__)
+    ec.clear();
+
+    if (count == 0)
+        return 0;
+
+    const size_t control_size = CMSG_SPACE(sizeof(uint64_t));
+    if (txtime_headers.size() < count)
+    {
+        txtime_headers.resize(count);
+        txtime_vectors.resize(count);
+        txtime_controls.resize(count * control_size);
+    }
+    std::memset(txtime_headers.data(), 0, count * sizeof(mmsghdr));
+    std::memset(txtime_controls.data(), 0, count * control_size);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        txtime_vectors[i].iov_base = const_cast<void*>(datagrams[i].buffer);
+        txtime_vectors[i].iov_len = datagrams[i].size;
+
+        msghdr& message = txtime_headers[i].msg_hdr;
+        message.msg_name = const_cast<asio::ip::udp::endpoint::data_type*>(datagrams[i].endpoint.data());
+        message.msg_namelen = (socklen_t)datagrams[i].endpoint.size();
+        message.msg_iov = &txtime_vectors[i];
+        message.msg_iovlen = 1;
+        message.msg_control = txtime_controls.data() + i * control_size;
+        message.msg_controllen = control_size;
+
+        // Attach the launch time control message
+        cmsghdr* header = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = SOL_SOCKET;
+        header->cmsg_type = SCM_TXTIME;
+        header->cmsg_len = CMSG_LEN(sizeof(uint64_t));
+        std::memcpy(CMSG_DATA(header), &launch_times[i], sizeof(uint64_t));
+    }
+
+    int result = ::sendmmsg(socket.native_handle(), txtime_headers.data(), (unsigned)count, MSG_DONTWAIT);
+    if (result < 0)
+    {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            ec = std::error_code(errno, std::system_category());
+        return 0;
+    }
+
+    return (size_t)result;
+#else
+    return UDPBatch::Send(socket, datagrams, count, ec);
+#endif
+}
+
+} // namespace Asio
+} // namespace CppServer
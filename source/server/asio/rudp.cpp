@@ -0,0 +1,447 @@
+/*!
+    \file rudp.cpp
+    \brief Reliable UDP protocol implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/rudp.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+// Packet types
+static const uint8_t RUDP_DATA = 1;
+static const uint8_t RUDP_ACK = 2;
+
+// Initial and maximal retransmission timeouts in nanoseconds
+static const double RUDP_INITIAL_RTO = 200000000.0;
+static const double RUDP_MAX_RTO = 60000000000.0;
+
+static inline void Write16(uint8_t* buffer, uint16_t value)
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+}
+
+static inline void Write32(uint8_t* buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+    buffer[2] = (uint8_t)(value >> 16);
+    buffer[3] = (uint8_t)(value >> 24);
+}
+
+static inline uint16_t Read16(const uint8_t* buffer)
+{
+    return (uint16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+static inline uint32_t Read32(const uint8_t* buffer)
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) | ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+// Sequence numbers difference with wrap around
+static inline int32_t Diff(uint32_t seq1, uint32_t seq2)
+{
+    return (int32_t)(seq1 - seq2);
+}
+
+//! @endcond
+
+void RUDPQueue::push(const void* data, size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    buffer.insert(buffer.end(), bytes, bytes + size);
+    sizes.push_back(size);
+}
+
+RUDPProtocol::RUDPProtocol()
+    : _option_send_window(256),
+      _option_receive_window(256),
+      _option_congestion_control(true),
+      _option_ordered(true),
+      _option_fast_retransmit(3),
+      _option_min_rto(CppCommon::Timespan::milliseconds(20)),
+      _option_max_payload(1400)
+{
+    Reset();
+}
+
+void RUDPProtocol::SetupWindow(size_t send_window, size_t receive_window) noexcept
+{
+    _option_send_window = std::max(send_window, (size_t)1);
+    _option_receive_window = std::min(std::max(receive_window, (size_t)1), (size_t)65535);
+    _remote_window = _option_receive_window;
+}
+
+void RUDPProtocol::Reset()
+{
+    // Reset send state
+    _send_queue.clear();
+    _send_buffer.clear();
+    _send_una = 0;
+    _send_next = 0;
+    _recover = 0;
+    _remote_window = _option_receive_window;
+
+    // Reset receive state
+    _receive_buffer.clear();
+    _receive_next = 0;
+    _ack_required = false;
+
+    // Reset congestion & RTT state
+    _cwnd = 4;
+    _ssthresh = (double)_option_send_window;
+    _srtt = 0;
+    _rttvar = 0;
+    _rto = RUDP_INITIAL_RTO;
+
+    // Reset output & delivered queues
+    _output.clear();
+    _delivered.clear();
+
+    // Reset statistic
+    _messages_sent = 0;
+    _messages_received = 0;
+    _packets_sent = 0;
+    _packets_received = 0;
+    _packets_retransmitted = 0;
+    _packets_fast_retransmitted = 0;
+    _packets_duplicated = 0;
+    _packets_invalid = 0;
+}
+
+bool RUDPProtocol::Send(const void* buffer, size_t size)
+{
+    if (size > option_max_payload())
+        return false;
+
+    // Queue the message until the send window allows to send it
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _send_queue.emplace_back(bytes, bytes + size);
+
+    // Update statistic
+    ++_messages_sent;
+
+    return true;
+}
+
+bool RUDPProtocol::Input(const void* buffer, size_t size, uint64_t timestamp)
+{
+    const uint8_t* bytes = (const uint8_t*)buffer;
+
+    if ((buffer == nullptr) || (size < HEADER_SIZE))
+    {
+        ++_packets_invalid;
+        return false;
+    }
+
+    uint8_t type = bytes[0];
+    size_t window = Read16(bytes + 2);
+    uint32_t seq = Read32(bytes + 4);
+
+    switch (type)
+    {
+        case RUDP_DATA:
+            ++_packets_received;
+            _remote_window = std::max(window, (size_t)1);
+            InputData(seq, bytes + HEADER_SIZE, size - HEADER_SIZE);
+            return true;
+        case RUDP_ACK:
+            if (size < ACK_SIZE)
+                break;
+            ++_packets_received;
+            _remote_window = std::max(window, (size_t)1);
+            InputAck(seq, Read32(bytes + 8), timestamp);
+            return true;
+        default:
+            break;
+    }
+
+    ++_packets_invalid;
+    return false;
+}
+
+void RUDPProtocol::InputData(uint32_t seq, const uint8_t* payload, size_t size)
+{
+    // Acknowledge every received data packet, even duplicated one
+    _ack_required = true;
+
+    int32_t offset = Diff(seq, _receive_next);
+    if (offset < 0)
+    {
+        ++_packets_duplicated;
+        return;
+    }
+    if ((size_t)offset >= option_receive_window())
+    {
+        ++_packets_invalid;
+        return;
+    }
+    if (_receive_buffer.find(seq) != _receive_buffer.end())
+    {
+        ++_packets_duplicated;
+        return;
+    }
+
+    if (option_ordered())
+    {
+        // Buffer the packet until all previous packets are received
+        _receive_buffer.emplace(seq, std::vector<uint8_t>(payload, payload + size));
+    }
+    else
+    {
+        // Deliver the message immediately and keep only the received mark
+        _delivered.push(payload, size);
+        ++_messages_received;
+        _receive_buffer.emplace(seq, std::vector<uint8_t>());
+    }
+
+    // Advance the receive sequence over contiguous packets
+    for (auto it = _receive_buffer.find(_receive_next); it != _receive_buffer.end(); it = _receive_buffer.find(_receive_next))
+    {
+        if (option_ordered())
+        {
+            _delivered.push(it->second.data(), it->second.size());
+            ++_messages_received;
+        }
+        _receive_buffer.erase(it);
+        ++_receive_next;
+    }
+}
+
+void RUDPProtocol::InputAck(uint32_t ack, uint32_t sack, uint64_t timestamp)
+{
+    // Acknowledge cumulatively received segments
+    for (auto& segment : _send_buffer)
+    {
+        if (Diff(segment.seq, ack) >= 0)
+            break;
+        AckSegment(segment, timestamp);
+    }
+
+    // Acknowledge selectively received segments
+    uint32_t highest = ack - 1;
+    for (uint32_t i = 0; i < 32; ++i)
+    {
+        if ((sack & (1u << i)) == 0)
+            continue;
+
+        uint32_t seq = ack + 1 + i;
+        highest = seq;
+        int32_t index = Diff(seq, _send_una);
+        if ((index >= 0) && ((size_t)index < _send_buffer.size()))
+            AckSegment(_send_buffer[index], timestamp);
+    }
+
+    // Fast retransmit segments skipped by later acknowledged ones
+    if (option_fast_retransmit() > 0)
+    {
+        for (auto& segment : _send_buffer)
+        {
+            if (Diff(segment.seq, highest) >= 0)
+                break;
+            if (segment.acked || segment.fast)
+                continue;
+            if (++segment.skipped < option_fast_retransmit())
+                continue;
+
+            segment.fast = true;
+
+            // Reduce the congestion window once per window of data
+            if (option_congestion_control() && (Diff(segment.seq, _recover) >= 0))
+            {
+                _ssthresh = std::max(_cwnd / 2, 2.0);
+                _cwnd = _ssthresh;
+                _recover = _send_next;
+            }
+        }
+    }
+
+    // Remove acknowledged segments from the head of the send buffer
+    while (!_send_buffer.empty() && _send_buffer.front().acked)
+    {
+        _send_buffer.pop_front();
+        ++_send_una;
+    }
+}
+
+void RUDPProtocol::AckSegment(Segment& segment, uint64_t timestamp)
+{
+    if (segment.acked)
+        return;
+
+    segment.acked = true;
+    segment.data.clear();
+
+    // Sample the round-trip time only for segments sent once (Karn's algorithm)
+    if ((segment.transmits == 1) && (timestamp >= segment.timestamp))
+    {
+        double sample = (double)(timestamp - segment.timestamp);
+        if (_srtt == 0)
+        {
+            _srtt = sample;
+            _rttvar = sample / 2;
+        }
+        else
+        {
+            _rttvar = 0.75 * _rttvar + 0.25 * std::fabs(_srtt - sample);
+            _srtt = 0.875 * _srtt + 0.125 * sample;
+        }
+        _rto = std::min(std::max((double)_option_min_rto.total(), _srtt + 4 * _rttvar), RUDP_MAX_RTO);
+    }
+
+    // Grow the congestion window: slow start or congestion avoidance
+    if (option_congestion_control())
+    {
+        if (_cwnd < _ssthresh)
+            _cwnd += 1;
+        else
+            _cwnd += 1 / _cwnd;
+        _cwnd = std::min(_cwnd, (double)option_send_window());
+    }
+}
+
+void RUDPProtocol::Flush(uint64_t timestamp)
+{
+    // Output the acknowledgement
+    if (_ack_required)
+    {
+        OutputAck();
+        _ack_required = false;
+    }
+
+    // Back off the retransmission timeout on expired segments
+    bool expired = false;
+    for (auto& segment : _send_buffer)
+    {
+        if (!segment.acked && !segment.fast && (timestamp >= segment.deadline))
+        {
+            expired = true;
+            break;
+        }
+    }
+    if (expired)
+    {
+        _rto = std::min(_rto * 2, RUDP_MAX_RTO);
+        if (option_congestion_control())
+        {
+            _ssthresh = std::max((double)_send_buffer.size() / 2, 2.0);
+            _cwnd = 1;
+            _recover = _send_next;
+        }
+    }
+
+    // Retransmit fast retransmit and expired segments
+    for (auto& segment : _send_buffer)
+    {
+        if (segment.acked)
+            continue;
+
+        if (segment.fast)
+        {
+            segment.fast = false;
+            segment.skipped = 0;
+            ++_packets_fast_retransmitted;
+        }
+        else if (timestamp < segment.deadline)
+            continue;
+
+        ++_packets_retransmitted;
+        OutputSegment(segment, timestamp);
+    }
+
+    // Send new segments while the window allows
+    size_t window = std::min(option_send_window(), _remote_window);
+    if (option_congestion_control())
+        window = std::min(window, std::max((size_t)_cwnd, (size_t)1));
+    while (!_send_queue.empty() && (_send_buffer.size() < window))
+    {
+        Segment segment;
+        segment.seq = _send_next++;
+        segment.data = std::move(_send_queue.front());
+        segment.timestamp = 0;
+        segment.deadline = 0;
+        segment.transmits = 0;
+        segment.skipped = 0;
+        segment.acked = false;
+        segment.fast = false;
+        _send_queue.pop_front();
+        _send_buffer.emplace_back(std::move(segment));
+        OutputSegment(_send_buffer.back(), timestamp);
+    }
+}
+
+void RUDPProtocol::OutputSegment(Segment& segment, uint64_t timestamp)
+{
+    uint8_t header[HEADER_SIZE];
+    header[0] = RUDP_DATA;
+    header[1] = 0;
+    Write16(header + 2, (uint16_t)ReceiveWindow());
+    Write32(header + 4, segment.seq);
+
+    // Output the data packet
+    _output.buffer.insert(_output.buffer.end(), header, header + HEADER_SIZE);
+    _output.buffer.insert(_output.buffer.end(), segment.data.begin(), segment.data.end());
+    _output.sizes.push_back(HEADER_SIZE + segment.data.size());
+
+    // Update the segment state
+    segment.timestamp = timestamp;
+    segment.deadline = timestamp + (uint64_t)_rto;
+    ++segment.transmits;
+
+    // Update statistic
+    ++_packets_sent;
+}
+
+void RUDPProtocol::OutputAck()
+{
+    // Prepare the selective acknowledgement bitmap
+    uint32_t sack = 0;
+    if (!_receive_buffer.empty())
+        for (uint32_t i = 0; i < 32; ++i)
+            if (_receive_buffer.find(_receive_next + 1 + i) != _receive_buffer.end())
+                sack |= (1u << i);
+
+    uint8_t packet[ACK_SIZE];
+    packet[0] = RUDP_ACK;
+    packet[1] = 0;
+    Write16(packet + 2, (uint16_t)ReceiveWindow());
+    Write32(packet + 4, _receive_next);
+    Write32(packet + 8, sack);
+
+    // Output the acknowledgement packet
+    _output.push(packet, ACK_SIZE);
+
+    // Update statistic
+    ++_packets_sent;
+}
+
+size_t RUDPProtocol::ReceiveWindow() const noexcept
+{
+    size_t buffered = _receive_buffer.size();
+    return (buffered < option_receive_window()) ? (option_receive_window() - buffered) : 0;
+}
+
+void RUDPProtocol::TakeOutput(RUDPQueue& queue)
+{
+    queue.clear();
+    std::swap(queue, _output);
+}
+
+void RUDPProtocol::TakeDelivered(RUDPQueue& queue)
+{
+    queue.clear();
+    std::swap(queue, _delivered);
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,221 @@
+/*!
+    \file rudp_client.cpp
+    \brief Reliable UDP client implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/rudp_client.h"
+
+#include "time/timestamp.h"
+
+namespace CppServer {
+namespace Asio {
+
+RUDPClient::RUDPClient(std::shared_ptr<Service> service, const std::string& address, int port)
+    : UDPClient(service, address, port),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false),
+      _option_flush_interval(CppCommon::Timespan::milliseconds(10))
+{
+}
+
+RUDPClient::RUDPClient(std::shared_ptr<Service> service, const std::string& address, const std::string& scheme)
+    : UDPClient(service, address, scheme),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false),
+      _option_flush_interval(CppCommon::Timespan::milliseconds(10))
+{
+}
+
+RUDPClient::RUDPClient(std::shared_ptr<Service> service, const asio::ip::udp::endpoint& endpoint)
+    : UDPClient(service, endpoint),
+      _delivering(false),
+      _flush_timer(*io_service()),
+      _flushing(false),
+      _option_flush_interval(CppCommon::Timespan::milliseconds(10))
+{
+}
+
+size_t RUDPClient::Send(const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    if (!IsConnected())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    RUDPQueue output;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Queue the message into the protocol
+        if (!_protocol.Send(buffer, size))
+            return 0;
+
+        // Flush the protocol packets allowed by the send window
+        _protocol.Flush(CppCommon::Timestamp::nano());
+        _protocol.TakeOutput(output);
+    }
+
+    // Send protocol packets
+    Output(output);
+
+    // Schedule retransmissions
+    ScheduleFlush();
+
+    return size;
+}
+
+bool RUDPClient::SendAsync(const void* buffer, size_t size)
+{
+    if (size == 0)
+        return IsConnected();
+
+    return (Send(buffer, size) > 0);
+}
+
+void RUDPClient::onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size)
+{
+    // Skip datagrams from other endpoints
+    if (endpoint == this->endpoint())
+    {
+        RUDPQueue output;
+        {
+            std::scoped_lock locker(_protocol_lock);
+
+            // Input the protocol packet and flush ACKs and new packets
+            uint64_t timestamp = CppCommon::Timestamp::nano();
+            _protocol.Input(buffer, size, timestamp);
+            _protocol.Flush(timestamp);
+            _protocol.TakeOutput(output);
+        }
+
+        // Send protocol packets
+        Output(output);
+
+        // Deliver received messages
+        Deliver();
+
+        // Schedule retransmissions
+        ScheduleFlush();
+    }
+
+    // Receive the next protocol packet
+    ReceiveAsync();
+}
+
+void RUDPClient::Flush()
+{
+    if (!IsConnected())
+        return;
+
+    RUDPQueue output;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Flush retransmissions and new packets
+        _protocol.Flush(CppCommon::Timestamp::nano());
+        _protocol.TakeOutput(output);
+    }
+
+    // Send protocol packets
+    Output(output);
+
+    // Schedule retransmissions
+    ScheduleFlush();
+}
+
+void RUDPClient::ScheduleFlush()
+{
+    if (!IsConnected())
+        return;
+
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        if (_flushing || !_protocol.IsPending())
+            return;
+
+        _flushing = true;
+    }
+
+    // Async wait for the next flush with the flush handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const std::error_code& ec)
+    {
+        {
+            std::scoped_lock locker(_protocol_lock);
+            _flushing = false;
+        }
+
+        if (ec || !IsConnected())
+            return;
+
+        // Flush the protocol
+        Flush();
+    };
+    _flush_timer.expires_from_now(std::chrono::nanoseconds(_option_flush_interval.total()));
+    if (service()->IsStrandRequired())
+        _flush_timer.async_wait(bind_executor(strand(), async_wait_handler));
+    else
+        _flush_timer.async_wait(async_wait_handler);
+}
+
+void RUDPClient::Output(const RUDPQueue& output)
+{
+    const uint8_t* packet = output.buffer.data();
+    for (size_t size : output.sizes)
+    {
+        UDPClient::Send(endpoint(), packet, size);
+        packet += size;
+    }
+}
+
+void RUDPClient::Deliver()
+{
+    RUDPQueue delivered;
+    {
+        std::scoped_lock locker(_protocol_lock);
+
+        // Only one thread delivers messages to keep their order
+        if (_delivering)
+            return;
+
+        _protocol.TakeDelivered(delivered);
+        if (delivered.empty())
+            return;
+
+        _delivering = true;
+    }
+
+    for (;;)
+    {
+        // Call the message received handler for each delivered message
+        const uint8_t* message = delivered.buffer.data();
+        for (size_t size : delivered.sizes)
+        {
+            onReceived(message, size);
+            message += size;
+        }
+
+        // Take messages delivered in the meantime by other threads
+        std::scoped_lock locker(_protocol_lock);
+        _protocol.TakeDelivered(delivered);
+        if (delivered.empty())
+        {
+            _delivering = false;
+            return;
+        }
+    }
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -13,6 +13,13 @@
 namespace CppServer {
 namespace Asio {
 
+//! @cond INTERNALS
+
+// Asio IO service of the current working thread
+static thread_local std::shared_ptr<asio::io_service> current_io_service;
+
+//! @endcond
+
 Service::Service(int threads, bool pool)
     : _strand_required(false),
       _polling(false),
@@ -152,10 +159,18 @@ bool Service::Restart()
     return Start(polling);
 }
 
+std::shared_ptr<asio::io_service> Service::GetCurrentAsioService() noexcept
+{
+    return current_io_service;
+}
+
 void Service::ServiceLoop(std::shared_ptr<Service> service, std::shared_ptr<asio::io_service> io_service)
 {
     bool polling = service->IsPolling();
 
+    // Bind the Asio IO service to the current working thread
+    current_io_service = io_service;
+
     // Call the initialize thread handler
     service->onThreadInitialize();
 
@@ -213,6 +228,9 @@ void Service::ServiceLoop(std::shared_ptr<Service> service, std::shared_ptr<asio
     // Call the cleanup thread handler
     service->onThreadCleanup();
 
+    // Unbind the Asio IO service from the current working thread
+    current_io_service.reset();
+
 #if (OPENSSL_VERSION_NUMBER >= 0x10100000L)
     // Delete OpenSSL thread state
     OPENSSL_thread_stop();
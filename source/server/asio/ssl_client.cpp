@@ -7,6 +7,8 @@
 */
 
 #include "server/asio/ssl_client.h"
+#include "server/asio/ssl_ktls.h"
+#include "server/asio/ssl_mbio.h"
 
 #include <mutex>
 #include <vector>
@@ -16,6 +18,13 @@ namespace Asio {
 
 //! @cond INTERNALS
 
+// Buffer pool of memory BIO streams of all clients
+static BufferPool& ClientBufferPool()
+{
+    static BufferPool pool;
+    return pool;
+}
+
 class SSLClient::Impl : public std::enable_shared_from_this<SSLClient::Impl>
 {
 public:
@@ -30,11 +39,15 @@ public:
           _context(context),
           _endpoint(asio::ip::tcp::endpoint(asio::ip::make_address(address), (unsigned short)port)),
           _stream(*_io_service, *_context),
+          _kernel(_stream),
+          _memory(_stream, ClientBufferPool()),
           _resolving(false),
           _connecting(false),
           _connected(false),
           _handshaking(false),
           _handshaked(false),
+          _resumed(false),
+          _early_accepted(false),
           _bytes_pending(0),
           _bytes_sending(0),
           _bytes_sent(0),
@@ -43,7 +56,11 @@ public:
           _sending(false),
           _send_buffer_flush_offset(0),
           _option_keep_alive(false),
-          _option_no_delay(false)
+          _option_no_delay(false),
+          _option_session_resumption(true),
+          _option_kernel_tls(false),
+          _option_early_data(false),
+          _option_memory_bio(false)
     {
         assert((service != nullptr) && "Asio service is invalid!");
         if (service == nullptr)
@@ -65,11 +82,15 @@ public:
           _port(0),
           _context(context),
           _stream(*_io_service, *_context),
+          _kernel(_stream),
+          _memory(_stream, ClientBufferPool()),
           _resolving(false),
           _connecting(false),
           _connected(false),
           _handshaking(false),
           _handshaked(false),
+          _resumed(false),
+          _early_accepted(false),
           _bytes_pending(0),
           _bytes_sending(0),
           _bytes_sent(0),
@@ -78,7 +99,11 @@ public:
           _sending(false),
           _send_buffer_flush_offset(0),
           _option_keep_alive(false),
-          _option_no_delay(false)
+          _option_no_delay(false),
+          _option_session_resumption(true),
+          _option_kernel_tls(false),
+          _option_early_data(false),
+          _option_memory_bio(false)
     {
         assert((service != nullptr) && "Asio service is invalid!");
         if (service == nullptr)
@@ -100,11 +125,15 @@ public:
           _context(context),
           _endpoint(endpoint),
           _stream(*_io_service, *_context),
+          _kernel(_stream),
+          _memory(_stream, ClientBufferPool()),
           _resolving(false),
           _connecting(false),
           _connected(false),
           _handshaking(false),
           _handshaked(false),
+          _resumed(false),
+          _early_accepted(false),
           _bytes_pending(0),
           _bytes_sending(0),
           _bytes_sent(0),
@@ -113,7 +142,11 @@ public:
           _sending(false),
           _send_buffer_flush_offset(0),
           _option_keep_alive(false),
-          _option_no_delay(false)
+          _option_no_delay(false),
+          _option_session_resumption(true),
+          _option_kernel_tls(false),
+          _option_early_data(false),
+          _option_memory_bio(false)
     {
         assert((service != nullptr) && "Asio service is invalid!");
         if (service == nullptr)
@@ -143,9 +176,17 @@ public:
     uint64_t bytes_pending() noexcept { return _bytes_pending + _bytes_sending; }
     uint64_t& bytes_sent() noexcept { return _bytes_sent; }
     uint64_t& bytes_received() noexcept { return _bytes_received; }
+    uint64_t socket_reads() const noexcept { return _memory.socket_reads(); }
+    uint64_t socket_writes() const noexcept { return _memory.socket_writes(); }
 
     bool option_keep_alive() const noexcept { return _option_keep_alive; }
     bool option_no_delay() const noexcept { return _option_no_delay; }
+    bool option_session_resumption() const noexcept { return _option_session_resumption; }
+    bool option_kernel_tls() const noexcept { return _option_kernel_tls; }
+    bool option_early_data() const noexcept { return _option_early_data; }
+    bool option_memory_bio() const noexcept { return _option_memory_bio; }
+
+    std::shared_ptr<SSL_SESSION>& session() noexcept { return _session; }
 
     size_t option_receive_buffer_size() const
     {
@@ -163,6 +204,10 @@ public:
 
     bool IsConnected() const noexcept { return _connected; }
     bool IsHandshaked() const noexcept { return _handshaked; }
+    bool IsResumed() const noexcept { return _resumed; }
+    bool IsEarlyDataAccepted() const noexcept { return _early_accepted; }
+    bool IsSendOffloaded() const noexcept { return _kernel.IsSendOffloaded(); }
+    bool IsReceiveOffloaded() const noexcept { return _kernel.IsReceiveOffloaded(); }
 
     bool Connect(std::shared_ptr<SSLClient> client)
     {
@@ -211,8 +256,24 @@ public:
         // Call the client connected handler
         onConnected();
 
+        // Attach OpenSSL to the socket to offload the encryption to the kernel TLS
+        if (_option_kernel_tls)
+            _kernel.Attach();
+
+        // Offer the last session to resume
+        ResumeSession();
+
+        // Replace Asio BIO pair with the memory BIO over pooled buffers
+        if (_option_memory_bio && !_kernel.IsAttached())
+            _memory.Attach();
+
         // SSL handshake
-        _stream.handshake(asio::ssl::stream_base::client, ec);
+        if (_kernel.IsAttached())
+            _kernel.handshake(asio::ssl::stream_base::client, ec);
+        else if (_memory.IsAttached())
+            _memory.handshake(asio::ssl::stream_base::client, ec);
+        else
+            _stream.handshake(asio::ssl::stream_base::client, ec);
 
         // Disconnect on error
         if (ec)
@@ -226,12 +287,17 @@ public:
         // Update the handshaked flag
         _handshaked = true;
 
+        // Save the handshaked session
+        SaveSession();
+
         // Call the client handshaked handler
         onHandshaked();
 
         // Call the empty send buffer handler
         if (_send_buffer_main.empty())
             onEmpty();
+        else
+            TrySend();
 
         return true;
     }
@@ -297,8 +363,24 @@ public:
         // Call the client connected handler
         onConnected();
 
+        // Attach OpenSSL to the socket to offload the encryption to the kernel TLS
+        if (_option_kernel_tls)
+            _kernel.Attach();
+
+        // Offer the last session to resume
+        ResumeSession();
+
+        // Replace Asio BIO pair with the memory BIO over pooled buffers
+        if (_option_memory_bio && !_kernel.IsAttached())
+            _memory.Attach();
+
         // SSL handshake
-        _stream.handshake(asio::ssl::stream_base::client, ec);
+        if (_kernel.IsAttached())
+            _kernel.handshake(asio::ssl::stream_base::client, ec);
+        else if (_memory.IsAttached())
+            _memory.handshake(asio::ssl::stream_base::client, ec);
+        else
+            _stream.handshake(asio::ssl::stream_base::client, ec);
 
         // Disconnect on error
         if (ec)
@@ -312,12 +394,17 @@ public:
         // Update the handshaked flag
         _handshaked = true;
 
+        // Save the handshaked session
+        SaveSession();
+
         // Call the client handshaked handler
         onHandshaked();
 
         // Call the empty send buffer handler
         if (_send_buffer_main.empty())
             onEmpty();
+        else
+            TrySend();
 
         return true;
     }
@@ -333,6 +420,9 @@ public:
 
         auto self(this->shared_from_this());
 
+        // Save the session with TLS 1.3 tickets received after the handshake
+        SaveSession();
+
         // Close the client socket
         socket().close();
 
@@ -342,6 +432,7 @@ public:
         // Update the handshaked flag
         _handshaking = false;
         _handshaked = false;
+        _resumed = false;
 
         // Update the connected flag
         _resolving = false;
@@ -414,6 +505,20 @@ public:
                     // Call the client connected handler
                     onConnected();
 
+                    // Attach OpenSSL to the socket to offload the encryption to the kernel TLS
+                    if (_option_kernel_tls)
+                        _kernel.Attach();
+
+                    // Offer the last session to resume
+                    ResumeSession();
+
+                    // Take queued data to send it as early data of the resumed session
+                    PrepareEarlyData();
+
+                    // Replace Asio BIO pair with the memory BIO over pooled buffers
+                    if (_option_memory_bio && !_kernel.IsAttached())
+                        _memory.Attach();
+
                     // Async SSL handshake with the handshake handler
                     _handshaking = true;
                     auto async_handshake_handler = make_alloc_handler(_connect_storage, [this, self](std::error_code ec2)
@@ -428,12 +533,20 @@ public:
                             // Update the handshaked flag
                             _handshaked = true;
 
+                            // Confirm early data accepted by the server before any new data is sent
+                            ConfirmEarlyData();
+
+                            // Save the handshaked session
+                            SaveSession();
+
                             // Call the client handshaked handler
                             onHandshaked();
 
                             // Call the empty send buffer handler
                             if (_send_buffer_main.empty())
                                 onEmpty();
+                            else
+                                TrySend();
 
                             // Try to receive something from the server
                             TryReceive();
@@ -445,7 +558,28 @@ public:
                             DisconnectAsync(true);
                         }
                     });
-                    if (_strand_required)
+                    if (!_early_buffer.empty())
+                    {
+                        if (_strand_required)
+                            _kernel.async_handshake(asio::ssl::stream_base::client, _early_buffer, bind_executor(_strand, async_handshake_handler));
+                        else
+                            _kernel.async_handshake(asio::ssl::stream_base::client, _early_buffer, async_handshake_handler);
+                    }
+                    else if (_kernel.IsAttached())
+                    {
+                        if (_strand_required)
+                            _kernel.async_handshake(asio::ssl::stream_base::client, bind_executor(_strand, async_handshake_handler));
+                        else
+                            _kernel.async_handshake(asio::ssl::stream_base::client, async_handshake_handler);
+                    }
+                    else if (_memory.IsAttached())
+                    {
+                        if (_strand_required)
+                            _memory.async_handshake(asio::ssl::stream_base::client, bind_executor(_strand, async_handshake_handler));
+                        else
+                            _memory.async_handshake(asio::ssl::stream_base::client, async_handshake_handler);
+                    }
+                    else if (_strand_required)
                         _stream.async_handshake(asio::ssl::stream_base::client, bind_executor(_strand, async_handshake_handler));
                     else
                         _stream.async_handshake(asio::ssl::stream_base::client, async_handshake_handler);
@@ -535,6 +669,20 @@ public:
                             // Call the client connected handler
                             onConnected();
 
+                            // Attach OpenSSL to the socket to offload the encryption to the kernel TLS
+                            if (_option_kernel_tls)
+                                _kernel.Attach();
+
+                            // Offer the last session to resume
+                            ResumeSession();
+
+                            // Take queued data to send it as early data of the resumed session
+                            PrepareEarlyData();
+
+                            // Replace Asio BIO pair with the memory BIO over pooled buffers
+                            if (_option_memory_bio && !_kernel.IsAttached())
+                                _memory.Attach();
+
                             // Async SSL handshake with the handshake handler
                             _handshaking = true;
                             auto async_handshake_handler = make_alloc_handler(_connect_storage, [this, self](std::error_code ec3)
@@ -549,12 +697,20 @@ public:
                                     // Update the handshaked flag
                                     _handshaked = true;
 
+                                    // Confirm early data accepted by the server before any new data is sent
+                                    ConfirmEarlyData();
+
+                                    // Save the handshaked session
+                                    SaveSession();
+
                                     // Call the client handshaked handler
                                     onHandshaked();
 
                                     // Call the empty send buffer handler
                                     if (_send_buffer_main.empty())
                                         onEmpty();
+                                    else
+                                        TrySend();
 
                                     // Try to receive something from the server
                                     TryReceive();
@@ -566,7 +722,28 @@ public:
                                     DisconnectAsync(true);
                                 }
                             });
-                            if (_strand_required)
+                            if (!_early_buffer.empty())
+                            {
+                                if (_strand_required)
+                                    _kernel.async_handshake(asio::ssl::stream_base::client, _early_buffer, bind_executor(_strand, async_handshake_handler));
+                                else
+                                    _kernel.async_handshake(asio::ssl::stream_base::client, _early_buffer, async_handshake_handler);
+                            }
+                            else if (_kernel.IsAttached())
+                            {
+                                if (_strand_required)
+                                    _kernel.async_handshake(asio::ssl::stream_base::client, bind_executor(_strand, async_handshake_handler));
+                                else
+                                    _kernel.async_handshake(asio::ssl::stream_base::client, async_handshake_handler);
+                            }
+                            else if (_memory.IsAttached())
+                            {
+                                if (_strand_required)
+                                    _memory.async_handshake(asio::ssl::stream_base::client, bind_executor(_strand, async_handshake_handler));
+                                else
+                                    _memory.async_handshake(asio::ssl::stream_base::client, async_handshake_handler);
+                            }
+                            else if (_strand_required)
                                 _stream.async_handshake(asio::ssl::stream_base::client, bind_executor(_strand, async_handshake_handler));
                             else
                                 _stream.async_handshake(asio::ssl::stream_base::client, async_handshake_handler);
@@ -653,7 +830,13 @@ public:
         asio::error_code ec;
 
         // Send data to the server
-        size_t sent = asio::write(_stream, asio::buffer(buffer, size), ec);
+        size_t sent = 0;
+        if (_kernel.IsAttached())
+            sent = _kernel.write(asio::buffer(buffer, size), ec);
+        else if (_memory.IsAttached())
+            sent = _memory.write(asio::buffer(buffer, size), ec);
+        else
+            sent = asio::write(_stream, asio::buffer(buffer, size), ec);
         if (sent > 0)
         {
             // Update statistic
@@ -710,7 +893,12 @@ public:
 
         // Async write some data to the server
         size_t sent = 0;
-        _stream.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
+        if (_kernel.IsAttached())
+            _kernel.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
+        else if (_memory.IsAttached())
+            _memory.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
+        else
+            _stream.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
 
         // Wait for complete or timeout
         std::unique_lock<std::mutex> lck(mtx);
@@ -742,7 +930,8 @@ public:
         if (buffer == nullptr)
             return false;
 
-        if (!IsHandshaked())
+        // Queue data until the handshake to send it as early data
+        if (!IsHandshaked() && !IsEarlyDataQueueing())
             return false;
 
         if (size == 0)
@@ -796,7 +985,13 @@ public:
         asio::error_code ec;
 
         // Receive data from the server
-        size_t received = _stream.read_some(asio::buffer(buffer, size), ec);
+        size_t received = 0;
+        if (_kernel.IsAttached())
+            received = _kernel.read_some(asio::buffer(buffer, size), ec);
+        else if (_memory.IsAttached())
+            received = _memory.read_some(asio::buffer(buffer, size), ec);
+        else
+            received = _stream.read_some(asio::buffer(buffer, size), ec);
         if (received > 0)
         {
             // Update statistic
@@ -860,7 +1055,12 @@ public:
 
         // Async read some data from the server
         size_t received = 0;
-        _stream.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
+        if (_kernel.IsAttached())
+            _kernel.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
+        else if (_memory.IsAttached())
+            _memory.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
+        else
+            _stream.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
 
         // Wait for complete or timeout
         std::unique_lock<std::mutex> lck(mtx);
@@ -901,6 +1101,10 @@ public:
 
     void SetupKeepAlive(bool enable) noexcept { _option_keep_alive = enable; }
     void SetupNoDelay(bool enable) noexcept { _option_no_delay = enable; }
+    void SetupSessionResumption(bool enable) noexcept { _option_session_resumption = enable; if (!enable) _session.reset(); }
+    void SetupKernelTLS(bool enable) noexcept { _option_kernel_tls = enable; }
+    void SetupEarlyData(bool enable) noexcept { _option_early_data = enable; }
+    void SetupMemoryBIO(bool enable) noexcept { _option_memory_bio = enable; }
 
     void SetupReceiveBufferSize(size_t size)
     {
@@ -944,12 +1148,20 @@ private:
     std::shared_ptr<SSLContext> _context;
     asio::ip::tcp::endpoint _endpoint;
     asio::ssl::stream<asio::ip::tcp::socket> _stream;
+    SSLKernelStream _kernel;
+    SSLMemoryStream _memory;
     std::atomic<bool> _resolving;
     std::atomic<bool> _connecting;
     std::atomic<bool> _connected;
     std::atomic<bool> _handshaking;
     std::atomic<bool> _handshaked;
+    std::atomic<bool> _resumed;
+    std::atomic<bool> _early_accepted;
     HandlerStorage _connect_storage;
+    // Last resumable SSL session
+    std::shared_ptr<SSL_SESSION> _session;
+    // TLS 1.3 early data
+    std::vector<uint8_t> _early_buffer;
     // Client statistic
     uint64_t _bytes_pending;
     uint64_t _bytes_sending;
@@ -969,6 +1181,97 @@ private:
     // Options
     bool _option_keep_alive;
     bool _option_no_delay;
+    bool _option_session_resumption;
+    bool _option_kernel_tls;
+    bool _option_early_data;
+    bool _option_memory_bio;
+
+    void ResumeSession()
+    {
+        if (_option_session_resumption && _session)
+            SSL_set_session(_stream.native_handle(), _session.get());
+    }
+
+    void SaveSession()
+    {
+        // Update the resumed flag
+        _resumed = (SSL_session_reused(_stream.native_handle()) == 1);
+
+        if (!_option_session_resumption)
+            return;
+
+        // Keep only sessions the server could resume
+        SSL_SESSION* session = SSL_get_session(_stream.native_handle());
+        if ((session == nullptr) || (SSL_SESSION_is_resumable(session) != 1))
+            return;
+
+        // Keep the copy of the session, because OpenSSL invalidates sessions of connections closed without SSL shutdown
+        _session = std::shared_ptr<SSL_SESSION>(SSL_SESSION_dup(session), SSL_SESSION_free);
+    }
+
+    void PrepareEarlyData()
+    {
+        _early_accepted = false;
+        _early_buffer.clear();
+
+        if (!_option_early_data || !_session)
+            return;
+
+        // Early data size is limited by the server in the resumed session
+        size_t max_early_data = SSL_SESSION_get_max_early_data(_session.get());
+        if (max_early_data == 0)
+            return;
+
+        std::lock_guard<std::mutex> locker(_send_lock);
+
+        // Copy queued data to send it as early data with OpenSSL attached to the socket
+        size_t size = std::min(_send_buffer_main.size(), max_early_data);
+        if ((size > 0) && (_kernel.IsAttached() || _kernel.Attach(false)))
+            _early_buffer.assign(_send_buffer_main.begin(), _send_buffer_main.begin() + size);
+    }
+
+    bool IsEarlyDataQueueing() const noexcept
+    {
+        if (!_option_early_data)
+            return false;
+
+        // Queue data while connecting or handshaking
+        if (_resolving || _connecting || _handshaking)
+            return true;
+
+        // Queue data of the disconnected client to reconnect with the saved session
+        return !IsConnected() && _session;
+    }
+
+    void ConfirmEarlyData()
+    {
+        if (_early_buffer.empty())
+            return;
+
+        size_t size = _early_buffer.size();
+        _early_buffer.clear();
+
+        // Early data rejected by the server will be sent again with the main send buffer
+        _early_accepted = (SSL_get_early_data_status(_stream.native_handle()) == SSL_EARLY_DATA_ACCEPTED);
+        if (!_early_accepted)
+            return;
+
+        {
+            std::lock_guard<std::mutex> locker(_send_lock);
+
+            // Remove accepted early data from the main send buffer
+            _send_buffer_main.erase(_send_buffer_main.begin(), _send_buffer_main.begin() + std::min(size, _send_buffer_main.size()));
+
+            // Update statistic
+            _bytes_pending = _send_buffer_main.size();
+        }
+
+        // Update statistic
+        _bytes_sent += size;
+
+        // Call the buffer sent handler
+        onSent(size, bytes_pending());
+    }
 
     void TryReceive()
     {
@@ -1011,7 +1314,21 @@ private:
                 DisconnectAsync(true);
             }
         });
-        if (_strand_required)
+        if (_kernel.IsAttached())
+        {
+            if (_strand_required)
+                _kernel.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), bind_executor(_strand, async_receive_handler));
+            else
+                _kernel.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), async_receive_handler);
+        }
+        else if (_memory.IsAttached())
+        {
+            if (_strand_required)
+                _memory.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), bind_executor(_strand, async_receive_handler));
+            else
+                _memory.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), async_receive_handler);
+        }
+        else if (_strand_required)
             _stream.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), bind_executor(_strand, async_receive_handler));
         else
             _stream.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), async_receive_handler);
@@ -1038,8 +1355,6 @@ private:
             _bytes_pending = 0;
             _bytes_sending += _send_buffer_flush.size();
         }
-        else
-            return;
 
         // Check if the flush buffer is empty
         if (_send_buffer_flush.empty())
@@ -1090,7 +1405,21 @@ private:
                 DisconnectAsync(true);
             }
         });
-        if (_strand_required)
+        if (_kernel.IsAttached())
+        {
+            if (_strand_required)
+                _kernel.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), bind_executor(_strand, async_write_handler));
+            else
+                _kernel.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), async_write_handler);
+        }
+        else if (_memory.IsAttached())
+        {
+            if (_strand_required)
+                _memory.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), bind_executor(_strand, async_write_handler));
+            else
+                _memory.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), async_write_handler);
+        }
+        else if (_strand_required)
             _stream.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), bind_executor(_strand, async_write_handler));
         else
             _stream.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), async_write_handler);
@@ -1239,6 +1568,16 @@ uint64_t SSLClient::bytes_received() const noexcept
     return _pimpl->bytes_received();
 }
 
+uint64_t SSLClient::socket_reads() const noexcept
+{
+    return _pimpl->socket_reads();
+}
+
+uint64_t SSLClient::socket_writes() const noexcept
+{
+    return _pimpl->socket_writes();
+}
+
 bool SSLClient::option_keep_alive() const noexcept
 {
     return _pimpl->option_keep_alive();
@@ -1249,6 +1588,26 @@ bool SSLClient::option_no_delay() const noexcept
     return _pimpl->option_no_delay();
 }
 
+bool SSLClient::option_session_resumption() const noexcept
+{
+    return _pimpl->option_session_resumption();
+}
+
+bool SSLClient::option_kernel_tls() const noexcept
+{
+    return _pimpl->option_kernel_tls();
+}
+
+bool SSLClient::option_early_data() const noexcept
+{
+    return _pimpl->option_early_data();
+}
+
+bool SSLClient::option_memory_bio() const noexcept
+{
+    return _pimpl->option_memory_bio();
+}
+
 size_t SSLClient::option_receive_buffer_size() const
 {
     return _pimpl->option_receive_buffer_size();
@@ -1269,6 +1628,26 @@ bool SSLClient::IsHandshaked() const noexcept
     return _pimpl->IsHandshaked();
 }
 
+bool SSLClient::IsResumed() const noexcept
+{
+    return _pimpl->IsResumed();
+}
+
+bool SSLClient::IsEarlyDataAccepted() const noexcept
+{
+    return _pimpl->IsEarlyDataAccepted();
+}
+
+bool SSLClient::IsSendOffloaded() const noexcept
+{
+    return _pimpl->IsSendOffloaded();
+}
+
+bool SSLClient::IsReceiveOffloaded() const noexcept
+{
+    return _pimpl->IsReceiveOffloaded();
+}
+
 bool SSLClient::Connect()
 {
     auto self(this->shared_from_this());
@@ -1372,6 +1751,26 @@ void SSLClient::SetupNoDelay(bool enable) noexcept
     return _pimpl->SetupNoDelay(enable);
 }
 
+void SSLClient::SetupSessionResumption(bool enable) noexcept
+{
+    return _pimpl->SetupSessionResumption(enable);
+}
+
+void SSLClient::SetupKernelTLS(bool enable) noexcept
+{
+    return _pimpl->SetupKernelTLS(enable);
+}
+
+void SSLClient::SetupEarlyData(bool enable) noexcept
+{
+    return _pimpl->SetupEarlyData(enable);
+}
+
+void SSLClient::SetupMemoryBIO(bool enable) noexcept
+{
+    return _pimpl->SetupMemoryBIO(enable);
+}
+
 void SSLClient::SetupReceiveBufferSize(size_t size)
 {
     return _pimpl->SetupReceiveBufferSize(size);
@@ -1388,11 +1787,21 @@ void SSLClient::onReset()
     size_t bytes_received = _pimpl->bytes_received();
     bool option_keep_alive = _pimpl->option_keep_alive();
     bool option_no_delay = _pimpl->option_no_delay();
+    bool option_session_resumption = _pimpl->option_session_resumption();
+    bool option_kernel_tls = _pimpl->option_kernel_tls();
+    bool option_early_data = _pimpl->option_early_data();
+    bool option_memory_bio = _pimpl->option_memory_bio();
+    std::shared_ptr<SSL_SESSION> session = _pimpl->session();
     _pimpl = std::make_shared<Impl>(_pimpl->id(), _pimpl->service(), _pimpl->context(), _pimpl->endpoint());
     _pimpl->bytes_sent() = bytes_sent;
     _pimpl->bytes_received() = bytes_received;
     _pimpl->SetupKeepAlive(option_keep_alive);
     _pimpl->SetupNoDelay(option_no_delay);
+    _pimpl->SetupSessionResumption(option_session_resumption);
+    _pimpl->SetupKernelTLS(option_kernel_tls);
+    _pimpl->SetupEarlyData(option_early_data);
+    _pimpl->SetupMemoryBIO(option_memory_bio);
+    _pimpl->session() = session;
 }
 
 } // namespace Asio
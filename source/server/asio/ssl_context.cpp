@@ -8,6 +8,20 @@
 
 #include "server/asio/ssl_context.h"
 
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+
+#include <openssl/rand.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#else
+#include <openssl/hmac.h>
+#endif
+
 #if defined(_WIN32) || defined(_WIN64)
 #include <wincrypt.h>
 #endif
@@ -15,6 +29,172 @@
 namespace CppServer {
 namespace Asio {
 
+//! @cond INTERNALS
+
+// SSL context extra data index of session ticket keys
+static int TicketKeysIndex()
+{
+    static int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return index;
+}
+
+//! @endcond
+
+struct SSLContext::TicketKeys
+{
+    std::shared_mutex lock;
+    std::vector<SSLTicketKey> keys;
+};
+
+template <typename TMacContext>
+int SSLContext::TicketKeyCallback(SSL* ssl, unsigned char* name, unsigned char* iv, EVP_CIPHER_CTX* cipher, TMacContext* mac, int enc)
+{
+    auto ticket_keys = (TicketKeys*)SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), TicketKeysIndex());
+    if (ticket_keys == nullptr)
+        return -1;
+
+    std::shared_lock<std::shared_mutex> locker(ticket_keys->lock);
+
+    const auto& keys = ticket_keys->keys;
+    if (keys.empty())
+        return -1;
+
+    // Find the key to encrypt (the first one) or to decrypt the ticket
+    size_t index = 0;
+    if (enc != 1)
+    {
+        while ((index < keys.size()) && (std::memcmp(keys[index].name, name, sizeof(keys[index].name)) != 0))
+            ++index;
+
+        // Unknown key: perform the full handshake and issue a new ticket
+        if (index == keys.size())
+            return 0;
+    }
+    const SSLTicketKey& key = keys[index];
+
+    // Initialize the HMAC-SHA256 context
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    OSSL_PARAM params[] =
+    {
+        OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, (void*)key.hmac_key, sizeof(key.hmac_key)),
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, (char*)"SHA256", 0),
+        OSSL_PARAM_construct_end()
+    };
+    if (EVP_MAC_CTX_set_params(mac, params) != 1)
+        return -1;
+#else
+    if (HMAC_Init_ex(mac, key.hmac_key, sizeof(key.hmac_key), EVP_sha256(), nullptr) != 1)
+        return -1;
+#endif
+
+    if (enc == 1)
+    {
+        // Encrypt the new ticket with the random IV
+        std::memcpy(name, key.name, sizeof(key.name));
+        if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1)
+            return -1;
+        if (EVP_EncryptInit_ex(cipher, EVP_aes_256_cbc(), nullptr, key.aes_key, iv) != 1)
+            return -1;
+        return 1;
+    }
+    else
+    {
+        // Decrypt the ticket and renew it when it was encrypted with the previous key
+        if (EVP_DecryptInit_ex(cipher, EVP_aes_256_cbc(), nullptr, key.aes_key, iv) != 1)
+            return -1;
+        return (index == 0) ? 1 : 2;
+    }
+}
+
+SSLTicketKey SSLTicketKey::Generate()
+{
+    SSLTicketKey key;
+    if (RAND_bytes((unsigned char*)&key, sizeof(key)) != 1)
+        throw CppCommon::SystemException("Failed to generate SSL session ticket key!");
+    return key;
+}
+
+void SSLContext::set_session_cache(size_t size, const CppCommon::Timespan& timeout, const std::string& id_context)
+{
+    if (size == 0)
+    {
+        SSL_CTX_set_session_cache_mode(native_handle(), SSL_SESS_CACHE_OFF);
+        return;
+    }
+
+    SSL_CTX_set_session_cache_mode(native_handle(), SSL_SESS_CACHE_SERVER);
+    SSL_CTX_sess_set_cache_size(native_handle(), (long)size);
+    SSL_CTX_set_timeout(native_handle(), (long)timeout.seconds());
+    SSL_CTX_set_session_id_context(native_handle(), (const unsigned char*)id_context.data(), (unsigned)std::min(id_context.size(), (size_t)SSL_MAX_SID_CTX_LENGTH));
+}
+
+void SSLContext::set_session_tickets(bool enable)
+{
+    if (enable)
+        SSL_CTX_clear_options(native_handle(), SSL_OP_NO_TICKET);
+    else
+        SSL_CTX_set_options(native_handle(), SSL_OP_NO_TICKET);
+}
+
+void SSLContext::set_ticket_keys(const std::vector<SSLTicketKey>& keys)
+{
+    InstallTicketKeys(!keys.empty());
+
+    std::unique_lock<std::shared_mutex> locker(_ticket_keys->lock);
+    _ticket_keys->keys = keys;
+}
+
+void SSLContext::rotate_ticket_key(const SSLTicketKey& key, size_t keep)
+{
+    InstallTicketKeys(true);
+
+    std::unique_lock<std::shared_mutex> locker(_ticket_keys->lock);
+    _ticket_keys->keys.insert(_ticket_keys->keys.begin(), key);
+    if (_ticket_keys->keys.size() > (keep + 1))
+        _ticket_keys->keys.resize(keep + 1);
+}
+
+bool SSLContext::load_ticket_keys(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (content.empty() || ((content.size() % sizeof(SSLTicketKey)) != 0))
+        return false;
+
+    std::vector<SSLTicketKey> keys(content.size() / sizeof(SSLTicketKey));
+    std::memcpy(keys.data(), content.data(), content.size());
+    set_ticket_keys(keys);
+    return true;
+}
+
+std::vector<SSLTicketKey> SSLContext::ticket_keys() const
+{
+    if (!_ticket_keys)
+        return std::vector<SSLTicketKey>();
+
+    std::shared_lock<std::shared_mutex> locker(_ticket_keys->lock);
+    return _ticket_keys->keys;
+}
+
+void SSLContext::InstallTicketKeys(bool install)
+{
+    if (!_ticket_keys)
+    {
+        _ticket_keys = std::make_shared<TicketKeys>();
+        SSL_CTX_set_ex_data(native_handle(), TicketKeysIndex(), _ticket_keys.get());
+    }
+
+    // Without keys tickets are encrypted with random keys of the current process
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    SSL_CTX_set_tlsext_ticket_key_evp_cb(native_handle(), install ? TicketKeyCallback<EVP_MAC_CTX> : nullptr);
+#else
+    SSL_CTX_set_tlsext_ticket_key_cb(native_handle(), install ? TicketKeyCallback<HMAC_CTX> : nullptr);
+#endif
+}
+
 void SSLContext::set_root_certs()
 {
 #if defined(_WIN32) || defined(_WIN64)
@@ -0,0 +1,337 @@
+/*!
+    \file ssl_ktls.cpp
+    \brief SSL kernel TLS stream implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/ssl_ktls.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#if !defined(SOL_TCP)
+#define SOL_TCP 6
+#endif
+#if !defined(TCP_ULP)
+#define TCP_ULP 31
+#endif
+#endif
+
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+#define CPPSERVER_KTLS 1
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+#if defined(CPPSERVER_KTLS)
+// Writes of the kernel TLS (records with TLS control messages and sendfile)
+// are performed by OpenSSL and the OS kernel without MSG_NOSIGNAL. SIGPIPE
+// of the write into the socket closed by the peer is blocked in the calling
+// thread and consumed, so the process signal handling is never changed.
+class BrokenPipeGuard
+{
+public:
+    BrokenPipeGuard()
+    {
+        sigemptyset(&_signals);
+        sigaddset(&_signals, SIGPIPE);
+
+        // SIGPIPE already pending before the write belongs to somebody else
+        sigset_t pending;
+        sigemptyset(&pending);
+        _pending = (sigpending(&pending) == 0) && (sigismember(&pending, SIGPIPE) == 1);
+        _blocked = (pthread_sigmask(SIG_BLOCK, &_signals, &_mask) == 0);
+    }
+    BrokenPipeGuard(const BrokenPipeGuard&) = delete;
+    BrokenPipeGuard& operator=(const BrokenPipeGuard&) = delete;
+    ~BrokenPipeGuard()
+    {
+        if (!_blocked)
+            return;
+
+        // Keep errno of the write for OpenSSL
+        int error = errno;
+
+        // Consume SIGPIPE raised by the write
+        if (!_pending)
+        {
+            struct timespec timeout = { 0, 0 };
+            while (sigtimedwait(&_signals, nullptr, &timeout) > 0) {}
+        }
+
+        pthread_sigmask(SIG_SETMASK, &_mask, nullptr);
+        errno = error;
+    }
+
+private:
+    sigset_t _signals;
+    sigset_t _mask;
+    bool _pending;
+    bool _blocked;
+};
+#endif
+
+#if defined(__linux__)
+// Socket BIO write with MSG_NOSIGNAL, so writes into the socket closed
+// by the peer fail with EPIPE instead of killing the process with SIGPIPE
+static int WriteNoSignal(BIO* bio, const char* data, int size)
+{
+#if defined(CPPSERVER_KTLS)
+    // The kernel TLS needs the socket BIO write to send TLS control messages
+    if (BIO_get_ktls_send(bio))
+    {
+        BrokenPipeGuard guard;
+        return BIO_meth_get_write(BIO_s_socket())(bio, data, size);
+    }
+#endif
+
+    int fd = -1;
+    BIO_get_fd(bio, &fd);
+
+    errno = 0;
+    int result = (int)::send(fd, data, (size_t)size, MSG_NOSIGNAL);
+    BIO_clear_retry_flags(bio);
+    if ((result <= 0) && BIO_sock_should_retry(result))
+        BIO_set_retry_write(bio);
+    return result;
+}
+
+// Socket BIO method with the write without SIGPIPE
+static BIO_METHOD* SocketMethod()
+{
+    static BIO_METHOD* method = []()
+    {
+        const BIO_METHOD* socket = BIO_s_socket();
+        BIO_METHOD* result = BIO_meth_new(BIO_TYPE_SOCKET, "socket without SIGPIPE");
+        if (result == nullptr)
+            return result;
+        BIO_meth_set_write(result, WriteNoSignal);
+        BIO_meth_set_read(result, BIO_meth_get_read(socket));
+        BIO_meth_set_puts(result, BIO_meth_get_puts(socket));
+        BIO_meth_set_ctrl(result, BIO_meth_get_ctrl(socket));
+        BIO_meth_set_create(result, BIO_meth_get_create(socket));
+        BIO_meth_set_destroy(result, BIO_meth_get_destroy(socket));
+        return result;
+    }();
+    return method;
+}
+#endif
+
+//! @endcond
+
+SSLKernelStream::SSLKernelStream(asio::ssl::stream<asio::ip::tcp::socket>& stream)
+    : _stream(stream),
+      _attached(false)
+{
+}
+
+bool SSLKernelStream::IsSupported() noexcept
+{
+#if defined(CPPSERVER_KTLS)
+    // The TLS upper layer protocol cannot be attached to the unconnected socket,
+    // so ENOTCONN means the kernel supports TLS and ENOENT means it does not.
+    // The kernel is probed once on the first call.
+    static const bool supported = []()
+    {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0)
+            return false;
+        bool result = (::setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) == 0) || (errno == ENOTCONN);
+        ::close(fd);
+        return result;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+bool SSLKernelStream::IsSendOffloaded() const noexcept
+{
+#if defined(CPPSERVER_KTLS)
+    return _attached && BIO_get_ktls_send(SSL_get_wbio(_stream.native_handle()));
+#else
+    return false;
+#endif
+}
+
+bool SSLKernelStream::IsReceiveOffloaded() const noexcept
+{
+#if defined(CPPSERVER_KTLS)
+    return _attached && BIO_get_ktls_recv(SSL_get_rbio(_stream.native_handle()));
+#else
+    return false;
+#endif
+}
+
+bool SSLKernelStream::Attach(bool offload)
+{
+    if (_attached)
+        return true;
+
+    if (offload && !IsSupported())
+        return false;
+
+#if defined(__linux__)
+    // All SSL operations are performed on the non-blocking socket
+    asio::error_code ec;
+    _stream.lowest_layer().non_blocking(true, ec);
+    if (ec)
+        return false;
+
+    // Replace Asio memory BIOs with the socket BIO
+    int fd = (int)_stream.lowest_layer().native_handle();
+    BIO_METHOD* method = SocketMethod();
+    BIO* bio = (method != nullptr) ? BIO_new(method) : nullptr;
+    if (bio == nullptr)
+        return false;
+    BIO_set_fd(bio, fd, BIO_NOCLOSE);
+    SSL* ssl = _stream.native_handle();
+    SSL_set_bio(ssl, bio, bio);
+
+#if defined(SSL_OP_IGNORE_UNEXPECTED_EOF)
+    // Asio SSL stream never passes EOF of the socket to OpenSSL. Do the same
+    // for the connection closed without SSL shutdown, because OpenSSL sends
+    // the fatal alert and removes the session from the server session cache.
+    SSL_set_options(ssl, SSL_OP_IGNORE_UNEXPECTED_EOF);
+#endif
+
+#if defined(CPPSERVER_KTLS)
+    // Install TX/RX keys into the socket after the handshake. The TLS upper
+    // layer protocol is attached here as SSL_set_fd() does for its socket BIO.
+    if (offload)
+    {
+        ::setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls"));
+        SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+    }
+#endif
+
+    _attached = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SSLKernelStream::handshake(asio::ssl::stream_base::handshake_type type, asio::error_code& ec)
+{
+    Run([type](SSL* ssl, size_t& size) { return (type == asio::ssl::stream_base::client) ? SSL_connect(ssl) : SSL_accept(ssl); }, ec);
+}
+
+size_t SSLKernelStream::read_some(const asio::mutable_buffer& buffer, asio::error_code& ec)
+{
+    return Run([buffer](SSL* ssl, size_t& size) { return SSL_read_ex(ssl, buffer.data(), buffer.size(), &size); }, ec);
+}
+
+size_t SSLKernelStream::write(const asio::const_buffer& buffer, asio::error_code& ec)
+{
+    const uint8_t* data = (const uint8_t*)buffer.data();
+
+    size_t written = 0;
+    while (written < buffer.size())
+    {
+        size_t size = Run([data, written, &buffer](SSL* ssl, size_t& size) { return SSL_write_ex(ssl, data + written, buffer.size() - written, &size); }, ec);
+        written += size;
+        if (ec)
+            break;
+    }
+
+    return written;
+}
+
+size_t SSLKernelStream::sendfile(int fd, int64_t offset, size_t size, asio::error_code& ec)
+{
+    ec.clear();
+
+    if (!IsSendOffloaded())
+    {
+        ec = asio::error::operation_not_supported;
+        return 0;
+    }
+
+#if defined(CPPSERVER_KTLS)
+    size_t sent = 0;
+    while (sent < size)
+    {
+        auto operation = [fd, offset, size, sent](SSL* ssl, size_t& result)
+        {
+            BrokenPipeGuard guard;
+            ossl_ssize_t written = SSL_sendfile(ssl, fd, (off_t)(offset + sent), size - sent, 0);
+            if (written <= 0)
+                return (int)written;
+            result = (size_t)written;
+            return 1;
+        };
+        sent += Run(operation, ec);
+        if (ec)
+            break;
+    }
+    return sent;
+#else
+    return 0;
+#endif
+}
+
+void SSLKernelStream::Wait(bool read, asio::error_code& ec)
+{
+    ec.clear();
+
+#if defined(__linux__)
+    // Asio synchronous wait fails with 'would_block' on the non-blocking socket
+    pollfd fds;
+    fds.fd = (int)_stream.lowest_layer().native_handle();
+    fds.events = read ? POLLIN : POLLOUT;
+    fds.revents = 0;
+    while (::poll(&fds, 1, -1) < 0)
+    {
+        if (errno != EINTR)
+        {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+            return;
+        }
+    }
+#else
+    ec = asio::error::operation_not_supported;
+#endif
+}
+
+asio::error_code SSLKernelStream::MakeError(SSL* ssl, int result, int error)
+{
+    // Clean SSL shutdown of the peer
+    if (error == SSL_ERROR_ZERO_RETURN)
+        return asio::error::eof;
+
+    unsigned long code = ERR_get_error();
+    ERR_clear_error();
+
+    if (code == 0)
+    {
+        // Socket error or the connection closed without SSL shutdown
+        if ((error == SSL_ERROR_SYSCALL) && (errno != 0))
+            return asio::error_code(errno, asio::error::get_system_category());
+        return asio::ssl::error::stream_truncated;
+    }
+
+#if defined(SSL_R_UNEXPECTED_EOF_WHILE_READING)
+    if (ERR_GET_REASON(code) == SSL_R_UNEXPECTED_EOF_WHILE_READING)
+        return asio::ssl::error::stream_truncated;
+#endif
+
+    return asio::error_code((int)code, asio::error::get_ssl_category());
+}
+
+} // namespace Asio
+} // namespace CppServer
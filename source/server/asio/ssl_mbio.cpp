@@ -0,0 +1,318 @@
+/*!
+    \file ssl_mbio.cpp
+    \brief SSL memory BIO stream implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/ssl_mbio.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppServer {
+namespace Asio {
+
+SSLMemoryStream::SSLMemoryStream(asio::ssl::stream<asio::ip::tcp::socket>& stream, BufferPool& pool)
+    : _stream(stream),
+      _pool(pool),
+      _attached(false),
+      _bio(nullptr),
+      _socket_reads(0),
+      _socket_writes(0),
+      _input_size(0),
+      _input_offset(0),
+      _filling(false),
+      _flushing_active(false)
+{
+}
+
+SSLMemoryStream::~SSLMemoryStream()
+{
+    // The memory BIO is owned by the SSL stream and could outlive this stream
+    if (_bio != nullptr)
+        BIO_set_data(_bio, nullptr);
+
+    _pool.Release(_input);
+    for (auto& chunk : _output)
+        _pool.Release(chunk);
+    for (auto& chunk : _flushing)
+        _pool.Release(chunk);
+}
+
+bool SSLMemoryStream::Attach()
+{
+    if (_attached)
+        return true;
+
+    BIO_METHOD* method = Method();
+    if (method == nullptr)
+        return false;
+
+    BIO* bio = BIO_new(method);
+    if (bio == nullptr)
+        return false;
+
+    BIO_set_data(bio, this);
+    BIO_set_init(bio, 1);
+
+    // Replace Asio BIO pair with the memory BIO, the SSL stream takes its ownership
+    SSL* ssl = _stream.native_handle();
+    SSL_set_bio(ssl, bio, bio);
+
+    // Read all available TLS records from the input buffer at once
+    SSL_set_read_ahead(ssl, 1);
+
+#if defined(SSL_OP_IGNORE_UNEXPECTED_EOF)
+    // EOF of the socket is never passed to OpenSSL, so the session
+    // should not be removed from the server session cache
+    SSL_set_options(ssl, SSL_OP_IGNORE_UNEXPECTED_EOF);
+#endif
+
+    _bio = bio;
+    _attached = true;
+    return true;
+}
+
+bool SSLMemoryStream::Release()
+{
+    if (_filling || (_input_offset < _input_size))
+        return false;
+
+    _pool.Release(_input);
+    _input_size = 0;
+    _input_offset = 0;
+    return true;
+}
+
+void SSLMemoryStream::handshake(asio::ssl::stream_base::handshake_type type, asio::error_code& ec)
+{
+    Run([type](SSL* ssl, size_t& size) { return (type == asio::ssl::stream_base::client) ? SSL_connect(ssl) : SSL_accept(ssl); }, ec);
+}
+
+size_t SSLMemoryStream::read_some(const asio::mutable_buffer& buffer, asio::error_code& ec)
+{
+    auto operation = [buffer](SSL* ssl, size_t& size)
+    {
+        while (size < buffer.size())
+        {
+            size_t read = 0;
+            if (SSL_read_ex(ssl, (uint8_t*)buffer.data() + size, buffer.size() - size, &read) != 1)
+                return (size > 0) ? 1 : 0;
+            size += read;
+        }
+        return 1;
+    };
+    return Run(operation, ec);
+}
+
+size_t SSLMemoryStream::write(const asio::const_buffer& buffer, asio::error_code& ec)
+{
+    const uint8_t* data = (const uint8_t*)buffer.data();
+
+    size_t written = 0;
+    while (written < buffer.size())
+    {
+        size_t limit = std::min(buffer.size() - written, WRITE_LIMIT);
+        auto operation = [data, written, limit](SSL* ssl, size_t& size)
+        {
+            while (size < limit)
+            {
+                size_t result = 0;
+                if (SSL_write_ex(ssl, data + written + size, limit - size, &result) != 1)
+                    return (size > 0) ? 1 : 0;
+                size += result;
+            }
+            return 1;
+        };
+        written += Run(operation, ec);
+        if (ec)
+            break;
+    }
+
+    return written;
+}
+
+void SSLMemoryStream::Fill(asio::error_code& ec)
+{
+    PrepareFill();
+
+    size_t size = _stream.next_layer().read_some(asio::buffer(_input.data() + _input_size, _input.size() - _input_size), ec);
+    ++_socket_reads;
+    _input_size += size;
+    if (ec)
+        ec = MapError(ec);
+}
+
+void SSLMemoryStream::Flush(asio::error_code& ec)
+{
+    PrepareFlush();
+
+    // Write all output chunks with gather writes
+    for (;;)
+    {
+        size_t size = _stream.next_layer().write_some(_flushing_buffers, ec);
+        ++_socket_writes;
+        if (ec || ConsumeFlush(size))
+            break;
+    }
+
+    ReleaseFlush();
+}
+
+void SSLMemoryStream::PrepareFill()
+{
+    // Acquire the input buffer from the buffer pool
+    if (_input.empty())
+    {
+        _pool.Acquire(_input, INPUT_SIZE);
+        _input.resize(INPUT_SIZE);
+    }
+
+    // Move unprocessed input to the beginning of the input buffer
+    if (_input_offset > 0)
+    {
+        std::memmove(_input.data(), _input.data() + _input_offset, _input_size - _input_offset);
+        _input_size -= _input_offset;
+        _input_offset = 0;
+    }
+}
+
+void SSLMemoryStream::PrepareFlush()
+{
+    _flushing.swap(_output);
+    _flushing_buffers.clear();
+    for (auto& chunk : _flushing)
+        _flushing_buffers.emplace_back(asio::buffer(chunk.data(), chunk.size()));
+}
+
+bool SSLMemoryStream::ConsumeFlush(size_t size)
+{
+    size_t index = 0;
+    while ((index < _flushing_buffers.size()) && (size >= _flushing_buffers[index].size()))
+        size -= _flushing_buffers[index++].size();
+    if ((index < _flushing_buffers.size()) && (size > 0))
+        _flushing_buffers[index] += size;
+    _flushing_buffers.erase(_flushing_buffers.begin(), _flushing_buffers.begin() + index);
+    return _flushing_buffers.empty();
+}
+
+void SSLMemoryStream::ReleaseFlush()
+{
+    for (auto& chunk : _flushing)
+        _pool.Release(chunk);
+    _flushing.clear();
+    _flushing_buffers.clear();
+}
+
+void SSLMemoryStream::Append(const uint8_t* data, size_t size)
+{
+    while (size > 0)
+    {
+        // Acquire the next output chunk from the buffer pool
+        if (_output.empty() || (_output.back().size() == _output.back().capacity()))
+        {
+            _output.emplace_back();
+            _pool.Acquire(_output.back(), OUTPUT_SIZE);
+        }
+
+        std::vector<uint8_t>& chunk = _output.back();
+        size_t append = std::min(size, chunk.capacity() - chunk.size());
+        chunk.insert(chunk.end(), data, data + append);
+        data += append;
+        size -= append;
+    }
+}
+
+asio::error_code SSLMemoryStream::MapError(const asio::error_code& ec) const
+{
+    // Asio SSL stream reports EOF of the socket only after the close notify alert of the peer
+    if ((ec == asio::error::eof) && ((SSL_get_shutdown(_stream.native_handle()) & SSL_RECEIVED_SHUTDOWN) == 0))
+        return asio::ssl::error::stream_truncated;
+    return ec;
+}
+
+asio::error_code SSLMemoryStream::MakeError(SSL* ssl, int result, int error)
+{
+    // Clean SSL shutdown of the peer
+    if (error == SSL_ERROR_ZERO_RETURN)
+        return asio::error::eof;
+
+    unsigned long code = ERR_get_error();
+    ERR_clear_error();
+
+    // The memory BIO never fails, so the error without the code is the truncated stream
+    if (code == 0)
+        return asio::ssl::error::stream_truncated;
+
+    return asio::error_code((int)code, asio::error::get_ssl_category());
+}
+
+BIO_METHOD* SSLMemoryStream::Method()
+{
+    static BIO_METHOD* method = []()
+    {
+        BIO_METHOD* result = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "CppServer memory BIO");
+        if (result != nullptr)
+        {
+            BIO_meth_set_write(result, BioWrite);
+            BIO_meth_set_read(result, BioRead);
+            BIO_meth_set_ctrl(result, BioCtrl);
+        }
+        return result;
+    }();
+    return method;
+}
+
+int SSLMemoryStream::BioWrite(BIO* bio, const char* data, int size)
+{
+    BIO_clear_retry_flags(bio);
+
+    SSLMemoryStream* stream = (SSLMemoryStream*)BIO_get_data(bio);
+    if ((stream == nullptr) || (size < 0))
+        return -1;
+
+    stream->Append((const uint8_t*)data, (size_t)size);
+    return size;
+}
+
+int SSLMemoryStream::BioRead(BIO* bio, char* data, int size)
+{
+    BIO_clear_retry_flags(bio);
+
+    SSLMemoryStream* stream = (SSLMemoryStream*)BIO_get_data(bio);
+    if ((stream == nullptr) || (size < 0))
+        return -1;
+
+    // Ask for the next socket read
+    size_t available = stream->_input_size - stream->_input_offset;
+    if (available == 0)
+    {
+        BIO_set_retry_read(bio);
+        return -1;
+    }
+
+    size_t read = std::min(available, (size_t)size);
+    std::memcpy(data, stream->_input.data() + stream->_input_offset, read);
+    stream->_input_offset += read;
+    return (int)read;
+}
+
+long SSLMemoryStream::BioCtrl(BIO* bio, int cmd, long num, void* ptr)
+{
+    SSLMemoryStream* stream = (SSLMemoryStream*)BIO_get_data(bio);
+
+    switch (cmd)
+    {
+        case BIO_CTRL_FLUSH:
+            return 1;
+        case BIO_CTRL_PENDING:
+            return (stream != nullptr) ? (long)(stream->_input_size - stream->_input_offset) : 0;
+        default:
+            return 0;
+    }
+}
+
+} // namespace Asio
+} // namespace CppServer
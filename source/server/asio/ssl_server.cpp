@@ -8,6 +8,15 @@
 
 #include "server/asio/ssl_server.h"
 
+#include "time/timestamp.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
 namespace CppServer {
 namespace Asio {
 
@@ -24,10 +33,39 @@ SSLServer::SSLServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContex
       _bytes_pending(0),
       _bytes_sent(0),
       _bytes_received(0),
+      _connections_accepted(0),
+      _accept_errors(0),
+      _backlog_overflows(0),
+      _backlog_supported(true),
+      _handshakes_full(0),
+      _handshakes_resumed(0),
+      _handshakes_pending(0),
+      _handshake_latency_total(0),
+      _handshake_latency_max(0),
+      _handshake_queue_total(0),
+      _handshake_queue_max(0),
+      _records_sent(0),
+      _records_full(0),
+      _records_coalesced(0),
+      _sessions_idle(0),
+      _early_data_accepted(0),
+      _early_data_rejected(0),
+      _socket_reads(0),
+      _socket_writes(0),
+      _idle_timer(*_io_service),
+      _admission_timer(*_io_service),
+      _session_groups_index(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_multiple_acceptors(false),
+      _option_accept_concurrency(1),
+      _option_kernel_tls(false),
+      _option_dynamic_records(false),
+      _option_memory_bio(false),
+      _option_idle_release(CppCommon::Timespan::zero()),
+      _option_early_data(0)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -63,10 +101,39 @@ SSLServer::SSLServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContex
       _bytes_pending(0),
       _bytes_sent(0),
       _bytes_received(0),
+      _connections_accepted(0),
+      _accept_errors(0),
+      _backlog_overflows(0),
+      _backlog_supported(true),
+      _handshakes_full(0),
+      _handshakes_resumed(0),
+      _handshakes_pending(0),
+      _handshake_latency_total(0),
+      _handshake_latency_max(0),
+      _handshake_queue_total(0),
+      _handshake_queue_max(0),
+      _records_sent(0),
+      _records_full(0),
+      _records_coalesced(0),
+      _sessions_idle(0),
+      _early_data_accepted(0),
+      _early_data_rejected(0),
+      _socket_reads(0),
+      _socket_writes(0),
+      _idle_timer(*_io_service),
+      _admission_timer(*_io_service),
+      _session_groups_index(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_multiple_acceptors(false),
+      _option_accept_concurrency(1),
+      _option_kernel_tls(false),
+      _option_dynamic_records(false),
+      _option_memory_bio(false),
+      _option_idle_release(CppCommon::Timespan::zero()),
+      _option_early_data(0)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -95,10 +162,39 @@ SSLServer::SSLServer(std::shared_ptr<Service> service, std::shared_ptr<SSLContex
       _bytes_pending(0),
       _bytes_sent(0),
       _bytes_received(0),
+      _connections_accepted(0),
+      _accept_errors(0),
+      _backlog_overflows(0),
+      _backlog_supported(true),
+      _handshakes_full(0),
+      _handshakes_resumed(0),
+      _handshakes_pending(0),
+      _handshake_latency_total(0),
+      _handshake_latency_max(0),
+      _handshake_queue_total(0),
+      _handshake_queue_max(0),
+      _records_sent(0),
+      _records_full(0),
+      _records_coalesced(0),
+      _sessions_idle(0),
+      _early_data_accepted(0),
+      _early_data_rejected(0),
+      _socket_reads(0),
+      _socket_writes(0),
+      _idle_timer(*_io_service),
+      _admission_timer(*_io_service),
+      _session_groups_index(0),
       _option_keep_alive(false),
       _option_no_delay(false),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_multiple_acceptors(false),
+      _option_accept_concurrency(1),
+      _option_kernel_tls(false),
+      _option_dynamic_records(false),
+      _option_memory_bio(false),
+      _option_idle_release(CppCommon::Timespan::zero()),
+      _option_early_data(0)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -124,23 +220,65 @@ bool SSLServer::Start()
 
         // Create a server acceptor
         _acceptor = asio::ip::tcp::acceptor(*_io_service);
-        _acceptor.open(_endpoint.protocol());
-        if (option_reuse_address())
-            _acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true));
+        OpenAcceptor(_acceptor);
+
+        // Create additional server acceptors
+        _acceptors.clear();
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        if (option_reuse_port())
+        if (option_multiple_acceptors())
         {
-            typedef asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
-            _acceptor.set_option(reuse_port(true));
+            bool service_per_thread = (_service->services() > 1);
+            size_t count = service_per_thread ? _service->services() : _service->threads();
+            for (size_t i = 0; i < count; ++i)
+            {
+                // Skip the Asio IO service of the main acceptor
+                auto& io_service = _service->GetAsioService(i);
+                if (service_per_thread ? (io_service == _io_service) : (i == 0))
+                    continue;
+
+                auto acceptor = std::make_shared<Acceptor>(io_service);
+                OpenAcceptor(acceptor->acceptor);
+                _acceptors.emplace_back(acceptor);
+            }
         }
 #endif
-        _acceptor.bind(_endpoint);
-        _acceptor.listen();
+
+        // Create server accept operations
+        _accept_operations.clear();
+        for (size_t i = 0; i < option_accept_concurrency(); ++i)
+        {
+            _accept_operations.emplace_back(std::make_shared<AcceptOperation>(_io_service, _strand, _acceptor));
+            for (auto& acceptor : _acceptors)
+                _accept_operations.emplace_back(std::make_shared<AcceptOperation>(acceptor->io_service, acceptor->strand, acceptor->acceptor, acceptor));
+        }
+
+        // Initialize session groups
+        InitSessionGroups();
 
         // Reset statistic
         _bytes_pending = 0;
         _bytes_sent = 0;
         _bytes_received = 0;
+        _connections_accepted = 0;
+        _accept_errors = 0;
+        _backlog_overflows = 0;
+        _backlog_supported = true;
+        _handshakes_full = 0;
+        _handshakes_resumed = 0;
+        _handshakes_pending = 0;
+        _handshake_latency_total = 0;
+        _handshake_latency_max = 0;
+        _handshake_queue_total = 0;
+        _handshake_queue_max = 0;
+        _records_sent = 0;
+        _records_full = 0;
+        _records_coalesced = 0;
+        _sessions_idle = 0;
+        _early_data_accepted = 0;
+        _early_data_rejected = 0;
+        _socket_reads = 0;
+        _socket_writes = 0;
+        _admission.Reset();
 
         // Update the started flag
         _started = true;
@@ -148,8 +286,15 @@ bool SSLServer::Start()
         // Call the server started handler
         onStarted();
 
-        // Perform the first server accept
-        Accept();
+        // Perform the first server accepts
+        for (auto& operation : _accept_operations)
+            Accept(operation);
+
+        // Start measuring the event-loop queue delay
+        ProbeQueueDelay();
+
+        // Start releasing buffers of idle sessions
+        CheckIdleSessions();
     };
     if (_strand_required)
         _strand.post(start_handler);
@@ -172,12 +317,37 @@ bool SSLServer::Stop()
         if (!IsStarted())
             return;
 
-        // Reset the session
-        _session.reset();
+        // Cancel the admission control timer
+        asio::error_code ec;
+        _admission_timer.cancel(ec);
+
+        // Cancel the idle sessions timer
+        _idle_timer.cancel(ec);
 
         // Close the server acceptor
         _acceptor.close();
 
+        // Close additional server acceptors
+        for (auto& acceptor : _acceptors)
+        {
+            auto close_handler = [acceptor]() { acceptor->acceptor.close(); };
+            if (_strand_required)
+                acceptor->strand.post(close_handler);
+            else
+                acceptor->io_service->post(close_handler);
+        }
+
+        // Reset sessions of accept operations
+        for (auto& operation : _accept_operations)
+        {
+            auto reset_handler = [operation]() { operation->session.reset(); };
+            if (_strand_required)
+                operation->strand.post(reset_handler);
+            else
+                operation->io_service->post(reset_handler);
+        }
+        _accept_operations.clear();
+
         // Disconnect all sessions
         DisconnectAll();
 
@@ -209,45 +379,223 @@ bool SSLServer::Restart()
     return Start();
 }
 
-void SSLServer::Accept()
+void SSLServer::OpenAcceptor(asio::ip::tcp::acceptor& acceptor)
+{
+    acceptor.open(_endpoint.protocol());
+    if (option_reuse_address())
+        acceptor.set_option(asio::ip::tcp::acceptor::reuse_address(true));
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    if (option_reuse_port() || option_multiple_acceptors())
+    {
+        typedef asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
+        acceptor.set_option(reuse_port(true));
+    }
+#endif
+    acceptor.bind(_endpoint);
+    acceptor.listen();
+}
+
+void SSLServer::Accept(std::shared_ptr<AcceptOperation> operation)
 {
     if (!IsStarted())
         return;
 
-    // Dispatch the accept handler
+    // Dispatch the accept handler into the acceptor Asio IO service
     auto self(this->shared_from_this());
-    auto accept_handler = make_alloc_handler(_acceptor_storage, [this, self]()
+    auto accept_handler = make_alloc_handler(operation->storage, [this, self, operation]()
     {
         if (!IsStarted())
             return;
 
         // Create a new session to accept
-        _session = CreateSession(self);
+        operation->session = CreateSession(self);
 
-        auto async_accept_handler = make_alloc_handler(_acceptor_storage, [this, self](std::error_code ec)
+        auto async_accept_handler = make_alloc_handler(operation->storage, [this, self, operation](std::error_code ec)
         {
             if (!ec)
             {
-                RegisterSession();
-
-                // Connect a new session
-                _session->Connect();
+                // Update statistic
+                ++_connections_accepted;
+
+                // Check the listen backlog for overflow
+                CheckBacklog(operation->acceptor);
+
+                // Check the server admission control
+                if (!_admission.IsEnabled() || _admission.Admit((size_t)connected_sessions()))
+                {
+                    RegisterSession(operation->session);
+
+                    // Connect a new session
+                    operation->session->Connect();
+                }
+                else
+                    RejectSession(operation->session);
             }
             else
+            {
+                // Update statistic
+                if (ec != asio::error::operation_aborted)
+                    ++_accept_errors;
+
                 SendError(ec);
+            }
 
             // Perform the next server accept
-            Accept();
+            Accept(operation);
         });
         if (_strand_required)
-            _acceptor.async_accept(_session->socket(), bind_executor(_strand, async_accept_handler));
+            operation->acceptor.async_accept(operation->session->socket(), bind_executor(operation->strand, async_accept_handler));
         else
-            _acceptor.async_accept(_session->socket(), async_accept_handler);
+            operation->acceptor.async_accept(operation->session->socket(), async_accept_handler);
     });
     if (_strand_required)
-        _strand.dispatch(accept_handler);
+        operation->strand.dispatch(accept_handler);
+    else
+        operation->io_service->dispatch(accept_handler);
+}
+
+void SSLServer::CheckBacklog(asio::ip::tcp::acceptor& acceptor)
+{
+    if (!_backlog_supported)
+        return;
+
+#if defined(__linux__)
+    // For the socket in the LISTEN state Linux TCP_INFO reports the current
+    // accept queue length (sk_ack_backlog) in 'tcpi_unacked' and the listen
+    // backlog limit (sk_max_ack_backlog) in 'tcpi_sacked'. The kernel drops
+    // new handshakes once the queue is full, so a queue at the limit marks
+    // the backlog overflow.
+    struct tcp_info info;
+    socklen_t length = sizeof(info);
+    if ((getsockopt(acceptor.native_handle(), IPPROTO_TCP, TCP_INFO, &info, &length) == 0) && (info.tcpi_state == TCP_LISTEN))
+    {
+        if ((info.tcpi_sacked > 0) && (info.tcpi_unacked >= info.tcpi_sacked))
+            ++_backlog_overflows;
+        return;
+    }
+#endif
+
+    // Fallback: the listen backlog cannot be observed on this platform,
+    // so disable the check and keep the overflow counter at zero
+    _backlog_supported = false;
+}
+
+void SSLServer::RejectSession(std::shared_ptr<SSLSession>& session)
+{
+    asio::error_code ec;
+    auto& socket = session->socket();
+
+    // Call the connection rejected handler
+    auto endpoint = socket.remote_endpoint(ec);
+    onRejected(endpoint);
+
+    // Rejected connection is closed before the SSL handshake, so no reject
+    // response could be sent to it
+
+    // Close the rejected connection
+    socket.shutdown(asio::ip::tcp::socket::shutdown_both, ec);
+    socket.close(ec);
+
+    // Release the rejected session
+    session.reset();
+}
+
+void SSLServer::ProbeQueueDelay()
+{
+    if (!IsStarted() || !_admission.IsAdaptive())
+        return;
+
+    // Measure the queue delay of all session groups once per period
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const asio::error_code& ec)
+    {
+        if (ec || !IsStarted())
+            return;
+
+        // Shared state of a single probe
+        struct Probe
+        {
+            std::atomic<size_t> pending;
+            std::atomic<uint64_t> delay;
+        };
+        auto probe = std::make_shared<Probe>();
+
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+        probe->pending = _session_groups.size();
+        probe->delay = 0;
+        for (auto& group : _session_groups)
+        {
+            uint64_t timestamp = CppCommon::Timestamp::nano();
+            auto probe_handler = [this, self, probe, timestamp]()
+            {
+                // Keep the maximal queue delay of all session groups
+                uint64_t delay = CppCommon::Timestamp::nano() - timestamp;
+                uint64_t current = probe->delay;
+                while ((delay > current) && !probe->delay.compare_exchange_weak(current, delay)) {}
+
+                // Update the adaptive limit with the last probe result
+                if (--probe->pending == 0)
+                    _admission.Update(CppCommon::Timespan((int64_t)probe->delay.load()), (size_t)connected_sessions());
+            };
+            if (_strand_required)
+                group->strand.post(probe_handler);
+            else
+                group->io_service->post(probe_handler);
+        }
+
+        locker.unlock();
+
+        // Schedule the next probe
+        ProbeQueueDelay();
+    };
+    _admission_timer.expires_from_now(std::chrono::milliseconds(100));
+    if (_strand_required)
+        _admission_timer.async_wait(bind_executor(_strand, async_wait_handler));
     else
-        _io_service->dispatch(accept_handler);
+        _admission_timer.async_wait(async_wait_handler);
+}
+
+void SSLServer::CheckIdleSessions()
+{
+    if (!IsStarted() || (option_idle_release().total() <= 0))
+        return;
+
+    // Check all sessions for idle once per interval
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const asio::error_code& ec)
+    {
+        if (ec || !IsStarted())
+            return;
+
+        {
+            std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+            for (auto& session : _sessions)
+                session.second->TryIdle();
+        }
+
+        // Schedule the next check
+        CheckIdleSessions();
+    };
+    _idle_timer.expires_from_now(std::chrono::nanoseconds(option_idle_release().total()));
+    if (_strand_required)
+        _idle_timer.async_wait(bind_executor(_strand, async_wait_handler));
+    else
+        _idle_timer.async_wait(async_wait_handler);
+}
+
+std::shared_ptr<asio::io_service> SSLServer::GetSessionAsioService()
+{
+    // Keep the session on the Asio IO service of its acceptor
+    if (option_multiple_acceptors())
+    {
+        auto io_service = Service::GetCurrentAsioService();
+        if (io_service)
+            return io_service;
+    }
+
+    return _service->GetAsioService();
 }
 
 bool SSLServer::Multicast(const void* buffer, size_t size)
@@ -287,25 +635,44 @@ bool SSLServer::Multicast(const void* buffer, size_t size)
         if (!IsStarted())
             return;
 
-        std::lock_guard<std::mutex> locker1(_multicast_lock);
+        // Take the multicast buffer to share it between all session groups
+        auto multicast_buffer = std::make_shared<std::vector<uint8_t>>();
+        {
+            std::lock_guard<std::mutex> locker(_multicast_lock);
 
-        // Check for empty multicast buffer
-        if (_multicast_buffer.empty())
-            return;
+            // Check for empty multicast buffer
+            if (_multicast_buffer.empty())
+                return;
 
-        // Multicast all sessions
-        {
-            std::shared_lock<std::shared_mutex> locker2(_sessions_lock);
+            // Swap the multicast buffer
+            multicast_buffer->swap(_multicast_buffer);
 
-            for (auto& session : _sessions)
-                session.second->SendAsync(_multicast_buffer.data(), _multicast_buffer.size());
+            // Update statistic
+            _bytes_pending -= multicast_buffer->size();
         }
 
-        // Update statistic
-        _bytes_pending -= _multicast_buffer.size();
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
 
-        // Clear the multicast buffer
-        _multicast_buffer.clear();
+        // Multicast all session groups
+        for (auto& group : _session_groups)
+        {
+            auto multicast_group_handler = [self, group, multicast_buffer]()
+            {
+                std::shared_lock<std::shared_mutex> locker(group->lock);
+
+                // Multicast all sessions in the group
+                for (auto& session : group->sessions)
+                    session->SendAsync(multicast_buffer->data(), multicast_buffer->size());
+            };
+
+            // Perform the single group multicast in place
+            if (_session_groups.size() == 1)
+                multicast_group_handler();
+            else if (_strand_required)
+                group->strand.post(multicast_group_handler);
+            else
+                group->io_service->post(multicast_group_handler);
+        }
     });
     if (_strand_required)
         _strand.dispatch(multicast_handler);
@@ -315,6 +682,122 @@ bool SSLServer::Multicast(const void* buffer, size_t size)
     return true;
 }
 
+bool SSLServer::MulticastConflated(const std::string& key, const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    // Conflated value shared between all session groups
+    struct Value
+    {
+        std::string key;
+        std::vector<uint8_t> buffer;
+    };
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    auto value = std::make_shared<Value>();
+    value->key = key;
+    value->buffer.assign(bytes, bytes + size);
+
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Multicast all session groups
+    auto self(this->shared_from_this());
+    for (auto& group : _session_groups)
+    {
+        auto multicast_group_handler = [self, group, value]()
+        {
+            std::shared_lock<std::shared_mutex> locker(group->lock);
+
+            // Multicast all sessions in the group
+            for (auto& session : group->sessions)
+                session->SendConflated(value->key, value->buffer.data(), value->buffer.size());
+        };
+
+        // Perform the single group multicast in place
+        if (_session_groups.size() == 1)
+            multicast_group_handler();
+        else if (_strand_required)
+            group->strand.post(multicast_group_handler);
+        else
+            group->io_service->post(multicast_group_handler);
+    }
+
+    return true;
+}
+
+bool SSLServer::Publish(const std::string& topic, const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    // Published message shared between all session groups
+    struct Message
+    {
+        std::string topic;
+        std::vector<uint8_t> buffer;
+    };
+    std::shared_ptr<Message> message;
+
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Publish all session groups with topic subscribers
+    auto self(this->shared_from_this());
+    for (auto& group : _session_groups)
+    {
+        {
+            std::shared_lock<std::shared_mutex> group_locker(group->lock);
+
+            // Skip session groups without topic subscribers
+            if (group->topics.find(topic) == group->topics.end())
+                continue;
+        }
+
+        // Prepare the published message once
+        if (!message)
+        {
+            const uint8_t* bytes = (const uint8_t*)buffer;
+            message = std::make_shared<Message>();
+            message->topic = topic;
+            message->buffer.assign(bytes, bytes + size);
+        }
+
+        auto publish_group_handler = [self, group, message]()
+        {
+            std::shared_lock<std::shared_mutex> locker(group->lock);
+
+            // Publish all topic subscribers in the group
+            auto it = group->topics.find(message->topic);
+            if (it != group->topics.end())
+                for (auto& session : it->second)
+                    session->SendAsync(message->buffer.data(), message->buffer.size());
+        };
+
+        // Perform the single group publish in place
+        if (_session_groups.size() == 1)
+            publish_group_handler();
+        else if (_strand_required)
+            group->strand.post(publish_group_handler);
+        else
+            group->io_service->post(publish_group_handler);
+    }
+
+    return true;
+}
+
 bool SSLServer::DisconnectAll()
 {
     if (!IsStarted())
@@ -350,12 +833,59 @@ std::shared_ptr<SSLSession> SSLServer::FindSession(const CppCommon::UUID& id)
     return (it != _sessions.end()) ? it->second : nullptr;
 }
 
-void SSLServer::RegisterSession()
+void SSLServer::InitSessionGroups()
+{
+    std::unique_lock<std::shared_mutex> locker(_sessions_lock);
+
+    _session_groups.clear();
+    _session_groups_index = 0;
+
+    if (_service->services() > 1)
+    {
+        // Io-service-per-thread design: one session group per Asio IO service
+        for (size_t i = 0; i < _service->services(); ++i)
+            _session_groups.emplace_back(std::make_shared<SessionGroup>(_service->GetAsioService(i)));
+    }
+    else
+    {
+        // Single Asio IO service: one session group per working thread.
+        // Sessions are assigned to groups in round-robin and group tasks are
+        // run by any pool thread, so groups only split the fan-out work.
+        size_t groups = std::max(_service->threads(), (size_t)1);
+        for (size_t i = 0; i < groups; ++i)
+            _session_groups.emplace_back(std::make_shared<SessionGroup>(_io_service));
+    }
+}
+
+void SSLServer::RegisterSession(const std::shared_ptr<SSLSession>& session)
 {
     std::unique_lock<std::shared_mutex> locker(_sessions_lock);
 
     // Register a new session
-    _sessions.emplace(_session->id(), _session);
+    _sessions.emplace(session->id(), session);
+
+    if (_session_groups.empty())
+        return;
+
+    // Find the session group of the session Asio IO service
+    size_t group = _session_groups_index++ % _session_groups.size();
+    if (_service->services() > 1)
+    {
+        for (size_t i = 0; i < _session_groups.size(); ++i)
+        {
+            if (_session_groups[i]->io_service == session->io_service())
+            {
+                group = i;
+                break;
+            }
+        }
+    }
+
+    // Register the session in the group
+    std::unique_lock<std::shared_mutex> group_locker(_session_groups[group]->lock);
+    session->_group = group;
+    session->_group_index = _session_groups[group]->sessions.size();
+    _session_groups[group]->sessions.emplace_back(session);
 }
 
 void SSLServer::UnregisterSession(const CppCommon::UUID& id)
@@ -366,11 +896,105 @@ void SSLServer::UnregisterSession(const CppCommon::UUID& id)
     auto it = _sessions.find(id);
     if (it != _sessions.end())
     {
+        auto& session = it->second;
+
+        // Unregister the session from its group
+        if (session->_group < _session_groups.size())
+        {
+            auto& group = _session_groups[session->_group];
+            std::unique_lock<std::shared_mutex> group_locker(group->lock);
+            auto& sessions = group->sessions;
+            size_t index = session->_group_index;
+            if ((index < sessions.size()) && (sessions[index] == session))
+            {
+                // Replace the session with the last one in the group
+                sessions[index] = sessions.back();
+                sessions[index]->_group_index = index;
+                sessions.pop_back();
+            }
+
+            // Unsubscribe the session from all its topics
+            for (auto& topic : session->_topics)
+            {
+                auto subscribers = group->topics.find(topic.first);
+                if (subscribers != group->topics.end())
+                {
+                    // Replace the session with the last topic subscriber
+                    auto& topic_sessions = subscribers->second;
+                    topic_sessions[topic.second] = topic_sessions.back();
+                    topic_sessions[topic.second]->_topics[topic.first] = topic.second;
+                    topic_sessions.pop_back();
+                    if (topic_sessions.empty())
+                        group->topics.erase(subscribers);
+                }
+            }
+            session->_topics.clear();
+        }
+
         // Erase the session
         _sessions.erase(it);
     }
 }
 
+bool SSLServer::SubscribeSession(const std::shared_ptr<SSLSession>& session, const std::string& topic)
+{
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    // Check the session is registered in its group
+    if (session->_group >= _session_groups.size())
+        return false;
+    auto& group = _session_groups[session->_group];
+
+    std::unique_lock<std::shared_mutex> group_locker(group->lock);
+
+    auto& sessions = group->sessions;
+    if ((session->_group_index >= sessions.size()) || (sessions[session->_group_index] != session))
+        return false;
+
+    // Check the session is not already subscribed
+    if (session->_topics.find(topic) != session->_topics.end())
+        return false;
+
+    // Append the session to topic subscribers
+    auto& topic_sessions = group->topics[topic];
+    session->_topics.emplace(topic, topic_sessions.size());
+    topic_sessions.emplace_back(session);
+
+    return true;
+}
+
+bool SSLServer::UnsubscribeSession(const std::shared_ptr<SSLSession>& session, const std::string& topic)
+{
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    if (session->_group >= _session_groups.size())
+        return false;
+    auto& group = _session_groups[session->_group];
+
+    std::unique_lock<std::shared_mutex> group_locker(group->lock);
+
+    // Check the session is subscribed
+    auto it = session->_topics.find(topic);
+    if (it == session->_topics.end())
+        return false;
+
+    auto subscribers = group->topics.find(topic);
+    if (subscribers != group->topics.end())
+    {
+        // Replace the session with the last topic subscriber
+        auto& topic_sessions = subscribers->second;
+        size_t index = it->second;
+        topic_sessions[index] = topic_sessions.back();
+        topic_sessions[index]->_topics[topic] = index;
+        topic_sessions.pop_back();
+        if (topic_sessions.empty())
+            group->topics.erase(subscribers);
+    }
+    session->_topics.erase(topic);
+
+    return true;
+}
+
 void SSLServer::ClearBuffers()
 {
     std::lock_guard<std::mutex> locker(_multicast_lock);
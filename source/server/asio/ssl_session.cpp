@@ -9,25 +9,65 @@
 #include "server/asio/ssl_session.h"
 #include "server/asio/ssl_server.h"
 
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <vector>
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#include <unistd.h>
+#endif
+
 namespace CppServer {
 namespace Asio {
 
+//! @cond INTERNALS
+
+static void UpdateMaximum(std::atomic<uint64_t>& maximum, uint64_t value)
+{
+    uint64_t current = maximum.load();
+    while ((value > current) && !maximum.compare_exchange_weak(current, value)) {}
+}
+
+//! @endcond
+
 SSLSession::SSLSession(std::shared_ptr<SSLServer> server)
     : _id(CppCommon::UUID::Random()),
       _server(server),
-      _io_service(server->service()->GetAsioService()),
+      _io_service(server->GetSessionAsioService()),
       _strand(*_io_service),
       _strand_required(_server->_strand_required),
       _stream(*_io_service, *server->context()),
+      _kernel(_stream),
+      _memory(_stream, server->_buffer_pool),
       _connected(false),
       _handshaked(false),
+      _resumed(false),
+      _handshake_timestamp(0),
+      _handshake_offloaded(false),
+      _disconnect_deferred(false),
       _bytes_pending(0),
       _bytes_sending(0),
       _bytes_sent(0),
       _bytes_received(0),
       _receiving(false),
       _sending(false),
-      _send_buffer_flush_offset(0)
+      _send_buffer_flush_offset(0),
+      _send_buffer_flush_limit(0),
+      _record_size(MAX_RECORD_SIZE),
+      _record_count(0),
+      _record_timestamp(0),
+      _idle(false),
+      _idle_pending(false),
+      _activity_timestamp(0),
+      _early_data(false),
+      _early_accepted(false),
+      _early_receiving(false),
+      _early_received(false),
+      _conflation_size(0),
+      _values_conflated(0),
+      _group(0),
+      _group_index(0)
 {
 }
 
@@ -76,6 +116,17 @@ void SSLSession::Connect()
     _bytes_sending = 0;
     _bytes_sent = 0;
     _bytes_received = 0;
+    _values_conflated = 0;
+
+    // Start new sessions with small TLS records
+    _record_size = _server->option_dynamic_records() ? MIN_RECORD_SIZE : MAX_RECORD_SIZE;
+    _record_count = 0;
+    _record_timestamp = 0;
+
+    // Reset the idle mode
+    _idle = false;
+    _idle_pending = false;
+    _activity_timestamp = CppCommon::Timestamp::nano();
 
     // Update the connected flag
     _connected = true;
@@ -87,18 +138,87 @@ void SSLSession::Connect()
     auto connected_session(this->shared_from_this());
     _server->onConnected(connected_session);
 
+    // Attach OpenSSL to the socket to offload the encryption to the kernel TLS
+    if (_server->option_kernel_tls())
+        _kernel.Attach();
+
+    // Allow TLS 1.3 early data of resumed clients only with anti-replay protection
+    // of single-use sessions in the server session cache or if it is disabled explicitly
+    SSL* ssl = _stream.native_handle();
+    bool anti_replay = ((SSL_CTX_get_session_cache_mode(SSL_get_SSL_CTX(ssl)) & SSL_SESS_CACHE_SERVER) != 0) || ((SSL_get_options(ssl) & SSL_OP_NO_ANTI_REPLAY) != 0);
+    _early_data = (_server->option_early_data() > 0) && anti_replay && (_kernel.IsAttached() || _kernel.Attach(false));
+    _early_accepted = false;
+    _early_receiving = false;
+    _early_received = false;
+    _early_buffer.clear();
+    if (_early_data)
+    {
+        SSL_set_max_early_data(ssl, (uint32_t)_server->option_early_data());
+        SSL_set_recv_max_early_data(ssl, (uint32_t)_server->option_early_data());
+        SSL_set_allow_early_data_cb(ssl, AllowEarlyData, this);
+    }
+
+    // Replace Asio BIO pair with the memory BIO over pooled buffers
+    if (_server->option_memory_bio() && !_kernel.IsAttached())
+        _memory.Attach();
+
+    // Update the server handshakes statistic
+    _handshake_timestamp = CppCommon::Timestamp::nano();
+    _handshake_offloaded = false;
+    _disconnect_deferred = false;
+    ++_server->_handshakes_pending;
+
+    // Start the SSL handshake
+    TryHandshake();
+}
+
+void SSLSession::TryHandshake()
+{
     // Async SSL handshake with the handshake handler
     auto self(this->shared_from_this());
     auto async_handshake_handler = [this, self](std::error_code ec)
     {
+        // Process early data of the client before the handshake is finished
+        if (!ec && !_early_buffer.empty() && (SSL_is_init_finished(_stream.native_handle()) != 1))
+        {
+            ReceiveEarlyData();
+            return;
+        }
+
+        // Update the server handshakes statistic
+        --_server->_handshakes_pending;
+
         if (IsHandshaked())
             return;
 
         if (!ec)
         {
+            // Update the server handshake latency statistic
+            uint64_t latency = CppCommon::Timestamp::nano() - _handshake_timestamp;
+            _server->_handshake_latency_total += latency;
+            UpdateMaximum(_server->_handshake_latency_max, latency);
+
             // Update the handshaked flag
             _handshaked = true;
 
+            // Update the resumed flag and the server handshakes statistic
+            _resumed = (SSL_session_reused(_stream.native_handle()) == 1);
+            if (_resumed)
+                ++_server->_handshakes_resumed;
+            else
+                ++_server->_handshakes_full;
+
+            // Update the server early data statistic
+            if (_early_data)
+            {
+                int status = SSL_get_early_data_status(_stream.native_handle());
+                _early_accepted = (status == SSL_EARLY_DATA_ACCEPTED);
+                if (status == SSL_EARLY_DATA_ACCEPTED)
+                    ++_server->_early_data_accepted;
+                else if (status == SSL_EARLY_DATA_REJECTED)
+                    ++_server->_early_data_rejected;
+            }
+
             // Call the session handshaked handler
             onHandshaked();
 
@@ -109,6 +229,8 @@ void SSLSession::Connect()
             // Call the empty send buffer handler
             if (_send_buffer_main.empty())
                 onEmpty();
+            else
+                TrySend();
 
             // Try to receive something from the client
             TryReceive();
@@ -120,12 +242,166 @@ void SSLSession::Connect()
             Disconnect(true);
         }
     };
-    if (_strand_required)
+
+    auto handshake_service = _server->option_handshake_service();
+    if (handshake_service)
+    {
+        auto handshake_io_service = handshake_service->GetAsioService();
+
+        // Hand the handshaked session back to its own Asio service
+        auto async_offload_handler = [this, self, async_handshake_handler](std::error_code ec)
+        {
+            auto handshaked_handler = [this, async_handshake_handler, ec]() mutable
+            {
+                _handshake_offloaded = false;
+
+                // Perform the disconnect deferred during the offloaded handshake
+                if (_disconnect_deferred)
+                {
+                    _disconnect_deferred = false;
+                    --_server->_handshakes_pending;
+                    Disconnect(true);
+                    return;
+                }
+
+                async_handshake_handler(ec);
+            };
+            if (_strand_required)
+                _strand.post(handshaked_handler);
+            else
+                _io_service->post(handshaked_handler);
+        };
+
+        // Async SSL handshake on the handshake service. Asio invokes intermediate
+        // handlers of the handshake operation with the executor associated with
+        // the final handler, so the handshake crypto never runs on session threads.
+        auto handshake_handler = [this, self, handshake_io_service, async_offload_handler]()
+        {
+            // Update the server handshake queue statistic
+            if (!_early_received)
+            {
+                uint64_t queue = CppCommon::Timestamp::nano() - _handshake_timestamp;
+                _server->_handshake_queue_total += queue;
+                UpdateMaximum(_server->_handshake_queue_max, queue);
+            }
+
+            if (_early_data)
+                _kernel.async_handshake(asio::ssl::stream_base::server, _early_buffer, bind_executor(handshake_io_service->get_executor(), async_offload_handler));
+            else if (_kernel.IsAttached())
+                _kernel.async_handshake(asio::ssl::stream_base::server, bind_executor(handshake_io_service->get_executor(), async_offload_handler));
+            else if (_memory.IsAttached())
+                _memory.async_handshake(asio::ssl::stream_base::server, bind_executor(handshake_io_service->get_executor(), async_offload_handler));
+            else
+                _stream.async_handshake(asio::ssl::stream_base::server, bind_executor(handshake_io_service->get_executor(), async_offload_handler));
+        };
+        _handshake_offloaded = true;
+        handshake_io_service->post(handshake_handler);
+    }
+    else if (_early_data)
+    {
+        if (_strand_required)
+            _kernel.async_handshake(asio::ssl::stream_base::server, _early_buffer, bind_executor(_strand, async_handshake_handler));
+        else
+            _kernel.async_handshake(asio::ssl::stream_base::server, _early_buffer, async_handshake_handler);
+    }
+    else if (_kernel.IsAttached())
+    {
+        if (_strand_required)
+            _kernel.async_handshake(asio::ssl::stream_base::server, bind_executor(_strand, async_handshake_handler));
+        else
+            _kernel.async_handshake(asio::ssl::stream_base::server, async_handshake_handler);
+    }
+    else if (_memory.IsAttached())
+    {
+        if (_strand_required)
+            _memory.async_handshake(asio::ssl::stream_base::server, bind_executor(_strand, async_handshake_handler));
+        else
+            _memory.async_handshake(asio::ssl::stream_base::server, async_handshake_handler);
+    }
+    else if (_strand_required)
         _stream.async_handshake(asio::ssl::stream_base::server, bind_executor(_strand, async_handshake_handler));
     else
         _stream.async_handshake(asio::ssl::stream_base::server, async_handshake_handler);
 }
 
+void SSLSession::ReceiveEarlyData()
+{
+    // Update statistic
+    _bytes_received += _early_buffer.size();
+    _server->_bytes_received += _early_buffer.size();
+
+    // Call the buffer received handler, which could send the response
+    // into the main send buffer before the handshake is finished
+    _early_received = true;
+    _early_receiving = true;
+    onReceived(_early_buffer.data(), _early_buffer.size());
+    _early_receiving = false;
+    _early_buffer.clear();
+
+    // Take the 0.5-RTT response from the main send buffer
+    {
+        std::lock_guard<std::mutex> locker(_send_lock);
+
+        _early_buffer.swap(_send_buffer_main);
+
+        // Update statistic
+        _bytes_pending = _send_buffer_main.size() + _conflation_size;
+        _bytes_sending += _early_buffer.size();
+    }
+
+    // Continue the handshake if there is no response
+    if (_early_buffer.empty())
+    {
+        TryHandshake();
+        return;
+    }
+
+    // Async write 0.5-RTT data with the write handler
+    auto self(this->shared_from_this());
+    auto async_write_handler = [this, self](std::error_code ec, size_t size)
+    {
+        if (IsHandshaked())
+            return;
+
+        // Update statistic
+        _bytes_sending -= _early_buffer.size();
+        _early_buffer.clear();
+        if (size > 0)
+        {
+            _bytes_sent += size;
+            _server->_bytes_sent += size;
+
+            // Call the buffer sent handler
+            onSent(size, bytes_pending());
+        }
+
+        if (!ec)
+        {
+            // Continue the handshake
+            TryHandshake();
+        }
+        else
+        {
+            // Disconnect in case of the bad write
+            --_server->_handshakes_pending;
+            SendError(ec);
+            Disconnect(true);
+        }
+    };
+    if (_strand_required)
+        _kernel.async_write_early(asio::buffer(_early_buffer.data(), _early_buffer.size()), bind_executor(_strand, async_write_handler));
+    else
+        _kernel.async_write_early(asio::buffer(_early_buffer.data(), _early_buffer.size()), async_write_handler);
+}
+
+int SSLSession::AllowEarlyData(SSL* ssl, void* arg)
+{
+    // Call the session early data handler in the server
+    SSLSession* session = (SSLSession*)arg;
+    auto handshaking_session(session->shared_from_this());
+    return session->_server->onEarlyData(handshaking_session) ? 1 : 0;
+}
+
 bool SSLSession::Disconnect(bool dispatch)
 {
     if (!IsConnected())
@@ -138,6 +414,14 @@ bool SSLSession::Disconnect(bool dispatch)
         if (!IsConnected())
             return;
 
+        // Defer the disconnect until the offloaded handshake is handed back,
+        // so the SSL shutdown never races with the handshake service threads
+        if (_handshake_offloaded)
+        {
+            _disconnect_deferred = true;
+            return;
+        }
+
         // Async SSL shutdown with the shutdown handler
         auto async_shutdown_handler = [this, self](std::error_code ec)
         {
@@ -147,8 +431,13 @@ bool SSLSession::Disconnect(bool dispatch)
             // Close the session socket
             socket().close();
 
+            // Update the server socket statistic of the memory BIO
+            _server->_socket_reads += _memory.socket_reads();
+            _server->_socket_writes += _memory.socket_writes();
+
             // Update the handshaked flag
             _handshaked = false;
+            _resumed = false;
 
             // Update the connected flag
             _connected = false;
@@ -156,10 +445,18 @@ bool SSLSession::Disconnect(bool dispatch)
             // Update sending/receiving flags
             _receiving = false;
             _sending = false;
+            _early_receiving = false;
 
             // Clear send/receive buffers
             ClearBuffers();
 
+            // Leave the idle mode
+            if (_idle)
+            {
+                _idle = false;
+                --_server->_sessions_idle;
+            }
+
             // Call the session disconnected handler
             onDisconnected();
 
@@ -177,7 +474,21 @@ bool SSLSession::Disconnect(bool dispatch)
             else
                 _server->_io_service->dispatch(unregister_session_handler);
         };
-        if (_strand_required)
+        if (_kernel.IsAttached())
+        {
+            if (_strand_required)
+                _kernel.async_shutdown(bind_executor(_strand, async_shutdown_handler));
+            else
+                _kernel.async_shutdown(async_shutdown_handler);
+        }
+        else if (_memory.IsAttached())
+        {
+            if (_strand_required)
+                _memory.async_shutdown(bind_executor(_strand, async_shutdown_handler));
+            else
+                _memory.async_shutdown(async_shutdown_handler);
+        }
+        else if (_strand_required)
             _stream.async_shutdown(bind_executor(_strand, async_shutdown_handler));
         else
             _stream.async_shutdown(async_shutdown_handler);
@@ -215,7 +526,13 @@ size_t SSLSession::Send(const void* buffer, size_t size)
     asio::error_code ec;
 
     // Send data to the client
-    size_t sent = asio::write(_stream, asio::buffer(buffer, size), ec);
+    size_t sent = 0;
+    if (_kernel.IsAttached())
+        sent = _kernel.write(asio::buffer(buffer, size), ec);
+    else if (_memory.IsAttached())
+        sent = _memory.write(asio::buffer(buffer, size), ec);
+    else
+        sent = asio::write(_stream, asio::buffer(buffer, size), ec);
     if (sent > 0)
     {
         // Update statistic
@@ -273,7 +590,12 @@ size_t SSLSession::Send(const void* buffer, size_t size, const CppCommon::Timesp
 
     // Async write some data to the client
     size_t sent = 0;
-    _stream.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
+    if (_kernel.IsAttached())
+        _kernel.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
+    else if (_memory.IsAttached())
+        _memory.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
+    else
+        _stream.async_write_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t write) { async_done_handler(ec); sent = write; });
 
     // Wait for complete or timeout
     std::unique_lock<std::mutex> lck(mtx);
@@ -300,13 +622,69 @@ size_t SSLSession::Send(const void* buffer, size_t size, const CppCommon::Timesp
     return sent;
 }
 
+size_t SSLSession::SendFile(int fd, int64_t offset, size_t size)
+{
+    if (!IsHandshaked())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    // Send the file content with sendfile() and the kernel TLS
+    if (_kernel.IsSendOffloaded())
+    {
+        asio::error_code ec;
+
+        size_t sent = _kernel.sendfile(fd, offset, size, ec);
+        if (sent > 0)
+        {
+            // Update statistic
+            _bytes_sent += sent;
+            _server->_bytes_sent += sent;
+
+            // Call the buffer sent handler
+            onSent(sent, bytes_pending());
+        }
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            Disconnect();
+        }
+
+        return sent;
+    }
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    // Read the file content by chunks and send it with the SSL stream
+    std::vector<uint8_t> chunk(std::min(size, (size_t)65536));
+    size_t sent = 0;
+    while (sent < size)
+    {
+        ssize_t read = ::pread(fd, chunk.data(), std::min(chunk.size(), size - sent), (off_t)(offset + sent));
+        if (read <= 0)
+            break;
+
+        size_t written = Send(chunk.data(), (size_t)read);
+        sent += written;
+        if (written < (size_t)read)
+            break;
+    }
+    return sent;
+#else
+    return 0;
+#endif
+}
+
 bool SSLSession::SendAsync(const void* buffer, size_t size)
 {
     assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
     if (buffer == nullptr)
         return false;
 
-    if (!IsHandshaked())
+    // Responses to TLS 1.3 early data are allowed before the handshake is finished
+    if (!IsHandshaked() && !_early_receiving)
         return false;
 
     if (size == 0)
@@ -316,14 +694,77 @@ bool SSLSession::SendAsync(const void* buffer, size_t size)
         std::lock_guard<std::mutex> locker(_send_lock);
 
         // Detect multiple send handlers
-        bool send_required = _send_buffer_main.empty() || _send_buffer_flush.empty();
+        bool send_required = (_send_buffer_main.empty() && _conflation_values.empty()) || _send_buffer_flush.empty();
+
+        // Reacquire the main send buffer released by the idle session
+        if (_send_buffer_main.capacity() == 0)
+            _server->_buffer_pool.Acquire(_send_buffer_main, std::max(size, option_send_buffer_size()));
 
         // Fill the main send buffer
         const uint8_t* bytes = (const uint8_t*)buffer;
         _send_buffer_main.insert(_send_buffer_main.end(), bytes, bytes + size);
 
         // Update statistic
-        _bytes_pending = _send_buffer_main.size();
+        _bytes_pending = _send_buffer_main.size() + _conflation_size;
+
+        // Avoid multiple send handlers
+        if (!send_required)
+            return true;
+    }
+
+    // Dispatch the send handler
+    auto self(this->shared_from_this());
+    auto send_handler = [this, self]()
+    {
+        // Try to send the main buffer
+        TrySend();
+    };
+    if (_strand_required)
+        _strand.dispatch(send_handler);
+    else
+        _io_service->dispatch(send_handler);
+
+    return true;
+}
+
+bool SSLSession::SendConflated(const std::string& key, const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    if (!IsConnected())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    {
+        std::lock_guard<std::mutex> locker(_send_lock);
+
+        // Detect multiple send handlers
+        bool send_required = (_send_buffer_main.empty() && _conflation_values.empty()) || _send_buffer_flush.empty();
+
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        auto it = _conflation_index.find(key);
+        if (it != _conflation_index.end())
+        {
+            // Replace the pending value in place
+            auto& value = _conflation_values[it->second].second;
+            _conflation_size -= value.size();
+            value.assign(bytes, bytes + size);
+            ++_values_conflated;
+        }
+        else
+        {
+            // Queue a new value for the key
+            _conflation_index.emplace(key, _conflation_values.size());
+            _conflation_values.emplace_back(key, std::vector<uint8_t>(bytes, bytes + size));
+        }
+        _conflation_size += size;
+
+        // Update statistic
+        _bytes_pending = _send_buffer_main.size() + _conflation_size;
 
         // Avoid multiple send handlers
         if (!send_required)
@@ -360,7 +801,13 @@ size_t SSLSession::Receive(void* buffer, size_t size)
     asio::error_code ec;
 
     // Receive data from the client
-    size_t received = _stream.read_some(asio::buffer(buffer, size), ec);
+    size_t received = 0;
+    if (_kernel.IsAttached())
+        received = _kernel.read_some(asio::buffer(buffer, size), ec);
+    else if (_memory.IsAttached())
+        received = _memory.read_some(asio::buffer(buffer, size), ec);
+    else
+        received = _stream.read_some(asio::buffer(buffer, size), ec);
     if (received > 0)
     {
         // Update statistic
@@ -425,7 +872,12 @@ size_t SSLSession::Receive(void* buffer, size_t size, const CppCommon::Timespan&
 
     // Async read some data from the client
     size_t received = 0;
-    _stream.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
+    if (_kernel.IsAttached())
+        _kernel.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
+    else if (_memory.IsAttached())
+        _memory.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
+    else
+        _stream.async_read_some(asio::buffer(buffer, size), [&](std::error_code ec, size_t read) { async_done_handler(ec); received = read; });
 
     // Wait for complete or timeout
     std::unique_lock<std::mutex> lck(mtx);
@@ -465,6 +917,16 @@ void SSLSession::ReceiveAsync()
     TryReceive();
 }
 
+bool SSLSession::Subscribe(const std::string& topic)
+{
+    return _server->SubscribeSession(this->shared_from_this(), topic);
+}
+
+bool SSLSession::Unsubscribe(const std::string& topic)
+{
+    return _server->UnsubscribeSession(this->shared_from_this(), topic);
+}
+
 void SSLSession::TryReceive()
 {
     if (_receiving)
@@ -483,6 +945,18 @@ void SSLSession::TryReceive()
         if (!IsHandshaked())
             return;
 
+        // Enter the idle mode when the receive was cancelled by the idle check
+        if (_idle_pending)
+        {
+            _idle_pending = false;
+            if (ec == asio::error::operation_aborted)
+            {
+                EnterIdle();
+                TryReceive();
+                return;
+            }
+        }
+
         // Received some data from the client
         if (size > 0)
         {
@@ -490,12 +964,27 @@ void SSLSession::TryReceive()
             _bytes_received += size;
             _server->_bytes_received += size;
 
-            // Call the buffer received handler
-            onReceived(_receive_buffer.data(), size);
+            if (_idle)
+            {
+                // Call the buffer received handler with the small idle buffer
+                onReceived(_idle_buffer, size);
 
-            // If the receive buffer is full increase its size
-            if (_receive_buffer.size() == size)
-                _receive_buffer.resize(2 * size);
+                // Reacquire buffers of the active session
+                LeaveIdle();
+            }
+            else
+            {
+                // Call the buffer received handler
+                onReceived(_receive_buffer.data(), size);
+
+                // If the receive buffer is full increase its size
+                if (_receive_buffer.size() == size)
+                    _receive_buffer.resize(2 * size);
+            }
+
+            // Update the activity timestamp
+            if (_server->option_idle_release().total() > 0)
+                _activity_timestamp = CppCommon::Timestamp::nano();
         }
 
         // Try to receive again if the session is valid
@@ -507,10 +996,25 @@ void SSLSession::TryReceive()
             Disconnect(true);
         }
     });
-    if (_strand_required)
-        _stream.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), bind_executor(_strand, async_receive_handler));
+    auto receive_buffer = _idle ? asio::buffer(_idle_buffer, sizeof(_idle_buffer)) : asio::buffer(_receive_buffer.data(), _receive_buffer.size());
+    if (_kernel.IsAttached())
+    {
+        if (_strand_required)
+            _kernel.async_read_some(receive_buffer, bind_executor(_strand, async_receive_handler));
+        else
+            _kernel.async_read_some(receive_buffer, async_receive_handler);
+    }
+    else if (_memory.IsAttached())
+    {
+        if (_strand_required)
+            _memory.async_read_some(receive_buffer, bind_executor(_strand, async_receive_handler));
+        else
+            _memory.async_read_some(receive_buffer, async_receive_handler);
+    }
+    else if (_strand_required)
+        _stream.async_read_some(receive_buffer, bind_executor(_strand, async_receive_handler));
     else
-        _stream.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), async_receive_handler);
+        _stream.async_read_some(receive_buffer, async_receive_handler);
 }
 
 void SSLSession::TrySend()
@@ -521,11 +1025,20 @@ void SSLSession::TrySend()
     if (!IsHandshaked())
         return;
 
+    bool dynamic = _server->option_dynamic_records();
+
     // Swap send buffers
     if (_send_buffer_flush.empty())
     {
         std::lock_guard<std::mutex> locker(_send_lock);
 
+        // Flush the newest conflated values after all sent data
+        for (auto& value : _conflation_values)
+            _send_buffer_main.insert(_send_buffer_main.end(), value.second.begin(), value.second.end());
+        _conflation_index.clear();
+        _conflation_values.clear();
+        _conflation_size = 0;
+
         // Swap flush and main buffers
         _send_buffer_flush.swap(_send_buffer_main);
         _send_buffer_flush_offset = 0;
@@ -534,8 +1047,25 @@ void SSLSession::TrySend()
         _bytes_pending = 0;
         _bytes_sending += _send_buffer_flush.size();
     }
-    else
-        return;
+    else if (dynamic && ((_send_buffer_flush.size() - _send_buffer_flush_offset) < _record_size))
+    {
+        std::lock_guard<std::mutex> locker(_send_lock);
+
+        // Coalesce small pending writes into the sending record
+        if (!_send_buffer_main.empty())
+        {
+            _send_buffer_flush.erase(_send_buffer_flush.begin(), _send_buffer_flush.begin() + _send_buffer_flush_offset);
+            _send_buffer_flush.insert(_send_buffer_flush.end(), _send_buffer_main.begin(), _send_buffer_main.end());
+            _send_buffer_flush_offset = 0;
+
+            // Update statistic
+            _bytes_pending -= _send_buffer_main.size();
+            _bytes_sending += _send_buffer_main.size();
+            ++_server->_records_coalesced;
+
+            _send_buffer_main.clear();
+        }
+    }
 
     // Check if the flush buffer is empty
     if (_send_buffer_flush.empty())
@@ -545,6 +1075,20 @@ void SSLSession::TrySend()
         return;
     }
 
+    // Limit the size of the sending TLS record
+    _send_buffer_flush_limit = _send_buffer_flush.size() - _send_buffer_flush_offset;
+    if (dynamic)
+    {
+        // Restart idle sessions with small TLS records
+        if ((_record_size > MIN_RECORD_SIZE) && ((CppCommon::Timestamp::nano() - _record_timestamp) > RECORD_IDLE_TIMEOUT))
+        {
+            _record_size = MIN_RECORD_SIZE;
+            _record_count = 0;
+        }
+
+        _send_buffer_flush_limit = std::min(_send_buffer_flush_limit, _record_size);
+    }
+
     // Async write with the write handler
     _sending = true;
     auto self(this->shared_from_this());
@@ -574,6 +1118,26 @@ void SSLSession::TrySend()
                 _send_buffer_flush_offset = 0;
             }
 
+            // Update dynamic TLS records (partial writes send a single record at once)
+            if (_server->option_dynamic_records())
+            {
+                ++_server->_records_sent;
+                if (size == _record_size)
+                    ++_server->_records_full;
+
+                // Grow the record size for bulk transfers
+                if ((++_record_count >= RECORD_RAMP_COUNT) && (_record_size < MAX_RECORD_SIZE))
+                {
+                    _record_size = std::min(_record_size * 2, MAX_RECORD_SIZE);
+                    _record_count = 0;
+                }
+                _record_timestamp = CppCommon::Timestamp::nano();
+            }
+
+            // Update the activity timestamp
+            if (_server->option_idle_release().total() > 0)
+                _activity_timestamp = CppCommon::Timestamp::nano();
+
             // Call the buffer sent handler
             onSent(size, bytes_pending());
         }
@@ -587,10 +1151,88 @@ void SSLSession::TrySend()
             Disconnect(true);
         }
     });
+    if (_kernel.IsAttached())
+    {
+        if (_strand_required)
+            _kernel.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush_limit), bind_executor(_strand, async_write_handler));
+        else
+            _kernel.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush_limit), async_write_handler);
+    }
+    else if (_memory.IsAttached())
+    {
+        if (_strand_required)
+            _memory.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush_limit), bind_executor(_strand, async_write_handler));
+        else
+            _memory.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush_limit), async_write_handler);
+    }
+    else if (_strand_required)
+        _stream.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush_limit), bind_executor(_strand, async_write_handler));
+    else
+        _stream.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush_limit), async_write_handler);
+}
+
+void SSLSession::TryIdle()
+{
+    // Post the idle handler
+    auto self(this->shared_from_this());
+    auto idle_handler = [this, self]()
+    {
+        if (!IsHandshaked() || _idle || _idle_pending || !_receiving || _sending)
+            return;
+
+        // Check the session activity during the idle interval
+        if ((CppCommon::Timestamp::nano() - _activity_timestamp) < (uint64_t)_server->option_idle_release().total())
+            return;
+
+        // Skip sessions with pending data
+        {
+            std::lock_guard<std::mutex> locker(_send_lock);
+            if (!_send_buffer_main.empty() || !_send_buffer_flush.empty() || !_conflation_values.empty())
+                return;
+        }
+
+        // Cancel the pending receive to release the receive buffer
+        _idle_pending = true;
+        asio::error_code ec;
+        socket().cancel(ec);
+    };
     if (_strand_required)
-        _stream.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), bind_executor(_strand, async_write_handler));
+        _strand.post(idle_handler);
     else
-        _stream.async_write_some(asio::buffer(_send_buffer_flush.data() + _send_buffer_flush_offset, _send_buffer_flush.size() - _send_buffer_flush_offset), async_write_handler);
+        _io_service->post(idle_handler);
+}
+
+void SSLSession::EnterIdle()
+{
+    // Release the receive buffer and the consumed memory BIO input into the buffer pool
+    _server->_buffer_pool.Release(_receive_buffer);
+    if (_memory.IsAttached())
+        _memory.Release();
+
+    // Release empty send buffers into the buffer pool
+    {
+        std::lock_guard<std::mutex> locker(_send_lock);
+        if (_send_buffer_main.empty())
+            _server->_buffer_pool.Release(_send_buffer_main);
+        if (_send_buffer_flush.empty())
+            _server->_buffer_pool.Release(_send_buffer_flush);
+    }
+
+    // Update the idle flag
+    _idle = true;
+    ++_server->_sessions_idle;
+}
+
+void SSLSession::LeaveIdle()
+{
+    // Reacquire the receive buffer from the buffer pool
+    size_t size = option_receive_buffer_size();
+    _server->_buffer_pool.Acquire(_receive_buffer, size);
+    _receive_buffer.resize(size);
+
+    // Update the idle flag
+    _idle = false;
+    --_server->_sessions_idle;
 }
 
 void SSLSession::ClearBuffers()
@@ -602,6 +1244,9 @@ void SSLSession::ClearBuffers()
         _send_buffer_main.clear();
         _send_buffer_flush.clear();
         _send_buffer_flush_offset = 0;
+        _conflation_index.clear();
+        _conflation_values.clear();
+        _conflation_size = 0;
 
         // Update statistic
         _bytes_pending = 0;
@@ -15,7 +15,7 @@ namespace Asio {
 TCPSession::TCPSession(std::shared_ptr<TCPServer> server)
     : _id(CppCommon::UUID::Random()),
       _server(server),
-      _io_service(server->service()->GetAsioService()),
+      _io_service(server->GetSessionAsioService()),
       _strand(*_io_service),
       _strand_required(_server->_strand_required),
       _socket(*_io_service),
@@ -26,7 +26,11 @@ TCPSession::TCPSession(std::shared_ptr<TCPServer> server)
       _bytes_received(0),
       _receiving(false),
       _sending(false),
-      _send_buffer_flush_offset(0)
+      _send_buffer_flush_offset(0),
+      _conflation_size(0),
+      _values_conflated(0),
+      _group(0),
+      _group_index(0)
 {
 }
 
@@ -64,6 +68,13 @@ void TCPSession::Connect()
     // Apply the option: no delay
     if (_server->option_no_delay())
         _socket.set_option(asio::ip::tcp::no_delay(true));
+    // Apply the option: packet timestamps
+    if (_server->option_receive_timestamps() || _server->option_transmit_timestamps())
+    {
+        asio::error_code ec;
+        if (!Timestamping::Enable(_socket, _server->option_receive_timestamps(), _server->option_transmit_timestamps(), ec) && ec)
+            SendError(ec);
+    }
 
     // Prepare receive & send buffers
     _receive_buffer.resize(option_receive_buffer_size());
@@ -75,6 +86,7 @@ void TCPSession::Connect()
     _bytes_sending = 0;
     _bytes_sent = 0;
     _bytes_received = 0;
+    _values_conflated = 0;
 
     // Update the connected flag
     _connected = true;
@@ -92,6 +104,10 @@ void TCPSession::Connect()
 
     // Try to receive something from the client
     TryReceive();
+
+    // Start receiving transmit timestamps
+    if (_server->option_transmit_timestamps() && Timestamping::IsSupported())
+        TryReceiveTransmitTimestamps();
 }
 
 bool TCPSession::Disconnect(bool dispatch)
@@ -270,14 +286,73 @@ bool TCPSession::SendAsync(const void* buffer, size_t size)
         std::lock_guard<std::mutex> locker(_send_lock);
 
         // Detect multiple send handlers
-        bool send_required = _send_buffer_main.empty() || _send_buffer_flush.empty();
+        bool send_required = (_send_buffer_main.empty() && _conflation_values.empty()) || _send_buffer_flush.empty();
 
         // Fill the main send buffer
         const uint8_t* bytes = (const uint8_t*)buffer;
         _send_buffer_main.insert(_send_buffer_main.end(), bytes, bytes + size);
 
         // Update statistic
-        _bytes_pending = _send_buffer_main.size();
+        _bytes_pending = _send_buffer_main.size() + _conflation_size;
+
+        // Avoid multiple send handlers
+        if (!send_required)
+            return true;
+    }
+
+    // Dispatch the send handler
+    auto self(this->shared_from_this());
+    auto send_handler = [this, self]()
+    {
+        // Try to send the main buffer
+        TrySend();
+    };
+    if (_strand_required)
+        _strand.dispatch(send_handler);
+    else
+        _io_service->dispatch(send_handler);
+
+    return true;
+}
+
+bool TCPSession::SendConflated(const std::string& key, const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    if (!IsConnected())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    {
+        std::lock_guard<std::mutex> locker(_send_lock);
+
+        // Detect multiple send handlers
+        bool send_required = (_send_buffer_main.empty() && _conflation_values.empty()) || _send_buffer_flush.empty();
+
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        auto it = _conflation_index.find(key);
+        if (it != _conflation_index.end())
+        {
+            // Replace the pending value in place
+            auto& value = _conflation_values[it->second].second;
+            _conflation_size -= value.size();
+            value.assign(bytes, bytes + size);
+            ++_values_conflated;
+        }
+        else
+        {
+            // Queue a new value for the key
+            _conflation_index.emplace(key, _conflation_values.size());
+            _conflation_values.emplace_back(key, std::vector<uint8_t>(bytes, bytes + size));
+        }
+        _conflation_size += size;
+
+        // Update statistic
+        _bytes_pending = _send_buffer_main.size() + _conflation_size;
 
         // Avoid multiple send handlers
         if (!send_required)
@@ -419,8 +494,24 @@ void TCPSession::ReceiveAsync()
     TryReceive();
 }
 
+bool TCPSession::Subscribe(const std::string& topic)
+{
+    return _server->SubscribeSession(this->shared_from_this(), topic);
+}
+
+bool TCPSession::Unsubscribe(const std::string& topic)
+{
+    return _server->UnsubscribeSession(this->shared_from_this(), topic);
+}
+
 void TCPSession::TryReceive()
 {
+    if (_server->option_receive_timestamps())
+    {
+        TryReceiveTimestamped();
+        return;
+    }
+
     if (_receiving)
         return;
 
@@ -467,6 +558,96 @@ void TCPSession::TryReceive()
         _socket.async_read_some(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), async_receive_handler);
 }
 
+void TCPSession::TryReceiveTimestamped()
+{
+    if (_receiving)
+        return;
+
+    if (!IsConnected())
+        return;
+
+    // Async wait for readable socket with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec)
+    {
+        _receiving = false;
+
+        if (!IsConnected())
+            return;
+
+        // Receive some data with its receive timestamp
+        size_t size = 0;
+        PacketTimestamp timestamp;
+        if (!ec)
+            size = Timestamping::Receive(_socket, _receive_buffer.data(), _receive_buffer.size(), timestamp, ec);
+
+        // Received some data from the client
+        if (size > 0)
+        {
+            // Update statistic
+            _bytes_received += size;
+            _server->_bytes_received += size;
+
+            // Call the timestamped buffer received handler
+            onReceivedTimestamped(_receive_buffer.data(), size, timestamp);
+
+            // If the receive buffer is full increase its size
+            if (_receive_buffer.size() == size)
+                _receive_buffer.resize(2 * size);
+        }
+
+        // Try to receive again if the session is valid
+        if (!ec)
+            TryReceiveTimestamped();
+        else
+        {
+            SendError(ec);
+            Disconnect(true);
+        }
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::tcp::socket::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::tcp::socket::wait_read, async_wait_handler);
+}
+
+void TCPSession::TryReceiveTransmitTimestamps()
+{
+    if (!IsConnected())
+        return;
+
+    // Async wait for the socket error queue with the transmit timestamps handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const std::error_code& ec)
+    {
+        if (ec || !IsConnected())
+            return;
+
+        // Call the transmit timestamp handler for each pending timestamp
+        // and the error handler for other entries of the error queue
+        uint32_t id = 0;
+        PacketTimestamp timestamp;
+        asio::error_code error;
+        for (;;)
+        {
+            if (Timestamping::ReceiveTransmit(_socket.native_handle(), id, timestamp, error))
+                onSentTimestamp(id, timestamp);
+            else if (error)
+                SendError(error);
+            else
+                break;
+        }
+
+        // Wait for new transmit timestamps
+        TryReceiveTransmitTimestamps();
+    };
+    if (_strand_required)
+        _socket.async_wait(asio::ip::tcp::socket::wait_error, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::tcp::socket::wait_error, async_wait_handler);
+}
+
 void TCPSession::TrySend()
 {
     if (_sending)
@@ -480,6 +661,13 @@ void TCPSession::TrySend()
     {
         std::lock_guard<std::mutex> locker(_send_lock);
 
+        // Flush the newest conflated values after all sent data
+        for (auto& value : _conflation_values)
+            _send_buffer_main.insert(_send_buffer_main.end(), value.second.begin(), value.second.end());
+        _conflation_index.clear();
+        _conflation_values.clear();
+        _conflation_size = 0;
+
         // Swap flush and main buffers
         _send_buffer_flush.swap(_send_buffer_main);
         _send_buffer_flush_offset = 0;
@@ -556,6 +744,9 @@ void TCPSession::ClearBuffers()
         _send_buffer_main.clear();
         _send_buffer_flush.clear();
         _send_buffer_flush_offset = 0;
+        _conflation_index.clear();
+        _conflation_values.clear();
+        _conflation_size = 0;
 
         // Update statistic
         _bytes_pending = 0;
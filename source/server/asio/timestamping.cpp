@@ -0,0 +1,259 @@
+/*!
+    \file timestamping.cpp
+    \brief Packet timestamping implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/timestamping.h"
+
+#include "time/timestamp.h"
+
+#include <cstring>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#if !defined(SO_TIMESTAMPING)
+#define SO_TIMESTAMPING 37
+#endif
+#if !defined(SCM_TIMESTAMPING)
+#define SCM_TIMESTAMPING SO_TIMESTAMPING
+#endif
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+#if defined(__linux__)
+
+// Kernel timestamps structure of SCM_TIMESTAMPING control message
+struct KernelTimestamps
+{
+    timespec ts[3];
+};
+
+static inline uint64_t Nanoseconds(const timespec& ts)
+{
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+// Parse SCM_TIMESTAMPING control message: software timestamp is in ts[0], raw hardware timestamp is in ts[2]
+static void ParseTimestamp(msghdr& message, PacketTimestamp& timestamp)
+{
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header))
+    {
+        if ((header->cmsg_level == SOL_SOCKET) && (header->cmsg_type == SCM_TIMESTAMPING))
+        {
+            KernelTimestamps timestamps;
+            std::memcpy(&timestamps, CMSG_DATA(header), sizeof(timestamps));
+            timestamp.software = Nanoseconds(timestamps.ts[0]);
+            timestamp.hardware = Nanoseconds(timestamps.ts[2]);
+            break;
+        }
+    }
+}
+
+static bool EnableTimestamping(int handle, bool receive, bool transmit, asio::error_code& ec)
+{
+    int flags = SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+    if (receive)
+        flags |= SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_RX_HARDWARE;
+    if (transmit)
+        flags |= SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_TX_HARDWARE | SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+
+    if (::setsockopt(handle, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) != 0)
+    {
+        if ((errno != ENOPROTOOPT) && (errno != EINVAL) && (errno != EOPNOTSUPP))
+            ec = std::error_code(errno, std::system_category());
+        return false;
+    }
+    return true;
+}
+
+// Receive the message with its timestamp, returns -1 if the socket has no pending data or on error
+static ssize_t ReceiveMessage(int handle, void* name, socklen_t& namelen, void* buffer, size_t size, PacketTimestamp& timestamp, asio::error_code& ec)
+{
+    iovec vector;
+    vector.iov_base = buffer;
+    vector.iov_len = size;
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(KernelTimestamps)) + CMSG_SPACE(sizeof(int))];
+
+    msghdr message;
+    std::memset(&message, 0, sizeof(message));
+    message.msg_name = name;
+    message.msg_namelen = namelen;
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    ssize_t result = ::recvmsg(handle, &message, MSG_DONTWAIT);
+    if (result < 0)
+    {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            ec = std::error_code(errno, std::system_category());
+        return -1;
+    }
+    namelen = message.msg_namelen;
+
+    ParseTimestamp(message, timestamp);
+
+    return result;
+}
+
+#endif
+
+//! @endcond
+
+bool Timestamping::IsSupported() noexcept
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool Timestamping::Enable(asio::ip::udp::socket& socket, bool receive, bool transmit, asio::error_code& ec)
+{
+    ec.clear();
+
+#if defined(__linux__)
+    return EnableTimestamping(socket.native_handle(), receive, transmit, ec);
+#else
+    return false;
+#endif
+}
+
+bool Timestamping::Enable(asio::ip::tcp::socket& socket, bool receive, bool transmit, asio::error_code& ec)
+{
+    ec.clear();
+
+#if defined(__linux__)
+    return EnableTimestamping(socket.native_handle(), receive, transmit, ec);
+#else
+    return false;
+#endif
+}
+
+size_t Timestamping::Receive(asio::ip::udp::socket& socket, asio::ip::udp::endpoint& endpoint, void* buffer, size_t size, PacketTimestamp& timestamp, asio::error_code& ec)
+{
+    ec.clear();
+    timestamp = PacketTimestamp();
+
+#if defined(__linux__)
+    socklen_t namelen = (socklen_t)endpoint.capacity();
+    ssize_t received = ReceiveMessage(socket.native_handle(), endpoint.data(), namelen, buffer, size, timestamp, ec);
+    if (received <= 0)
+        return 0;
+    endpoint.resize(namelen);
+    return (size_t)received;
+#else
+    bool non_blocking = socket.non_blocking();
+    socket.non_blocking(true, ec);
+    if (ec)
+        return 0;
+
+    size_t received = socket.receive_from(asio::buffer(buffer, size), endpoint, 0, ec);
+    if (ec == asio::error::would_block)
+        ec.clear();
+
+    // Fall back to the user space receive time
+    timestamp.software = CppCommon::UtcTimestamp().total();
+
+    asio::error_code ignored;
+    socket.non_blocking(non_blocking, ignored);
+
+    return received;
+#endif
+}
+
+size_t Timestamping::Receive(asio::ip::tcp::socket& socket, void* buffer, size_t size, PacketTimestamp& timestamp, asio::error_code& ec)
+{
+    ec.clear();
+    timestamp = PacketTimestamp();
+
+#if defined(__linux__)
+    socklen_t namelen = 0;
+    ssize_t received = ReceiveMessage(socket.native_handle(), nullptr, namelen, buffer, size, timestamp, ec);
+    if (received < 0)
+        return 0;
+    // Empty read from the stream socket means the peer closed the connection
+    if ((received == 0) && (size > 0))
+        ec = asio::error::eof;
+    return (size_t)received;
+#else
+    bool non_blocking = socket.non_blocking();
+    socket.non_blocking(true, ec);
+    if (ec)
+        return 0;
+
+    size_t received = socket.read_some(asio::buffer(buffer, size), ec);
+    if (ec == asio::error::would_block)
+        ec.clear();
+
+    // Fall back to the user space receive time
+    timestamp.software = CppCommon::UtcTimestamp().total();
+
+    asio::error_code ignored;
+    socket.non_blocking(non_blocking, ignored);
+
+    return received;
+#endif
+}
+
+bool Timestamping::ReceiveTransmit(asio::detail::socket_type handle, uint32_t& id, PacketTimestamp& timestamp, asio::error_code& ec)
+{
+    ec.clear();
+    timestamp = PacketTimestamp();
+
+#if defined(__linux__)
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(KernelTimestamps)) + CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in6))];
+
+    msghdr message;
+    std::memset(&message, 0, sizeof(message));
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    if (::recvmsg(handle, &message, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+        return false;
+
+    // Find the timestamp Id in the extended error of the timestamping origin
+    int error = 0;
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header))
+    {
+        if (((header->cmsg_level == SOL_IP) && (header->cmsg_type == IP_RECVERR)) ||
+            ((header->cmsg_level == SOL_IPV6) && (header->cmsg_type == IPV6_RECVERR)))
+        {
+            sock_extended_err extended;
+            std::memcpy(&extended, CMSG_DATA(header), sizeof(extended));
+            if ((extended.ee_errno == ENOMSG) && (extended.ee_origin == SO_EE_ORIGIN_TIMESTAMPING))
+            {
+                id = extended.ee_data;
+                ParseTimestamp(message, timestamp);
+                return true;
+            }
+            error = (int)extended.ee_errno;
+        }
+    }
+
+    // Report other errors of the error queue (ICMP, local errors)
+    if (error != 0)
+        ec = std::error_code(error, std::system_category());
+    return false;
+#else
+    return false;
+#endif
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -0,0 +1,165 @@
+/*!
+    \file udp_batch.cpp
+    \brief UDP batch I/O implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/udp_batch.h"
+
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/socket.h>
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+#if defined(__linux__)
+
+//! @cond INTERNALS
+
+// Message headers reused by all batches of the current thread
+static thread_local std::vector<mmsghdr> batch_headers;
+static thread_local std::vector<iovec> batch_vectors;
+
+static void PrepareBatch(size_t count)
+{
+    if (batch_headers.size() < count)
+    {
+        batch_headers.resize(count);
+        batch_vectors.resize(count);
+    }
+    std::memset(batch_headers.data(), 0, count * sizeof(mmsghdr));
+}
+
+//! @endcond
+
+size_t UDPBatch::Receive(asio::ip::udp::socket& socket, uint8_t* buffer, size_t size, UDPDatagram* datagrams, size_t count, asio::error_code& ec)
+{
+    ec.clear();
+
+    if (count == 0)
+        return 0;
+
+    PrepareBatch(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        batch_vectors[i].iov_base = buffer + i * size;
+        batch_vectors[i].iov_len = size;
+        batch_headers[i].msg_hdr.msg_name = datagrams[i].endpoint.data();
+        batch_headers[i].msg_hdr.msg_namelen = (socklen_t)datagrams[i].endpoint.capacity();
+        batch_headers[i].msg_hdr.msg_iov = &batch_vectors[i];
+        batch_headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int result = ::recvmmsg(socket.native_handle(), batch_headers.data(), (unsigned)count, MSG_DONTWAIT, nullptr);
+    if (result < 0)
+    {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            ec = std::error_code(errno, std::system_category());
+        return 0;
+    }
+
+    for (size_t i = 0; i < (size_t)result; ++i)
+    {
+        datagrams[i].endpoint.resize(batch_headers[i].msg_hdr.msg_namelen);
+        datagrams[i].buffer = buffer + i * size;
+        datagrams[i].size = batch_headers[i].msg_len;
+    }
+
+    return (size_t)result;
+}
+
+size_t UDPBatch::Send(asio::ip::udp::socket& socket, const UDPDatagram* datagrams, size_t count, asio::error_code& ec)
+{
+    ec.clear();
+
+    if (count == 0)
+        return 0;
+
+    PrepareBatch(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        batch_vectors[i].iov_base = const_cast<void*>(datagrams[i].buffer);
+        batch_vectors[i].iov_len = datagrams[i].size;
+        batch_headers[i].msg_hdr.msg_name = const_cast<asio::ip::udp::endpoint::data_type*>(datagrams[i].endpoint.data());
+        batch_headers[i].msg_hdr.msg_namelen = (socklen_t)datagrams[i].endpoint.size();
+        batch_headers[i].msg_hdr.msg_iov = &batch_vectors[i];
+        batch_headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int result = ::sendmmsg(socket.native_handle(), batch_headers.data(), (unsigned)count, MSG_DONTWAIT);
+    if (result < 0)
+    {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            ec = std::error_code(errno, std::system_category());
+        return 0;
+    }
+
+    return (size_t)result;
+}
+
+#else
+
+size_t UDPBatch::Receive(asio::ip::udp::socket& socket, uint8_t* buffer, size_t size, UDPDatagram* datagrams, size_t count, asio::error_code& ec)
+{
+    ec.clear();
+
+    bool non_blocking = socket.non_blocking();
+    socket.non_blocking(true, ec);
+    if (ec)
+        return 0;
+
+    size_t received = 0;
+    for (; received < count; ++received)
+    {
+        uint8_t* slot = buffer + received * size;
+        size_t result = socket.receive_from(asio::buffer(slot, size), datagrams[received].endpoint, 0, ec);
+        if (ec)
+            break;
+        datagrams[received].buffer = slot;
+        datagrams[received].size = result;
+    }
+    if (ec == asio::error::would_block)
+        ec.clear();
+
+    asio::error_code ignored;
+    socket.non_blocking(non_blocking, ignored);
+
+    return received;
+}
+
+size_t UDPBatch::Send(asio::ip::udp::socket& socket, const UDPDatagram* datagrams, size_t count, asio::error_code& ec)
+{
+    ec.clear();
+
+    bool non_blocking = socket.non_blocking();
+    socket.non_blocking(true, ec);
+    if (ec)
+        return 0;
+
+    size_t sent = 0;
+    for (; sent < count; ++sent)
+    {
+        socket.send_to(asio::const_buffer(datagrams[sent].buffer, datagrams[sent].size), datagrams[sent].endpoint, 0, ec);
+        if (ec)
+            break;
+    }
+    if (ec == asio::error::would_block)
+        ec.clear();
+
+    asio::error_code ignored;
+    socket.non_blocking(non_blocking, ignored);
+
+    return sent;
+}
+
+#endif
+
+} // namespace Asio
+} // namespace CppServer
@@ -8,6 +8,8 @@
 
 #include "server/asio/udp_client.h"
 
+#include <cstring>
+
 namespace CppServer {
 namespace Asio {
 
@@ -29,8 +31,17 @@ UDPClient::UDPClient(std::shared_ptr<Service> service, const std::string& addres
       _datagrams_received(0),
       _receiving(false),
       _sending(false),
+      _send_batch_offset(0),
+      _send_segment_size(0),
+      _send_segment_offset(0),
+      _send_segment_offload(true),
       _option_reuse_address(false),
       _option_reuse_port(false),
+      _option_receive_batch(0),
+      _option_receive_batch_size(2048),
+      _option_receive_offload(false),
+      _option_receive_timestamps(false),
+      _option_transmit_timestamps(false),
       _option_multicast(false)
 {
     assert((service != nullptr) && "Asio service is invalid!");
@@ -57,8 +68,17 @@ UDPClient::UDPClient(std::shared_ptr<Service> service, const std::string& addres
       _datagrams_received(0),
       _receiving(false),
       _sending(false),
+      _send_batch_offset(0),
+      _send_segment_size(0),
+      _send_segment_offset(0),
+      _send_segment_offload(true),
       _option_reuse_address(false),
       _option_reuse_port(false),
+      _option_receive_batch(0),
+      _option_receive_batch_size(2048),
+      _option_receive_offload(false),
+      _option_receive_timestamps(false),
+      _option_transmit_timestamps(false),
       _option_multicast(false)
 {
     assert((service != nullptr) && "Asio service is invalid!");
@@ -85,8 +105,17 @@ UDPClient::UDPClient(std::shared_ptr<Service> service, const asio::ip::udp::endp
       _datagrams_received(0),
       _receiving(false),
       _sending(false),
+      _send_batch_offset(0),
+      _send_segment_size(0),
+      _send_segment_offset(0),
+      _send_segment_offload(true),
       _option_reuse_address(false),
       _option_reuse_port(false),
+      _option_receive_batch(0),
+      _option_receive_batch_size(2048),
+      _option_receive_offload(false),
+      _option_receive_timestamps(false),
+      _option_transmit_timestamps(false),
       _option_multicast(false)
 {
     assert((service != nullptr) && "Asio service is invalid!");
@@ -153,6 +182,25 @@ bool UDPClient::Connect()
 
     // Prepare receive buffer
     _receive_buffer.resize(option_receive_buffer_size());
+    if (option_receive_offload())
+    {
+        asio::error_code ec;
+        if (!UDPOffload::EnableReceiveOffload(_socket, ec) && ec)
+            SendError(ec);
+        if (_receive_buffer.size() <= UDPOffload::MAX_SIZE)
+            _receive_buffer.resize(UDPOffload::MAX_SIZE + 1);
+    }
+    if (option_receive_timestamps() || option_transmit_timestamps())
+    {
+        asio::error_code ec;
+        if (!Timestamping::Enable(_socket, option_receive_timestamps(), option_transmit_timestamps(), ec) && ec)
+            SendError(ec);
+    }
+    if (option_receive_batch() > 1)
+    {
+        _receive_batch_buffer.resize(option_receive_batch() * option_receive_batch_size());
+        _receive_batch.resize(option_receive_batch());
+    }
 
     // Reset statistic
     _bytes_sending = 0;
@@ -167,6 +215,10 @@ bool UDPClient::Connect()
     // Call the client connected handler
     onConnected();
 
+    // Start receiving transmit timestamps
+    if (option_transmit_timestamps() && Timestamping::IsSupported())
+        TryReceiveTransmitTimestamps();
+
     return true;
 }
 
@@ -221,6 +273,25 @@ bool UDPClient::Connect(std::shared_ptr<UDPResolver> resolver)
 
     // Prepare receive buffer
     _receive_buffer.resize(option_receive_buffer_size());
+    if (option_receive_offload())
+    {
+        asio::error_code ec;
+        if (!UDPOffload::EnableReceiveOffload(_socket, ec) && ec)
+            SendError(ec);
+        if (_receive_buffer.size() <= UDPOffload::MAX_SIZE)
+            _receive_buffer.resize(UDPOffload::MAX_SIZE + 1);
+    }
+    if (option_receive_timestamps() || option_transmit_timestamps())
+    {
+        asio::error_code ec;
+        if (!Timestamping::Enable(_socket, option_receive_timestamps(), option_transmit_timestamps(), ec) && ec)
+            SendError(ec);
+    }
+    if (option_receive_batch() > 1)
+    {
+        _receive_batch_buffer.resize(option_receive_batch() * option_receive_batch_size());
+        _receive_batch.resize(option_receive_batch());
+    }
 
     // Reset statistic
     _bytes_sending = 0;
@@ -235,6 +306,10 @@ bool UDPClient::Connect(std::shared_ptr<UDPResolver> resolver)
     // Call the client connected handler
     onConnected();
 
+    // Start receiving transmit timestamps
+    if (option_transmit_timestamps() && Timestamping::IsSupported())
+        TryReceiveTransmitTimestamps();
+
     return true;
 }
 
@@ -335,6 +410,25 @@ bool UDPClient::ConnectAsync(std::shared_ptr<UDPResolver> resolver)
 
                 // Prepare receive buffer
                 _receive_buffer.resize(option_receive_buffer_size());
+                if (option_receive_offload())
+                {
+                    asio::error_code ec;
+                    if (!UDPOffload::EnableReceiveOffload(_socket, ec) && ec)
+                        SendError(ec);
+                    if (_receive_buffer.size() <= UDPOffload::MAX_SIZE)
+                        _receive_buffer.resize(UDPOffload::MAX_SIZE + 1);
+                }
+                if (option_receive_timestamps() || option_transmit_timestamps())
+                {
+                    asio::error_code ec;
+                    if (!Timestamping::Enable(_socket, option_receive_timestamps(), option_transmit_timestamps(), ec) && ec)
+                        SendError(ec);
+                }
+                if (option_receive_batch() > 1)
+                {
+                    _receive_batch_buffer.resize(option_receive_batch() * option_receive_batch_size());
+                    _receive_batch.resize(option_receive_batch());
+                }
 
                 // Reset statistic
                 _bytes_sending = 0;
@@ -348,6 +442,10 @@ bool UDPClient::ConnectAsync(std::shared_ptr<UDPResolver> resolver)
 
                 // Call the client connected handler
                 onConnected();
+
+                // Start receiving transmit timestamps
+                if (option_transmit_timestamps() && Timestamping::IsSupported())
+                    TryReceiveTransmitTimestamps();
             }
             else
             {
@@ -771,6 +869,30 @@ void UDPClient::ReceiveAsync()
 
 void UDPClient::TryReceive()
 {
+    if (option_receive_ring())
+    {
+        TryReceiveRing();
+        return;
+    }
+
+    if (option_receive_offload())
+    {
+        TryReceiveSegments();
+        return;
+    }
+
+    if (option_receive_batch() > 1)
+    {
+        TryReceiveBatch();
+        return;
+    }
+
+    if (option_receive_timestamps())
+    {
+        TryReceiveTimestamped();
+        return;
+    }
+
     if (_receiving)
         return;
 
@@ -816,10 +938,489 @@ void UDPClient::TryReceive()
         _socket.async_receive_from(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), _receive_endpoint, async_receive_handler);
 }
 
+void UDPClient::TryReceiveBatch()
+{
+    if (_receiving)
+        return;
+
+    if (!IsConnected())
+        return;
+
+    // Async wait for readable socket with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec)
+    {
+        _receiving = false;
+
+        if (!IsConnected())
+            return;
+
+        // Receive the batch of datagrams
+        size_t count = 0;
+        if (!ec)
+            count = UDPBatch::Receive(_socket, _receive_batch_buffer.data(), option_receive_batch_size(), _receive_batch.data(), _receive_batch.size(), ec);
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            DisconnectAsync(true);
+            return;
+        }
+
+        // Received some datagrams from the server
+        if (count > 0)
+        {
+            // Update statistic
+            _datagrams_received += count;
+            for (size_t i = 0; i < count; ++i)
+                _bytes_received += _receive_batch[i].size;
+
+            // Call the datagrams batch received handler
+            onReceivedBatch(_receive_batch.data(), count);
+        }
+        else
+        {
+            // Spurious wakeup, wait for readable socket again
+            TryReceiveBatch();
+        }
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_read, async_wait_handler);
+}
+
+bool UDPClient::SendBatchAsync(const UDPDatagram* datagrams, size_t count)
+{
+    assert((datagrams != nullptr) && "Pointer to the datagrams should not be null!");
+    if (datagrams == nullptr)
+        return false;
+
+    if (_sending)
+        return false;
+
+    if (!IsConnected())
+        return false;
+
+    if (count == 0)
+        return true;
+
+    // Fill the send batch buffer
+    size_t size = 0;
+    for (size_t i = 0; i < count; ++i)
+        size += datagrams[i].size;
+    _send_batch_buffer.resize(size);
+    _send_batch.resize(count);
+    size_t offset = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (datagrams[i].size > 0)
+            std::memcpy(_send_batch_buffer.data() + offset, datagrams[i].buffer, datagrams[i].size);
+        _send_batch[i] = UDPDatagram(datagrams[i].endpoint, _send_batch_buffer.data() + offset, datagrams[i].size);
+        offset += datagrams[i].size;
+    }
+    _send_batch_offset = 0;
+
+    // Update statistic
+    _bytes_sending = size;
+
+    // Send the batch of datagrams
+    _sending = true;
+    TrySendBatch();
+
+    return true;
+}
+
+void UDPClient::TrySendBatch()
+{
+    // Async wait for writable socket with the send handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_send_storage, [this, self](std::error_code ec)
+    {
+        if (!IsConnected())
+        {
+            _sending = false;
+            return;
+        }
+
+        // Send the rest of the batch
+        size_t first = _send_batch_offset;
+        size_t sent = 0;
+        if (!ec)
+            sent = UDPBatch::Send(_socket, _send_batch.data() + first, _send_batch.size() - first, ec);
+        _send_batch_offset += sent;
+
+        // Disconnect on error
+        if (ec)
+        {
+            _sending = false;
+            SendError(ec);
+            DisconnectAsync(true);
+            return;
+        }
+
+        bool completed = (_send_batch_offset == _send_batch.size());
+
+        // Send some datagrams to the server
+        for (size_t i = first; i < first + sent; ++i)
+        {
+            // Copy the datagram, because the batch might be replaced from the handler
+            asio::ip::udp::endpoint endpoint = _send_batch[i].endpoint;
+            size_t size = _send_batch[i].size;
+
+            // Update statistic
+            ++_datagrams_sent;
+            _bytes_sending -= size;
+            _bytes_sent += size;
+
+            // Allow the next send before the last datagram sent handler
+            if (completed && (i + 1 == first + sent))
+            {
+                _send_batch.clear();
+                _send_batch_offset = 0;
+                _sending = false;
+            }
+
+            // Call the datagram sent handler
+            onSent(endpoint, size);
+        }
+
+        // Wait for writable socket to send the rest of the batch
+        if (!completed)
+            TrySendBatch();
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_write, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_write, async_wait_handler);
+}
+
+void UDPClient::TryReceiveSegments()
+{
+    if (_receiving)
+        return;
+
+    if (!IsConnected())
+        return;
+
+    // Async wait for readable socket with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec)
+    {
+        _receiving = false;
+
+        if (!IsConnected())
+            return;
+
+        // Receive the buffer of coalesced datagrams
+        size_t size = 0;
+        size_t segment_size = 0;
+        if (!ec)
+            size = UDPOffload::Receive(_socket, _receive_endpoint, _receive_buffer.data(), _receive_buffer.size(), segment_size, ec);
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            DisconnectAsync(true);
+            return;
+        }
+
+        // Received some datagrams from the server
+        if (size > 0)
+        {
+            // Update statistic
+            _datagrams_received += (size + segment_size - 1) / segment_size;
+            _bytes_received += size;
+
+            // Call the segmented datagrams received handler
+            onReceivedSegments(_receive_endpoint, _receive_buffer.data(), size, segment_size);
+        }
+        else
+        {
+            // Spurious wakeup, wait for readable socket again
+            TryReceiveSegments();
+        }
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_read, async_wait_handler);
+}
+
+void UDPClient::TryReceiveTimestamped()
+{
+    if (_receiving)
+        return;
+
+    if (!IsConnected())
+        return;
+
+    // Async wait for readable socket with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec)
+    {
+        _receiving = false;
+
+        if (!IsConnected())
+            return;
+
+        // Receive the datagram with its receive timestamp
+        size_t size = 0;
+        PacketTimestamp timestamp;
+        if (!ec)
+            size = Timestamping::Receive(_socket, _receive_endpoint, _receive_buffer.data(), _receive_buffer.size(), timestamp, ec);
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            DisconnectAsync(true);
+            return;
+        }
+
+        // Received some data from the server
+        if (size > 0)
+        {
+            // Update statistic
+            ++_datagrams_received;
+            _bytes_received += size;
+
+            // Call the timestamped datagram received handler
+            onReceivedTimestamped(_receive_endpoint, _receive_buffer.data(), size, timestamp);
+
+            // If the receive buffer is full increase its size
+            if (_receive_buffer.size() == size)
+                _receive_buffer.resize(2 * size);
+        }
+        else
+        {
+            // Spurious wakeup, wait for readable socket again
+            TryReceiveTimestamped();
+        }
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_read, async_wait_handler);
+}
+
+void UDPClient::TryReceiveRing()
+{
+    if (_receiving)
+        return;
+
+    if (!IsConnected())
+        return;
+
+    // Async wait for readable socket with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec)
+    {
+        _receiving = false;
+
+        if (!IsConnected())
+            return;
+
+        auto ring = option_receive_ring();
+        bool non_blocking = _socket.non_blocking();
+        if (!ec)
+            _socket.non_blocking(true, ec);
+
+        // Receive available datagrams directly into the ring slots
+        for (size_t i = 0; !ec && (i < ring->capacity()); ++i)
+        {
+            void* slot = ring->Claim();
+            void* buffer = (slot != nullptr) ? slot : _receive_buffer.data();
+            size_t size = (slot != nullptr) ? ring->datagram_size() : _receive_buffer.size();
+
+            size_t received = _socket.receive_from(asio::buffer(buffer, size), _receive_endpoint, 0, ec);
+            if (ec)
+                break;
+
+            // Update statistic
+            ++_datagrams_received;
+            _bytes_received += received;
+
+            // Publish the datagram or drop it if the ring is full
+            if (slot != nullptr)
+                ring->Publish(_receive_endpoint, received);
+            else
+                ring->Drop();
+        }
+        if (ec == asio::error::would_block)
+            ec.clear();
+
+        asio::error_code ignored;
+        _socket.non_blocking(non_blocking, ignored);
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            DisconnectAsync(true);
+            return;
+        }
+
+        // Wait for readable socket again
+        TryReceiveRing();
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_read, async_wait_handler);
+}
+
+void UDPClient::TryReceiveTransmitTimestamps()
+{
+    if (!IsConnected())
+        return;
+
+    // Async wait for the socket error queue with the transmit timestamps handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const std::error_code& ec)
+    {
+        if (ec || !IsConnected())
+            return;
+
+        // Call the transmit timestamp handler for each pending timestamp
+        // and the error handler for other entries of the error queue
+        uint32_t id = 0;
+        PacketTimestamp timestamp;
+        asio::error_code error;
+        for (;;)
+        {
+            if (Timestamping::ReceiveTransmit(_socket.native_handle(), id, timestamp, error))
+                onSentTimestamp(id, timestamp);
+            else if (error)
+                SendError(error);
+            else
+                break;
+        }
+
+        // Wait for new transmit timestamps
+        TryReceiveTransmitTimestamps();
+    };
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_error, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_error, async_wait_handler);
+}
+
+bool UDPClient::SendSegmentedAsync(const void* buffer, size_t size, size_t segment_size)
+{
+    // Send the segmented buffer to the server endpoint
+    return SendSegmentedAsync(_endpoint, buffer, size, segment_size);
+}
+
+bool UDPClient::SendSegmentedAsync(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+    assert((segment_size > 0) && "Segment size should be greater than zero!");
+    if (segment_size == 0)
+        return false;
+    assert((segment_size <= UDPOffload::MAX_PAYLOAD) && "Segment size should not exceed the maximal datagram payload!");
+    if (segment_size > UDPOffload::MAX_PAYLOAD)
+        return false;
+
+    if (_sending)
+        return false;
+
+    if (!IsConnected())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    // Fill the main send buffer
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _send_buffer.assign(bytes, bytes + size);
+    _send_segment_size = segment_size;
+    _send_segment_offset = 0;
+
+    // Update statistic
+    _bytes_sending = _send_buffer.size();
+
+    // Update send endpoint
+    _send_endpoint = endpoint;
+
+    // Send the segmented buffer
+    _sending = true;
+    TrySendSegments();
+
+    return true;
+}
+
+void UDPClient::TrySendSegments()
+{
+    // Async wait for writable socket with the send handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_send_storage, [this, self](std::error_code ec)
+    {
+        if (!IsConnected())
+        {
+            _sending = false;
+            return;
+        }
+
+        // Send the rest of the segmented buffer
+        size_t sent = 0;
+        if (!ec)
+            sent = UDPOffload::Send(_socket, _send_endpoint, _send_buffer.data() + _send_segment_offset, _send_buffer.size() - _send_segment_offset, _send_segment_size, _send_segment_offload, ec);
+        _send_segment_offset += sent;
+
+        // Disconnect on error
+        if (ec)
+        {
+            _sending = false;
+            SendError(ec);
+            DisconnectAsync(true);
+            return;
+        }
+
+        // Update statistic
+        _datagrams_sent += (sent + _send_segment_size - 1) / _send_segment_size;
+        _bytes_sending -= sent;
+        _bytes_sent += sent;
+
+        // Wait for writable socket to send the rest of the buffer
+        if (_send_segment_offset < _send_buffer.size())
+        {
+            TrySendSegments();
+            return;
+        }
+
+        size_t size = _send_buffer.size();
+
+        // Clear the send buffer
+        _send_buffer.clear();
+        _send_segment_offset = 0;
+        _sending = false;
+
+        // Call the buffer sent handler
+        onSent(_send_endpoint, size);
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_write, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_write, async_wait_handler);
+}
+
 void UDPClient::ClearBuffers()
 {
     // Clear send buffers
     _send_buffer.clear();
+    _send_batch.clear();
+    _send_batch_offset = 0;
+    _send_segment_offset = 0;
+    _send_segment_offload = true;
 
     // Update statistic
     _bytes_sending = 0;
@@ -0,0 +1,234 @@
+/*!
+    \file udp_offload.cpp
+    \brief UDP segmentation offload implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/udp_offload.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <sys/socket.h>
+#if !defined(SOL_UDP)
+#define SOL_UDP 17
+#endif
+#if !defined(UDP_SEGMENT)
+#define UDP_SEGMENT 103
+#endif
+#if !defined(UDP_GRO)
+#define UDP_GRO 104
+#endif
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+// Send segments with the loop of non-blocking send_to() calls
+static size_t SendLoop(asio::ip::udp::socket& socket, const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size, asio::error_code& ec)
+{
+    bool non_blocking = socket.non_blocking();
+    socket.non_blocking(true, ec);
+    if (ec)
+        return 0;
+
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    size_t sent = 0;
+    while (sent < size)
+    {
+        size_t segment = std::min(segment_size, size - sent);
+        socket.send_to(asio::const_buffer(bytes + sent, segment), endpoint, 0, ec);
+        if (ec)
+            break;
+        sent += segment;
+    }
+    if (ec == asio::error::would_block)
+        ec.clear();
+
+    asio::error_code ignored;
+    socket.non_blocking(non_blocking, ignored);
+
+    return sent;
+}
+
+#if !defined(__linux__)
+// Receive a single datagram with the non-blocking receive_from() call
+static size_t ReceiveSingle(asio::ip::udp::socket& socket, asio::ip::udp::endpoint& endpoint, void* buffer, size_t size, size_t& segment_size, asio::error_code& ec)
+{
+    bool non_blocking = socket.non_blocking();
+    socket.non_blocking(true, ec);
+    if (ec)
+        return 0;
+
+    size_t received = socket.receive_from(asio::buffer(buffer, size), endpoint, 0, ec);
+    if (ec == asio::error::would_block)
+        ec.clear();
+    segment_size = received;
+
+    asio::error_code ignored;
+    socket.non_blocking(non_blocking, ignored);
+
+    return received;
+}
+#endif
+
+//! @endcond
+
+bool UDPOffload::IsSupported() noexcept
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool UDPOffload::EnableReceiveOffload(asio::ip::udp::socket& socket, asio::error_code& ec)
+{
+    ec.clear();
+
+#if defined(__linux__)
+    int enable = 1;
+    if (::setsockopt(socket.native_handle(), SOL_UDP, UDP_GRO, &enable, sizeof(enable)) != 0)
+    {
+        if ((errno != ENOPROTOOPT) && (errno != EINVAL))
+            ec = std::error_code(errno, std::system_category());
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t UDPOffload::Send(asio::ip::udp::socket& socket, const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size, bool& offload, asio::error_code& ec)
+{
+    ec.clear();
+
+    if (size == 0)
+        return 0;
+
+    if ((segment_size == 0) || (segment_size > size))
+        segment_size = size;
+
+#if defined(__linux__)
+    // Split the buffer into system calls within the kernel limits
+    size_t chunk_size = std::min(MAX_SEGMENTS, MAX_PAYLOAD / segment_size) * segment_size;
+
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    size_t sent = 0;
+    while (offload && (chunk_size > segment_size) && (sent < size) && (segment_size < (size - sent)))
+    {
+        size_t chunk = std::min(chunk_size, size - sent);
+
+        iovec vector;
+        vector.iov_base = const_cast<uint8_t*>(bytes + sent);
+        vector.iov_len = chunk;
+
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(uint16_t))];
+        std::memset(control, 0, sizeof(control));
+
+        msghdr message;
+        std::memset(&message, 0, sizeof(message));
+        message.msg_name = const_cast<asio::ip::udp::endpoint::data_type*>(endpoint.data());
+        message.msg_namelen = (socklen_t)endpoint.size();
+        message.msg_iov = &vector;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+
+        cmsghdr* header = CMSG_FIRSTHDR(&message);
+        header->cmsg_level = SOL_UDP;
+        header->cmsg_type = UDP_SEGMENT;
+        header->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        uint16_t segment = (uint16_t)segment_size;
+        std::memcpy(CMSG_DATA(header), &segment, sizeof(segment));
+
+        ssize_t result = ::sendmsg(socket.native_handle(), &message, MSG_DONTWAIT);
+        if (result >= 0)
+        {
+            sent += (size_t)result;
+            continue;
+        }
+
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            return sent;
+
+        // Kernel, route or network device without segmentation offload support
+        if ((errno != EINVAL) && (errno != ENOPROTOOPT) && (errno != EOPNOTSUPP) && (errno != EIO))
+        {
+            ec = std::error_code(errno, std::system_category());
+            return sent;
+        }
+        offload = false;
+    }
+
+    // Send the rest of segments one by one
+    if (sent < size)
+        sent += SendLoop(socket, endpoint, bytes + sent, size - sent, segment_size, ec);
+    return sent;
+#else
+    return SendLoop(socket, endpoint, buffer, size, segment_size, ec);
+#endif
+}
+
+size_t UDPOffload::Receive(asio::ip::udp::socket& socket, asio::ip::udp::endpoint& endpoint, void* buffer, size_t size, size_t& segment_size, asio::error_code& ec)
+{
+    ec.clear();
+    segment_size = 0;
+
+#if defined(__linux__)
+    iovec vector;
+    vector.iov_base = buffer;
+    vector.iov_len = size;
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+
+    msghdr message;
+    std::memset(&message, 0, sizeof(message));
+    message.msg_name = endpoint.data();
+    message.msg_namelen = (socklen_t)endpoint.capacity();
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    ssize_t result = ::recvmsg(socket.native_handle(), &message, MSG_DONTWAIT);
+    if (result < 0)
+    {
+        if ((errno != EAGAIN) && (errno != EWOULDBLOCK))
+            ec = std::error_code(errno, std::system_category());
+        return 0;
+    }
+    endpoint.resize(message.msg_namelen);
+
+    // Find the coalesced segment size, otherwise the buffer is a single datagram
+    segment_size = (size_t)result;
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr; header = CMSG_NXTHDR(&message, header))
+    {
+        if ((header->cmsg_level == SOL_UDP) && (header->cmsg_type == UDP_GRO))
+        {
+            int segment = 0;
+            std::memcpy(&segment, CMSG_DATA(header), sizeof(segment));
+            if ((segment > 0) && ((size_t)segment < segment_size))
+                segment_size = (size_t)segment;
+            break;
+        }
+    }
+
+    return (size_t)result;
+#else
+    return ReceiveSingle(socket, endpoint, buffer, size, segment_size, ec);
+#endif
+}
+
+} // namespace Asio
+} // namespace CppServer
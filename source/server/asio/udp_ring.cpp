@@ -0,0 +1,164 @@
+/*!
+    \file udp_ring.cpp
+    \brief UDP datagrams ring implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/udp_ring.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+// Consumer states
+static const int CONSUMER_FREE = 0;
+static const int CONSUMER_RESERVED = 1;
+static const int CONSUMER_ACTIVE = 2;
+
+//! @endcond
+
+size_t UDPRing::Consumer::available() const noexcept
+{
+    return (size_t)(_ring->_published.load(std::memory_order_acquire) - _sequence.load(std::memory_order_relaxed));
+}
+
+size_t UDPRing::Consumer::Acquire(const UDPDatagram*& datagrams, size_t limit) noexcept
+{
+    uint64_t sequence = _sequence.load(std::memory_order_relaxed);
+    uint64_t published = _ring->_published.load(std::memory_order_acquire);
+
+    // Acquire contiguous slots until the end of the ring
+    size_t index = (size_t)(sequence & _ring->_mask);
+    size_t count = std::min({ (size_t)(published - sequence), _ring->_capacity - index, limit });
+
+    datagrams = _ring->_slots.data() + index;
+    return count;
+}
+
+void UDPRing::Consumer::Release(size_t count) noexcept
+{
+    _sequence.store(_sequence.load(std::memory_order_relaxed) + count, std::memory_order_release);
+}
+
+UDPRing::UDPRing(size_t capacity, size_t datagram_size, size_t consumers)
+    : _capacity(1),
+      _mask(0),
+      _datagram_size(std::max(datagram_size, (size_t)1)),
+      _consumers(new Consumer[std::max(consumers, (size_t)1)]),
+      _consumers_count(std::max(consumers, (size_t)1)),
+      _published(0),
+      _gating(0),
+      _dropped(0)
+{
+    // Round up the capacity to the power of two
+    while (_capacity < capacity)
+        _capacity <<= 1;
+    _mask = _capacity - 1;
+
+    // Prepare datagrams slots
+    _buffer.resize(_capacity * _datagram_size);
+    _slots.resize(_capacity);
+    for (size_t i = 0; i < _capacity; ++i)
+        _slots[i].buffer = _buffer.data() + i * _datagram_size;
+
+    // Prepare consumers
+    for (size_t i = 0; i < _consumers_count; ++i)
+        _consumers[i]._ring = this;
+}
+
+UDPRing::Consumer* UDPRing::Subscribe() noexcept
+{
+    for (size_t i = 0; i < _consumers_count; ++i)
+    {
+        Consumer& consumer = _consumers[i];
+
+        int state = CONSUMER_FREE;
+        if (!consumer._state.compare_exchange_strong(state, CONSUMER_RESERVED, std::memory_order_acq_rel))
+            continue;
+
+        // Become visible to the producer with the conservative sequence
+        consumer._sequence.store(_published.load(std::memory_order_acquire), std::memory_order_relaxed);
+        consumer._state.store(CONSUMER_ACTIVE, std::memory_order_seq_cst);
+
+        // Start from the datagram published after the producer could see the consumer,
+        // so the producer cached gating sequence never covers the consumer slots
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        consumer._sequence.store(_published.load(std::memory_order_seq_cst), std::memory_order_release);
+        return &consumer;
+    }
+    return nullptr;
+}
+
+void UDPRing::Unsubscribe(Consumer* consumer) noexcept
+{
+    if ((consumer == nullptr) || (consumer->_ring != this))
+        return;
+
+    consumer->_state.store(CONSUMER_FREE, std::memory_order_release);
+}
+
+uint64_t UDPRing::MinSequence(uint64_t published) const noexcept
+{
+    // Order previous publications before reading consumer states (pairs with the fence in 'Subscribe()')
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    uint64_t result = published;
+    for (size_t i = 0; i < _consumers_count; ++i)
+    {
+        const Consumer& consumer = _consumers[i];
+        if (consumer._state.load(std::memory_order_acquire) == CONSUMER_ACTIVE)
+            result = std::min(result, consumer._sequence.load(std::memory_order_acquire));
+    }
+    return result;
+}
+
+void* UDPRing::Claim() noexcept
+{
+    uint64_t sequence = _published.load(std::memory_order_relaxed);
+
+    // Refresh the cached gating sequence only when the ring looks full
+    if ((sequence - _gating) >= _capacity)
+    {
+        _gating = MinSequence(sequence);
+        if ((sequence - _gating) >= _capacity)
+            return nullptr;
+    }
+
+    return const_cast<void*>(_slots[sequence & _mask].buffer);
+}
+
+void UDPRing::Publish(const asio::ip::udp::endpoint& endpoint, size_t size) noexcept
+{
+    uint64_t sequence = _published.load(std::memory_order_relaxed);
+
+    UDPDatagram& slot = _slots[sequence & _mask];
+    slot.endpoint = endpoint;
+    slot.size = std::min(size, _datagram_size);
+
+    // Make the datagram visible to consumers
+    _published.store(sequence + 1, std::memory_order_release);
+}
+
+bool UDPRing::Publish(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) noexcept
+{
+    void* slot = Claim();
+    if (slot == nullptr)
+    {
+        Drop();
+        return false;
+    }
+
+    size = std::min(size, _datagram_size);
+    std::memcpy(slot, buffer, size);
+    Publish(endpoint, size);
+    return true;
+}
+
+} // namespace Asio
+} // namespace CppServer
@@ -8,6 +8,11 @@
 
 #include "server/asio/udp_server.h"
 
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <cstring>
+
 namespace CppServer {
 namespace Asio {
 
@@ -25,10 +30,37 @@ UDPServer::UDPServer(std::shared_ptr<Service> service, int port, InternetProtoco
       _bytes_received(0),
       _datagrams_sent(0),
       _datagrams_received(0),
+      _datagrams_dropped(0),
+      _bytes_dropped(0),
       _receiving(false),
       _sending(false),
+      _send_batch_offset(0),
+      _send_queue_head(0),
+      _send_queue_count(0),
+      _pacing_transmit_time(false),
+      _pacing_timer(*_io_service),
+      _xdp_receiving(false),
+      _send_segment_size(0),
+      _send_segment_offset(0),
+      _send_segment_offload(true),
+      _sessions_count(0),
+      _sessions_timer(*_io_service),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_receive_batch(0),
+      _option_receive_batch_size(2048),
+      _option_receive_offload(false),
+      _option_receive_timestamps(false),
+      _option_transmit_timestamps(false),
+      _option_send_queue(0),
+      _option_send_queue_policy(DropPolicy::DropNewest),
+      _option_pacing_rate(0),
+      _option_pacing_unit(PacingUnit::Bytes),
+      _option_pacing_burst(0),
+      _option_transmit_time(false),
+      _option_xdp_queue(0),
+      _option_session_timeout(CppCommon::Timespan::seconds(60)),
+      _option_multiple_sockets(false)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -61,10 +93,37 @@ UDPServer::UDPServer(std::shared_ptr<Service> service, const std::string& addres
       _bytes_received(0),
       _datagrams_sent(0),
       _datagrams_received(0),
+      _datagrams_dropped(0),
+      _bytes_dropped(0),
       _receiving(false),
       _sending(false),
+      _send_batch_offset(0),
+      _send_queue_head(0),
+      _send_queue_count(0),
+      _pacing_transmit_time(false),
+      _pacing_timer(*_io_service),
+      _xdp_receiving(false),
+      _send_segment_size(0),
+      _send_segment_offset(0),
+      _send_segment_offload(true),
+      _sessions_count(0),
+      _sessions_timer(*_io_service),
       _option_reuse_address(false),
-      _option_reuse_port(false)
+      _option_reuse_port(false),
+      _option_receive_batch(0),
+      _option_receive_batch_size(2048),
+      _option_receive_offload(false),
+      _option_receive_timestamps(false),
+      _option_transmit_timestamps(false),
+      _option_send_queue(0),
+      _option_send_queue_policy(DropPolicy::DropNewest),
+      _option_pacing_rate(0),
+      _option_pacing_unit(PacingUnit::Bytes),
+      _option_pacing_burst(0),
+      _option_transmit_time(false),
+      _option_xdp_queue(0),
+      _option_session_timeout(CppCommon::Timespan::seconds(60)),
+      _option_multiple_sockets(false)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -90,8 +149,37 @@ UDPServer::UDPServer(std::shared_ptr<Service> service, const asio::ip::udp::endp
       _bytes_received(0),
       _datagrams_sent(0),
       _datagrams_received(0),
+      _datagrams_dropped(0),
+      _bytes_dropped(0),
       _receiving(false),
-      _sending(false)
+      _sending(false),
+      _send_batch_offset(0),
+      _send_queue_head(0),
+      _send_queue_count(0),
+      _pacing_transmit_time(false),
+      _pacing_timer(*_io_service),
+      _xdp_receiving(false),
+      _send_segment_size(0),
+      _send_segment_offset(0),
+      _send_segment_offload(true),
+      _sessions_count(0),
+      _sessions_timer(*_io_service),
+      _option_reuse_address(false),
+      _option_reuse_port(false),
+      _option_receive_batch(0),
+      _option_receive_batch_size(2048),
+      _option_receive_offload(false),
+      _option_receive_timestamps(false),
+      _option_transmit_timestamps(false),
+      _option_send_queue(0),
+      _option_send_queue_policy(DropPolicy::DropNewest),
+      _option_pacing_rate(0),
+      _option_pacing_unit(PacingUnit::Bytes),
+      _option_pacing_burst(0),
+      _option_transmit_time(false),
+      _option_xdp_queue(0),
+      _option_session_timeout(CppCommon::Timespan::seconds(60)),
+      _option_multiple_sockets(false)
 {
     assert((service != nullptr) && "Asio service is invalid!");
     if (service == nullptr)
@@ -124,12 +212,34 @@ void UDPServer::SetupSendBufferSize(size_t size)
     _socket.set_option(option);
 }
 
+void UDPServer::OpenSocket(asio::ip::udp::socket& socket)
+{
+    socket.open(_endpoint.protocol());
+    if (option_reuse_address())
+        socket.set_option(asio::ip::udp::socket::reuse_address(true));
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    if (option_reuse_port() || option_multiple_sockets())
+    {
+        typedef asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
+        socket.set_option(reuse_port(true));
+    }
+#endif
+    socket.bind(_endpoint);
+}
+
 bool UDPServer::Start()
 {
     assert(!IsStarted() && "UDP server is already started!");
     if (IsStarted())
         return false;
 
+    // Additional receive sockets support only the plain receive mode
+    if (option_multiple_sockets() && ((option_receive_batch() > 1) || option_receive_offload() || option_receive_timestamps() || !option_xdp_interface().empty()))
+    {
+        SendError(asio::error::invalid_argument);
+        return false;
+    }
+
     // Post the start handler
     auto self(this->shared_from_this());
     auto start_handler = [this, self]()
@@ -138,20 +248,77 @@ bool UDPServer::Start()
             return;
 
         // Open a server socket
-        _socket.open(_endpoint.protocol());
-        if (option_reuse_address())
-            _socket.set_option(asio::ip::udp::socket::reuse_address(true));
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        if (option_reuse_port())
+        OpenSocket(_socket);
+
+        // Prepare receive buffer
+        _receive_buffer.resize(option_receive_buffer_size());
+        if (option_receive_offload())
+        {
+            asio::error_code ec;
+            if (!UDPOffload::EnableReceiveOffload(_socket, ec) && ec)
+                SendError(ec);
+            if (_receive_buffer.size() <= UDPOffload::MAX_SIZE)
+                _receive_buffer.resize(UDPOffload::MAX_SIZE + 1);
+        }
+        if (option_receive_timestamps() || option_transmit_timestamps())
+        {
+            asio::error_code ec;
+            if (!Timestamping::Enable(_socket, option_receive_timestamps(), option_transmit_timestamps(), ec) && ec)
+                SendError(ec);
+        }
+        if (option_receive_batch() > 1)
         {
-            typedef asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
-            _socket.set_option(reuse_port(true));
+            _receive_batch_buffer.resize(option_receive_batch() * option_receive_batch_size());
+            _receive_batch.resize(option_receive_batch());
         }
+
+        // Open the AF_XDP transport or fall back to the socket
+        if (!option_xdp_interface().empty())
+        {
+            asio::error_code ec;
+            if (_xdp.Open(option_xdp_interface(), option_xdp_queue(), _socket.local_endpoint().port(), 4096, ec))
+            {
+#if defined(__linux__)
+                _xdp_descriptor = std::make_unique<asio::posix::stream_descriptor>(*_io_service, _xdp.native_handle());
 #endif
-        _socket.bind(_endpoint);
+                _xdp_batch.resize(std::max(option_receive_batch(), (size_t)64));
+            }
+            else if (ec)
+                SendError(ec);
+        }
 
-        // Prepare receive buffer
-        _receive_buffer.resize(option_receive_buffer_size());
+        // Prepare send pacer
+        _pacer.Setup(option_pacing_rate(), option_pacing_unit(), option_pacing_burst());
+        _pacing_transmit_time = false;
+        if (_pacer.enabled() && option_transmit_time())
+        {
+            asio::error_code ec;
+            _pacing_transmit_time = Pacer::EnableTransmitTime(_socket, ec);
+            if (ec)
+                SendError(ec);
+        }
+
+        // Create additional server receivers
+        _receivers.clear();
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        if (option_multiple_sockets())
+        {
+            bool service_per_thread = (_service->services() > 1);
+            size_t count = service_per_thread ? _service->services() : _service->threads();
+            for (size_t i = 0; i < count; ++i)
+            {
+                // Skip the Asio IO service of the main socket
+                auto& io_service = _service->GetAsioService(i);
+                if (service_per_thread ? (io_service == _io_service) : (i == 0))
+                    continue;
+
+                auto receiver = std::make_shared<Receiver>(io_service);
+                OpenSocket(receiver->socket);
+                receiver->buffer.resize(_receive_buffer.size());
+                _receivers.emplace_back(receiver);
+            }
+        }
+#endif
 
         // Reset statistic
         _bytes_sending = 0;
@@ -159,12 +326,21 @@ bool UDPServer::Start()
         _bytes_received = 0;
         _datagrams_sent = 0;
         _datagrams_received = 0;
+        _datagrams_dropped = 0;
+        _bytes_dropped = 0;
 
          // Update the started flag
         _started = true;
 
         // Call the server started handler
         onStarted();
+
+        // Start expiring idle sessions
+        ExpireSessions();
+
+        // Start receiving transmit timestamps
+        if (option_transmit_timestamps() && Timestamping::IsSupported())
+            TryReceiveTransmitTimestamps();
     };
     if (_strand_required)
         _strand.post(start_handler);
@@ -199,14 +375,44 @@ bool UDPServer::Stop()
         if (!IsStarted())
             return;
 
+        // Cancel the session expiration and pacing timers
+        asio::error_code ec;
+        _sessions_timer.cancel(ec);
+        _pacing_timer.cancel(ec);
+
         // Close the server socket
         _socket.close();
 
+        // Close the AF_XDP transport
+#if defined(__linux__)
+        if (_xdp_descriptor)
+        {
+            _xdp_descriptor->cancel(ec);
+            _xdp_descriptor->release();
+            _xdp_descriptor.reset();
+        }
+#endif
+        _xdp.Close();
+
+        // Disconnect all sessions
+        DisconnectAll();
+
+        // Close additional server receivers
+        for (auto& receiver : _receivers)
+        {
+            auto close_handler = [receiver]() { receiver->socket.close(); };
+            if (_strand_required)
+                receiver->strand.post(close_handler);
+            else
+                receiver->io_service->post(close_handler);
+        }
+
         // Update the started flag
         _started = false;
 
         // Update sending/receiving flags
         _receiving = false;
+        _xdp_receiving = false;
         _sending = false;
 
         // Clear send/receive buffers
@@ -234,6 +440,37 @@ bool UDPServer::Restart()
     return Start();
 }
 
+bool UDPServer::DisconnectAll()
+{
+    if (!IsStarted())
+        return false;
+
+    std::vector<std::shared_ptr<UDPSession>> sessions;
+    {
+        std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+        for (auto& session : _sessions)
+            if (session)
+                sessions.emplace_back(session);
+    }
+
+    // Disconnect all sessions
+    for (auto& session : sessions)
+        session->Disconnect();
+
+    return true;
+}
+
+std::shared_ptr<UDPSession> UDPServer::FindSession(const asio::ip::udp::endpoint& endpoint)
+{
+    std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+    if (_sessions.empty())
+        return nullptr;
+
+    return _sessions[FindSessionSlot(endpoint)];
+}
+
 size_t UDPServer::Multicast(const void* buffer, size_t size)
 {
     // Send the datagram to the multicast endpoint
@@ -356,6 +593,10 @@ bool UDPServer::SendAsync(const asio::ip::udp::endpoint& endpoint, const void* b
     if (buffer == nullptr)
         return false;
 
+    // Queue the datagram in the send queue or pacing mode
+    if ((option_send_queue() > 0) || (option_pacing_rate() > 0))
+        return SendQueued(endpoint, buffer, size);
+
     if (_sending)
         return false;
 
@@ -365,6 +606,23 @@ bool UDPServer::SendAsync(const asio::ip::udp::endpoint& endpoint, const void* b
     if (size == 0)
         return true;
 
+    // Send the datagram with the AF_XDP transport
+    if (IsXdp())
+    {
+        asio::error_code ec;
+        UDPDatagram datagram(endpoint, buffer, size);
+        if (_xdp.Send(&datagram, 1, ec) == 1)
+        {
+            // Update statistic
+            ++_datagrams_sent;
+            _bytes_sent += size;
+
+            // Call the datagram sent handler
+            onSent(endpoint, size);
+            return true;
+        }
+    }
+
     // Fill the main send buffer
     const uint8_t* bytes = (const uint8_t*)buffer;
     _send_buffer.assign(bytes, bytes + size);
@@ -530,10 +788,47 @@ void UDPServer::ReceiveAsync()
 {
     // Try to receive datagrams from clients
     TryReceive();
+
+    // Try to receive datagrams with additional receivers
+    for (auto& receiver : _receivers)
+    {
+        if (receiver->receiving)
+            continue;
+
+        auto self(this->shared_from_this());
+        auto receive_handler = [this, self, receiver]() { TryReceive(receiver); };
+        if (_strand_required)
+            receiver->strand.dispatch(receive_handler);
+        else
+            receiver->io_service->dispatch(receive_handler);
+    }
 }
 
 void UDPServer::TryReceive()
 {
+    // Datagrams of network interface queues without the AF_XDP socket
+    // are passed to the OS network stack, so receive with both of them
+    if (IsXdp())
+        TryReceiveXdp();
+
+    if (option_receive_offload())
+    {
+        TryReceiveSegments();
+        return;
+    }
+
+    if (option_receive_batch() > 1)
+    {
+        TryReceiveBatch();
+        return;
+    }
+
+    if (option_receive_timestamps())
+    {
+        TryReceiveTimestamped();
+        return;
+    }
+
     if (_receiving)
         return;
 
@@ -578,10 +873,964 @@ void UDPServer::TryReceive()
         _socket.async_receive_from(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), _receive_endpoint, async_receive_handler);
 }
 
-void UDPServer::ClearBuffers()
+void UDPServer::TryReceive(std::shared_ptr<Receiver> receiver)
+{
+    if (receiver->receiving)
+        return;
+
+    if (!IsStarted())
+        return;
+
+    // Async receive with the receive handler
+    receiver->receiving = true;
+    auto self(this->shared_from_this());
+    auto async_receive_handler = make_alloc_handler(receiver->storage, [this, self, receiver](std::error_code ec, size_t size)
+    {
+        receiver->receiving = false;
+
+        if (!IsStarted())
+            return;
+
+        // Check for error
+        if (ec)
+        {
+            SendError(ec);
+            return;
+        }
+
+        // Received some data from the client
+        if (size > 0)
+        {
+            // Update statistic
+            ++_datagrams_received;
+            _bytes_received += size;
+
+            // Call the datagram received handler
+            onReceived(receiver->endpoint, receiver->buffer.data(), size);
+
+            // If the receive buffer is full increase its size
+            if (receiver->buffer.size() == size)
+                receiver->buffer.resize(2 * size);
+        }
+    });
+    if (_strand_required)
+        receiver->socket.async_receive_from(asio::buffer(receiver->buffer.data(), receiver->buffer.size()), receiver->endpoint, bind_executor(receiver->strand, async_receive_handler));
+    else
+        receiver->socket.async_receive_from(asio::buffer(receiver->buffer.data(), receiver->buffer.size()), receiver->endpoint, async_receive_handler);
+}
+
+void UDPServer::TryReceiveBatch()
+{
+    if (_receiving)
+        return;
+
+    if (!IsStarted())
+        return;
+
+    // Async wait for readable socket with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec)
+    {
+        _receiving = false;
+
+        if (!IsStarted())
+            return;
+
+        // Receive the batch of datagrams
+        size_t count = 0;
+        if (!ec)
+            count = UDPBatch::Receive(_socket, _receive_batch_buffer.data(), option_receive_batch_size(), _receive_batch.data(), _receive_batch.size(), ec);
+
+        // Check for error
+        if (ec)
+        {
+            SendError(ec);
+            return;
+        }
+
+        // Received some datagrams from the client
+        if (count > 0)
+        {
+            // Update statistic
+            _datagrams_received += count;
+            for (size_t i = 0; i < count; ++i)
+                _bytes_received += _receive_batch[i].size;
+
+            // Call the datagrams batch received handler
+            onReceivedBatch(_receive_batch.data(), count);
+        }
+        else
+        {
+            // Spurious wakeup, wait for readable socket again
+            TryReceiveBatch();
+        }
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_read, async_wait_handler);
+}
+
+bool UDPServer::SendBatchAsync(const UDPDatagram* datagrams, size_t count)
+{
+    assert((datagrams != nullptr) && "Pointer to the datagrams should not be null!");
+    if (datagrams == nullptr)
+        return false;
+
+    // Queue datagrams in the send queue or pacing mode
+    if ((option_send_queue() > 0) || (option_pacing_rate() > 0))
+    {
+        bool result = true;
+        for (size_t i = 0; i < count; ++i)
+            if (!SendQueued(datagrams[i].endpoint, datagrams[i].buffer, datagrams[i].size))
+                result = false;
+        return result;
+    }
+
+    if (_sending)
+        return false;
+
+    if (!IsStarted())
+        return false;
+
+    if (count == 0)
+        return true;
+
+    // Fill the send batch buffer
+    size_t size = 0;
+    for (size_t i = 0; i < count; ++i)
+        size += datagrams[i].size;
+    _send_batch_buffer.resize(size);
+    _send_batch.resize(count);
+    size_t offset = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (datagrams[i].size > 0)
+            std::memcpy(_send_batch_buffer.data() + offset, datagrams[i].buffer, datagrams[i].size);
+        _send_batch[i] = UDPDatagram(datagrams[i].endpoint, _send_batch_buffer.data() + offset, datagrams[i].size);
+        offset += datagrams[i].size;
+    }
+    _send_batch_offset = 0;
+
+    // Update statistic
+    _bytes_sending = size;
+
+    // Send the batch of datagrams
+    _sending = true;
+    TrySendBatch();
+
+    return true;
+}
+
+void UDPServer::TrySendBatch()
+{
+    // Async wait for writable socket with the send handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_send_storage, [this, self](std::error_code ec)
+    {
+        if (!IsStarted())
+        {
+            _sending = false;
+            return;
+        }
+
+        // Send the rest of the batch
+        size_t first = _send_batch_offset;
+        size_t sent = 0;
+        if (!ec)
+            sent = SendDatagrams(_send_batch.data() + first, _send_batch.size() - first, ec);
+        _send_batch_offset += sent;
+
+        // Check for error
+        if (ec)
+        {
+            _sending = false;
+            SendError(ec);
+            return;
+        }
+
+        bool completed = (_send_batch_offset == _send_batch.size());
+
+        // Send some datagrams to the client
+        for (size_t i = first; i < first + sent; ++i)
+        {
+            // Copy the datagram, because the batch might be replaced from the handler
+            asio::ip::udp::endpoint endpoint = _send_batch[i].endpoint;
+            size_t size = _send_batch[i].size;
+
+            // Update statistic
+            ++_datagrams_sent;
+            _bytes_sending -= size;
+            _bytes_sent += size;
+
+            // Allow the next send before the last datagram sent handler
+            if (completed && (i + 1 == first + sent))
+            {
+                _send_batch.clear();
+                _send_batch_offset = 0;
+                _sending = false;
+            }
+
+            // Call the datagram sent handler
+            onSent(endpoint, size);
+        }
+
+        // Wait for writable socket to send the rest of the batch
+        if (!completed)
+            TrySendBatch();
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_write, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_write, async_wait_handler);
+}
+
+void UDPServer::TryReceiveSegments()
+{
+    if (_receiving)
+        return;
+
+    if (!IsStarted())
+        return;
+
+    // Async wait for readable socket with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec)
+    {
+        _receiving = false;
+
+        if (!IsStarted())
+            return;
+
+        // Receive the buffer of coalesced datagrams
+        size_t size = 0;
+        size_t segment_size = 0;
+        if (!ec)
+            size = UDPOffload::Receive(_socket, _receive_endpoint, _receive_buffer.data(), _receive_buffer.size(), segment_size, ec);
+
+        // Check for error
+        if (ec)
+        {
+            SendError(ec);
+            return;
+        }
+
+        // Received some datagrams from the client
+        if (size > 0)
+        {
+            // Update statistic
+            _datagrams_received += (size + segment_size - 1) / segment_size;
+            _bytes_received += size;
+
+            // Call the segmented datagrams received handler
+            onReceivedSegments(_receive_endpoint, _receive_buffer.data(), size, segment_size);
+        }
+        else
+        {
+            // Spurious wakeup, wait for readable socket again
+            TryReceiveSegments();
+        }
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_read, async_wait_handler);
+}
+
+void UDPServer::TryReceiveTimestamped()
 {
+    if (_receiving)
+        return;
+
+    if (!IsStarted())
+        return;
+
+    // Async wait for readable socket with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec)
+    {
+        _receiving = false;
+
+        if (!IsStarted())
+            return;
+
+        // Receive the datagram with its receive timestamp
+        size_t size = 0;
+        PacketTimestamp timestamp;
+        if (!ec)
+            size = Timestamping::Receive(_socket, _receive_endpoint, _receive_buffer.data(), _receive_buffer.size(), timestamp, ec);
+
+        // Check for error
+        if (ec)
+        {
+            SendError(ec);
+            return;
+        }
+
+        // Received some data from the client
+        if (size > 0)
+        {
+            // Update statistic
+            ++_datagrams_received;
+            _bytes_received += size;
+
+            // Call the timestamped datagram received handler
+            onReceivedTimestamped(_receive_endpoint, _receive_buffer.data(), size, timestamp);
+
+            // If the receive buffer is full increase its size
+            if (_receive_buffer.size() == size)
+                _receive_buffer.resize(2 * size);
+        }
+        else
+        {
+            // Spurious wakeup, wait for readable socket again
+            TryReceiveTimestamped();
+        }
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_read, async_wait_handler);
+}
+
+void UDPServer::TryReceiveXdp()
+{
+#if defined(__linux__)
+    if (_xdp_receiving)
+        return;
+
+    if (!IsStarted())
+        return;
+
+    // Async wait for readable AF_XDP socket with the receive handler
+    _xdp_receiving = true;
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_xdp_storage, [this, self](std::error_code ec)
+    {
+        _xdp_receiving = false;
+
+        if (!IsStarted())
+            return;
+
+        // Check for error
+        if (ec)
+        {
+            SendError(ec);
+            return;
+        }
+
+        // Receive the batch of datagrams from the RX ring
+        size_t count = _xdp.Receive(_xdp_batch.data(), _xdp_batch.size());
+        if (count > 0)
+        {
+            // Update statistic
+            _datagrams_received += count;
+            for (size_t i = 0; i < count; ++i)
+                _bytes_received += _xdp_batch[i].size;
+
+            // Call the datagrams batch received handler
+            onReceivedBatch(_xdp_batch.data(), count);
+        }
+        else
+        {
+            // Spurious wakeup, wait for readable AF_XDP socket again
+            TryReceiveXdp();
+        }
+    });
+    if (_strand_required)
+        _xdp_descriptor->async_wait(asio::posix::stream_descriptor::wait_read, bind_executor(_strand, async_wait_handler));
+    else
+        _xdp_descriptor->async_wait(asio::posix::stream_descriptor::wait_read, async_wait_handler);
+#endif
+}
+
+void UDPServer::TryReceiveTransmitTimestamps()
+{
+    if (!IsStarted())
+        return;
+
+    // Async wait for the socket error queue with the transmit timestamps handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const std::error_code& ec)
+    {
+        if (ec || !IsStarted())
+            return;
+
+        // Call the transmit timestamp handler for each pending timestamp
+        // and the error handler for other entries of the error queue
+        uint32_t id = 0;
+        PacketTimestamp timestamp;
+        asio::error_code error;
+        for (;;)
+        {
+            if (Timestamping::ReceiveTransmit(_socket.native_handle(), id, timestamp, error))
+                onSentTimestamp(id, timestamp);
+            else if (error)
+                SendError(error);
+            else
+                break;
+        }
+
+        // Wait for new transmit timestamps
+        TryReceiveTransmitTimestamps();
+    };
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_error, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_error, async_wait_handler);
+}
+
+bool UDPServer::SendSegmentedAsync(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, size_t segment_size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+    assert((segment_size > 0) && "Segment size should be greater than zero!");
+    if (segment_size == 0)
+        return false;
+    assert((segment_size <= UDPOffload::MAX_PAYLOAD) && "Segment size should not exceed the maximal datagram payload!");
+    if (segment_size > UDPOffload::MAX_PAYLOAD)
+        return false;
+
+    if (_sending)
+        return false;
+
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    // Fill the main send buffer
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _send_buffer.assign(bytes, bytes + size);
+    _send_segment_size = segment_size;
+    _send_segment_offset = 0;
+
+    // Update statistic
+    _bytes_sending = _send_buffer.size();
+
+    // Update send endpoint
+    _send_endpoint = endpoint;
+
+    // Send the segmented buffer
+    _sending = true;
+    TrySendSegments();
+
+    return true;
+}
+
+void UDPServer::TrySendSegments()
+{
+    // Async wait for writable socket with the send handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_send_storage, [this, self](std::error_code ec)
+    {
+        if (!IsStarted())
+        {
+            _sending = false;
+            return;
+        }
+
+        // Send the rest of the segmented buffer
+        size_t sent = 0;
+        if (!ec)
+            sent = UDPOffload::Send(_socket, _send_endpoint, _send_buffer.data() + _send_segment_offset, _send_buffer.size() - _send_segment_offset, _send_segment_size, _send_segment_offload, ec);
+        _send_segment_offset += sent;
+
+        // Check for error
+        if (ec)
+        {
+            _sending = false;
+            SendError(ec);
+            return;
+        }
+
+        // Update statistic
+        _datagrams_sent += (sent + _send_segment_size - 1) / _send_segment_size;
+        _bytes_sending -= sent;
+        _bytes_sent += sent;
+
+        // Wait for writable socket to send the rest of the buffer
+        if (_send_segment_offset < _send_buffer.size())
+        {
+            TrySendSegments();
+            return;
+        }
+
+        size_t size = _send_buffer.size();
+
+        // Clear the send buffer
+        _send_buffer.clear();
+        _send_segment_offset = 0;
+        _sending = false;
+
+        // Call the buffer sent handler
+        onSent(_send_endpoint, size);
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_write, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_write, async_wait_handler);
+}
+
+size_t UDPServer::SendDatagrams(const UDPDatagram* datagrams, size_t count, asio::error_code& ec)
+{
+    // Send leading datagrams with the AF_XDP transport
+    size_t sent = 0;
+    if (IsXdp())
+    {
+        sent = _xdp.Send(datagrams, count, ec);
+        if (ec)
+            return sent;
+    }
+
+    // Send the rest of datagrams with the socket
+    if (sent < count)
+        sent += UDPBatch::Send(_socket, datagrams + sent, count - sent, ec);
+
+    return sent;
+}
+
+bool UDPServer::SendQueued(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size)
+{
+    if (!IsStarted())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    {
+        std::lock_guard<std::mutex> locker(_send_lock);
+
+        // Apply the drop policy to the full send queue
+        if ((option_send_queue() > 0) && (_send_queue_count >= option_send_queue()))
+        {
+            if (option_send_queue_policy() == DropPolicy::DropNewest)
+            {
+                // Update statistic
+                ++_datagrams_dropped;
+                _bytes_dropped += size;
+                return false;
+            }
+
+            // Drop the oldest pending datagram
+            const QueuedDatagram& oldest = _send_queue[_send_queue_head];
+            _send_queue_head = (_send_queue_head + 1) % _send_queue.size();
+            --_send_queue_count;
+
+            // Update statistic
+            ++_datagrams_dropped;
+            _bytes_dropped += oldest.buffer.size();
+            _bytes_sending -= oldest.buffer.size();
+        }
+
+        // Grow the send queue ring when all slots are pending
+        if (_send_queue_count == _send_queue.size())
+        {
+            std::rotate(_send_queue.begin(), _send_queue.begin() + _send_queue_head, _send_queue.end());
+            _send_queue.emplace_back();
+            _send_queue_head = 0;
+        }
+
+        // Fill the next send queue slot
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        QueuedDatagram& datagram = _send_queue[(_send_queue_head + _send_queue_count++) % _send_queue.size()];
+        datagram.endpoint = endpoint;
+        datagram.buffer.assign(bytes, bytes + size);
+
+        // Update statistic
+        _bytes_sending += size;
+
+        // Avoid multiple send handlers
+        if (_sending)
+            return true;
+        _sending = true;
+    }
+
+    // Dispatch the send handler
+    auto self(this->shared_from_this());
+    auto send_handler = [this, self]()
+    {
+        // Try to send the send queue
+        TrySendQueue();
+    };
+    if (_strand_required)
+        _strand.dispatch(send_handler);
+    else
+        _io_service->dispatch(send_handler);
+
+    return true;
+}
+
+void UDPServer::TrySendQueue()
+{
+    if (!IsStarted())
+        return;
+
+    // Swap the send queue ring when the flush batch was completely sent
+    if (_send_batch_offset == _send_batch.size())
+    {
+        std::lock_guard<std::mutex> locker(_send_lock);
+
+        // Stop draining when the send queue is empty
+        if (_send_queue_count == 0)
+        {
+            _send_queue_head = 0;
+            _sending = false;
+            return;
+        }
+
+        // Swap send queue rings and prepare the flush batch
+        _send_queue_flush.swap(_send_queue);
+        _send_batch.clear();
+        for (size_t i = 0; i < _send_queue_count; ++i)
+        {
+            const QueuedDatagram& datagram = _send_queue_flush[(_send_queue_head + i) % _send_queue_flush.size()];
+            _send_batch.emplace_back(datagram.endpoint, datagram.buffer.data(), datagram.buffer.size());
+        }
+        _send_batch_offset = 0;
+        _send_queue_head = 0;
+        _send_queue_count = 0;
+    }
+
+    // Wait for the pacer before sending the rest of the flush batch
+    if (_pacer.enabled())
+    {
+        uint64_t delay = _pacer.Delay(CppCommon::Timestamp::nano(), _pacing_transmit_time ? Pacer::TRANSMIT_TIME_HORIZON : 0);
+        if (delay > 0)
+        {
+            // Update statistic
+            _pacer.Throttle();
+
+            // Wait for the pacing delay
+            TrySendPaced(delay);
+            return;
+        }
+    }
+
+    // Async wait for writable socket with the send handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_send_storage, [this, self](std::error_code ec)
+    {
+        if (!IsStarted())
+            return;
+
+        // Send the rest of the flush batch
+        size_t first = _send_batch_offset;
+        size_t sent = 0;
+        if (!ec)
+        {
+            if (_pacer.enabled())
+                sent = SendPaced(first, _send_batch.size() - first, ec);
+            else
+                sent = SendDatagrams(_send_batch.data() + first, _send_batch.size() - first, ec);
+        }
+        _send_batch_offset += sent;
+
+        size_t size = 0;
+        for (size_t i = first; i < first + sent; ++i)
+            size += _send_batch[i].size;
+
+        // Skip the failed datagram to keep draining the send queue
+        if (ec)
+        {
+            SendError(ec);
+            if (_send_batch_offset < _send_batch.size())
+            {
+                // Update statistic
+                ++_datagrams_dropped;
+                _bytes_dropped += _send_batch[_send_batch_offset].size;
+                size += _send_batch[_send_batch_offset].size;
+                ++_send_batch_offset;
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> locker(_send_lock);
+
+            // Update statistic
+            _bytes_sending -= size;
+        }
+
+        // Send some datagrams to clients
+        for (size_t i = first; i < first + sent; ++i)
+        {
+            // Update statistic
+            ++_datagrams_sent;
+            _bytes_sent += _send_batch[i].size;
+
+            // Call the datagram sent handler
+            onSent(_send_batch[i].endpoint, _send_batch[i].size);
+        }
+
+        // Continue draining the send queue
+        TrySendQueue();
+    });
+    if (_strand_required)
+        _socket.async_wait(asio::ip::udp::socket::wait_write, bind_executor(_strand, async_wait_handler));
+    else
+        _socket.async_wait(asio::ip::udp::socket::wait_write, async_wait_handler);
+}
+
+size_t UDPServer::SendPaced(size_t first, size_t count, asio::error_code& ec)
+{
+    uint64_t timestamp = CppCommon::Timestamp::nano();
+    uint64_t horizon = _pacing_transmit_time ? Pacer::TRANSMIT_TIME_HORIZON : 0;
+
+    // Find datagrams allowed by the pacer with their launch times
+    Pacer pacer(_pacer);
+    _send_launch_times.clear();
+    while ((_send_launch_times.size() < count) && (pacer.Delay(timestamp, horizon) == 0))
+        _send_launch_times.push_back(pacer.Consume(timestamp, _send_batch[first + _send_launch_times.size()].size));
+
+    size_t allowed = _send_launch_times.size();
+    size_t sent = 0;
+    if (_pacing_transmit_time)
+        sent = Pacer::Send(_socket, _send_batch.data() + first, _send_launch_times.data(), allowed, ec);
+    else
+        sent = SendDatagrams(_send_batch.data() + first, allowed, ec);
+
+    // Consume pacer tokens of sent datagrams
+    for (size_t i = 0; i < sent; ++i)
+        _pacer.Consume(timestamp, _send_batch[first + i].size);
+
+    return sent;
+}
+
+void UDPServer::TrySendPaced(uint64_t delay)
+{
+    // Yield the working thread for short delays which are not precise with timers
+    if (Pacer::IsShortDelay(delay))
+    {
+        auto self(this->shared_from_this());
+        auto send_handler = make_alloc_handler(_send_storage, [this, self]()
+        {
+            if (!IsStarted())
+                return;
+
+            // Continue draining the send queue
+            TrySendQueue();
+        });
+        if (_strand_required)
+            _strand.post(send_handler);
+        else
+            _io_service->post(send_handler);
+        return;
+    }
+
+    // Async wait for the pacing delay with the send handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = make_alloc_handler(_send_storage, [this, self](const std::error_code& ec)
+    {
+        if (!IsStarted())
+            return;
+
+        // Continue draining the send queue
+        TrySendQueue();
+    });
+    _pacing_timer.expires_from_now(std::chrono::nanoseconds(delay));
+    if (_strand_required)
+        _pacing_timer.async_wait(bind_executor(_strand, async_wait_handler));
+    else
+        _pacing_timer.async_wait(async_wait_handler);
+}
+
+//! @cond INTERNALS
+
+// FNV-1a hash of the endpoint address and port
+static size_t HashEndpoint(const asio::ip::udp::endpoint& endpoint)
+{
+    uint64_t hash = 14695981039346656037ull;
+    auto combine = [&hash](const uint8_t* bytes, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    if (endpoint.address().is_v4())
+    {
+        auto bytes = endpoint.address().to_v4().to_bytes();
+        combine(bytes.data(), bytes.size());
+    }
+    else
+    {
+        auto bytes = endpoint.address().to_v6().to_bytes();
+        combine(bytes.data(), bytes.size());
+    }
+    uint16_t port = endpoint.port();
+    combine((const uint8_t*)&port, sizeof(port));
+    return (size_t)hash;
+}
+
+//! @endcond
+
+size_t UDPServer::FindSessionSlot(const asio::ip::udp::endpoint& endpoint) const
+{
+    // Linear probing from the endpoint hash slot
+    size_t mask = _sessions.size() - 1;
+    size_t slot = HashEndpoint(endpoint) & mask;
+    while (_sessions[slot] && (_sessions[slot]->endpoint() != endpoint))
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+std::shared_ptr<UDPSession> UDPServer::RegisterSession(const asio::ip::udp::endpoint& endpoint)
+{
+    // Find the registered session
+    auto session = FindSession(endpoint);
+    if (session)
+        return session;
+
+    {
+        std::unique_lock<std::shared_mutex> locker(_sessions_lock);
+
+        // Find the session registered concurrently
+        if (!_sessions.empty())
+        {
+            auto& registered = _sessions[FindSessionSlot(endpoint)];
+            if (registered)
+                return registered;
+        }
+
+        // Create a new session
+        session = CreateSession(this->shared_from_this(), endpoint);
+        if (!session)
+            return nullptr;
+
+        // Grow the hash table to keep the load factor below 1/2
+        if (2 * (_sessions_count + 1) > _sessions.size())
+        {
+            std::vector<std::shared_ptr<UDPSession>> sessions(std::max(_sessions.size() * 2, (size_t)16));
+            std::swap(_sessions, sessions);
+            for (auto& registered : sessions)
+                if (registered)
+                    _sessions[FindSessionSlot(registered->endpoint())] = std::move(registered);
+        }
+
+        // Register the session
+        _sessions[FindSessionSlot(endpoint)] = session;
+        ++_sessions_count;
+    }
+
+    // Connect the new session
+    session->Connect();
+
+    return session;
+}
+
+void UDPServer::UnregisterSession(const std::shared_ptr<UDPSession>& session)
+{
+    std::unique_lock<std::shared_mutex> locker(_sessions_lock);
+
+    if (_sessions.empty())
+        return;
+
+    // Find the registered session
+    size_t slot = FindSessionSlot(session->endpoint());
+    if (_sessions[slot] != session)
+        return;
+
+    // Erase the session with the backward shift of the following probe sequence
+    size_t mask = _sessions.size() - 1;
+    size_t next = slot;
+    _sessions[slot].reset();
+    for (;;)
+    {
+        next = (next + 1) & mask;
+        if (!_sessions[next])
+            break;
+
+        // Keep the session if its home slot is cyclically in (slot, next]
+        size_t home = HashEndpoint(_sessions[next]->endpoint()) & mask;
+        if ((slot <= next) ? ((slot < home) && (home <= next)) : ((slot < home) || (home <= next)))
+            continue;
+
+        _sessions[slot] = std::move(_sessions[next]);
+        slot = next;
+    }
+    --_sessions_count;
+}
+
+void UDPServer::DispatchReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size)
+{
+    // Find or create the session of the endpoint
+    auto session = RegisterSession(endpoint);
+    if (session)
+        session->Received(buffer, size);
+}
+
+void UDPServer::DispatchSent(const asio::ip::udp::endpoint& endpoint, size_t sent)
+{
+    if (_sessions_count == 0)
+        return;
+
+    // Find the session of the endpoint
+    auto session = FindSession(endpoint);
+    if (session)
+        session->Sent(sent);
+}
+
+void UDPServer::ExpireSessions()
+{
+    if (!IsStarted() || (_option_session_timeout.total() <= 0))
+        return;
+
+    // Async wait for the next expiration check with the expire handler
+    auto self(this->shared_from_this());
+    auto async_wait_handler = [this, self](const std::error_code& ec)
+    {
+        if (ec || !IsStarted())
+            return;
+
+        // Collect idle sessions
+        std::vector<std::shared_ptr<UDPSession>> sessions;
+        {
+            std::shared_lock<std::shared_mutex> locker(_sessions_lock);
+
+            uint64_t timestamp = CppCommon::Timestamp::nano();
+            uint64_t timeout = (uint64_t)_option_session_timeout.total();
+            // Sessions touched after the timestamp was taken are not idle
+            for (auto& session : _sessions)
+                if (session && ((session->last_activity() + timeout) < timestamp))
+                    sessions.emplace_back(session);
+        }
+
+        // Disconnect idle sessions
+        for (auto& session : sessions)
+            session->Disconnect();
+
+        // Schedule the next expiration check
+        ExpireSessions();
+    };
+    _sessions_timer.expires_from_now(std::chrono::nanoseconds(std::max(_option_session_timeout.total() / 2, (int64_t)1000000)));
+    if (_strand_required)
+        _sessions_timer.async_wait(bind_executor(_strand, async_wait_handler));
+    else
+        _sessions_timer.async_wait(async_wait_handler);
+}
+
+void UDPServer::ClearBuffers()
+{
+    std::lock_guard<std::mutex> locker(_send_lock);
+
     // Clear send buffers
     _send_buffer.clear();
+    _send_batch.clear();
+    _send_batch_offset = 0;
+    _send_segment_offset = 0;
+    _send_segment_offload = true;
+
+    // Clear send queue
+    _send_queue.clear();
+    _send_queue_head = 0;
+    _send_queue_count = 0;
+    _send_queue_flush.clear();
 
     // Update statistic
     _bytes_sending = 0;
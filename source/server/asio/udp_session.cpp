@@ -0,0 +1,345 @@
+/*!
+    \file udp_session.cpp
+    \brief UDP session implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/udp_session.h"
+#include "server/asio/udp_server.h"
+
+#include "time/timestamp.h"
+
+namespace CppServer {
+namespace Asio {
+
+UDPSession::UDPSession(std::shared_ptr<UDPServer> server, const asio::ip::udp::endpoint& endpoint)
+    : _id(CppCommon::UUID::Random()),
+      _server(server),
+      _endpoint(endpoint),
+      _io_service(server->service()->GetAsioService()),
+      _strand(*_io_service),
+      _strand_required(_server->_strand_required),
+      _socket(*_io_service),
+      _connected(false),
+      _socket_connected(false),
+      _bytes_sent(0),
+      _bytes_received(0),
+      _datagrams_sent(0),
+      _datagrams_received(0),
+      _last_activity(0),
+      _receiving(false),
+      _sending(false)
+{
+}
+
+void UDPSession::Connect()
+{
+    // Reset statistic
+    _last_activity = CppCommon::Timestamp::nano();
+
+    // Update the connected flag
+    _connected = true;
+
+    // Call the session connected handler
+    onConnected();
+
+    // Call the session connected handler in the server
+    auto connected_session(this->shared_from_this());
+    _server->onConnected(connected_session);
+}
+
+bool UDPSession::Disconnect()
+{
+    return Disconnect(false);
+}
+
+bool UDPSession::Disconnect(bool dispatch)
+{
+    if (!IsConnected())
+        return false;
+
+    // Dispatch or post the disconnect handler
+    auto self(this->shared_from_this());
+    auto disconnect_handler = [this, self]()
+    {
+        if (!IsConnected())
+            return;
+
+        // Close the connected session socket
+        if (IsSocketConnected())
+        {
+            asio::error_code ec;
+            _socket.close(ec);
+            _socket_connected = false;
+        }
+
+        // Update the connected flag
+        _connected = false;
+
+        // Update sending/receiving flags
+        _receiving = false;
+        _sending = false;
+
+        // Call the session disconnected handler
+        onDisconnected();
+
+        // Call the session disconnected handler in the server
+        auto disconnected_session(this->shared_from_this());
+        _server->onDisconnected(disconnected_session);
+
+        // Unregister the session
+        _server->UnregisterSession(disconnected_session);
+    };
+    if (_strand_required)
+    {
+        if (dispatch)
+            _strand.dispatch(disconnect_handler);
+        else
+            _strand.post(disconnect_handler);
+    }
+    else
+    {
+        if (dispatch)
+            _io_service->dispatch(disconnect_handler);
+        else
+            _io_service->post(disconnect_handler);
+    }
+
+    return true;
+}
+
+bool UDPSession::ConnectSocket()
+{
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+    if (!IsConnected() || IsSocketConnected())
+        return false;
+
+    // The session socket could share the server endpoint only with the reuse port option
+    if (!_server->option_reuse_port() && !_server->option_multiple_sockets())
+    {
+        SendError(asio::error::operation_not_supported);
+        return false;
+    }
+
+    asio::error_code ec;
+
+    // Open the session socket bound to the server endpoint and connected to the peer
+    typedef asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT> reuse_port;
+    _socket.open(_server->endpoint().protocol(), ec);
+    if (!ec)
+        _socket.set_option(asio::ip::udp::socket::reuse_address(true), ec);
+    if (!ec)
+        _socket.set_option(reuse_port(true), ec);
+    if (!ec)
+        _socket.bind(_server->endpoint(), ec);
+    if (!ec)
+        _socket.connect(_endpoint, ec);
+
+    // Check for error
+    if (ec)
+    {
+        SendError(ec);
+        asio::error_code ignored;
+        _socket.close(ignored);
+        return false;
+    }
+
+    // Prepare receive buffer
+    asio::socket_base::receive_buffer_size option;
+    _socket.get_option(option);
+    _receive_buffer.resize(option.value());
+
+    // Update the socket connected flag
+    _socket_connected = true;
+
+    // Dispatch the receive handler
+    auto self(this->shared_from_this());
+    auto receive_handler = [this, self]()
+    {
+        // Try to receive datagrams with the connected socket
+        TryReceive();
+    };
+    if (_strand_required)
+        _strand.dispatch(receive_handler);
+    else
+        _io_service->dispatch(receive_handler);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t UDPSession::Send(const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return 0;
+
+    if (!IsConnected())
+        return 0;
+
+    if (size == 0)
+        return 0;
+
+    // Send datagram with the server socket
+    if (!IsSocketConnected())
+        return _server->Send(_endpoint, buffer, size);
+
+    asio::error_code ec;
+
+    // Send datagram with the connected socket
+    size_t sent = _socket.send(asio::const_buffer(buffer, size), 0, ec);
+    if (sent > 0)
+        Sent(sent);
+
+    // Disconnect on error
+    if (ec)
+    {
+        SendError(ec);
+        Disconnect(true);
+    }
+
+    return sent;
+}
+
+bool UDPSession::SendAsync(const void* buffer, size_t size)
+{
+    assert((buffer != nullptr) && "Pointer to the buffer should not be null!");
+    if (buffer == nullptr)
+        return false;
+
+    if (!IsConnected())
+        return false;
+
+    if (size == 0)
+        return true;
+
+    // Send datagram with the server socket
+    if (!IsSocketConnected())
+        return _server->SendAsync(_endpoint, buffer, size);
+
+    if (_sending.exchange(true))
+        return false;
+
+    // Fill the main send buffer
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _send_buffer.assign(bytes, bytes + size);
+
+    // Async send with the send handler
+    auto self(this->shared_from_this());
+    auto async_send_handler = make_alloc_handler(_send_storage, [this, self](std::error_code ec, size_t sent)
+    {
+        _sending = false;
+
+        if (!IsConnected())
+            return;
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            Disconnect(true);
+            return;
+        }
+
+        // Send some data to the peer
+        if (sent > 0)
+            Sent(sent);
+    });
+    if (_strand_required)
+        _socket.async_send(asio::buffer(_send_buffer.data(), _send_buffer.size()), bind_executor(_strand, async_send_handler));
+    else
+        _socket.async_send(asio::buffer(_send_buffer.data(), _send_buffer.size()), async_send_handler);
+
+    return true;
+}
+
+void UDPSession::Received(const void* buffer, size_t size)
+{
+    // Update statistic
+    ++_datagrams_received;
+    _bytes_received += size;
+    _last_activity = CppCommon::Timestamp::nano();
+
+    // Call the raw datagram received handler
+    onReceivedDatagram(buffer, size);
+}
+
+void UDPSession::Sent(size_t sent)
+{
+    // Update statistic
+    ++_datagrams_sent;
+    _bytes_sent += sent;
+
+    // Call the datagram sent handler
+    onSent(sent);
+}
+
+void UDPSession::TryReceive()
+{
+    if (_receiving)
+        return;
+
+    if (!IsConnected() || !IsSocketConnected())
+        return;
+
+    // Async receive with the receive handler
+    _receiving = true;
+    auto self(this->shared_from_this());
+    auto async_receive_handler = make_alloc_handler(_receive_storage, [this, self](std::error_code ec, size_t size)
+    {
+        _receiving = false;
+
+        if (!IsConnected() || !IsSocketConnected())
+            return;
+
+        // Disconnect on error
+        if (ec)
+        {
+            SendError(ec);
+            Disconnect(true);
+            return;
+        }
+
+        // Received some data from the peer
+        if (size > 0)
+        {
+            // Update the server statistic
+            ++_server->_datagrams_received;
+            _server->_bytes_received += size;
+
+            // Handle the received datagram
+            Received(_receive_buffer.data(), size);
+
+            // If the receive buffer is full increase its size
+            if (_receive_buffer.size() == size)
+                _receive_buffer.resize(2 * size);
+        }
+
+        // Try to receive again
+        TryReceive();
+    });
+    if (_strand_required)
+        _socket.async_receive(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), bind_executor(_strand, async_receive_handler));
+    else
+        _socket.async_receive(asio::buffer(_receive_buffer.data(), _receive_buffer.size()), async_receive_handler);
+}
+
+void UDPSession::SendError(std::error_code ec)
+{
+    // Skip Asio disconnect errors
+    if ((ec == asio::error::connection_aborted) ||
+        (ec == asio::error::connection_refused) ||
+        (ec == asio::error::connection_reset) ||
+        (ec == asio::error::eof) ||
+        (ec == asio::error::operation_aborted))
+        return;
+
+    onError(ec.value(), ec.category().name(), ec.message());
+}
+
+} // namespace Asio
+} // namespace CppServer
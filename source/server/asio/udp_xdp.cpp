@@ -0,0 +1,537 @@
+/*!
+    \file udp_xdp.cpp
+    \brief UDP AF_XDP transport implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "server/asio/udp_xdp.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <linux/if_xdp.h>
+#if !defined(AF_XDP)
+#define AF_XDP 44
+#endif
+#if !defined(SOL_XDP)
+#define SOL_XDP 283
+#endif
+#endif
+
+namespace CppServer {
+namespace Asio {
+
+//! @cond INTERNALS
+
+#if defined(__linux__)
+
+static int BPF(int command, bpf_attr& attr)
+{
+    return (int)::syscall(__NR_bpf, command, &attr, sizeof(attr));
+}
+
+static bpf_insn Instruction(uint8_t code, uint8_t dst, uint8_t src, int16_t offset, int32_t immediate)
+{
+    bpf_insn instruction;
+    std::memset(&instruction, 0, sizeof(instruction));
+    instruction.code = code;
+    instruction.dst_reg = dst;
+    instruction.src_reg = src;
+    instruction.off = offset;
+    instruction.imm = immediate;
+    return instruction;
+}
+
+// Network order bytes as the value loaded by the XDP program
+static int32_t Load16(uint16_t value)
+{
+    uint8_t bytes[2] = { (uint8_t)(value >> 8), (uint8_t)value };
+    uint16_t result;
+    std::memcpy(&result, bytes, sizeof(result));
+    return result;
+}
+
+static uint16_t Read16(const uint8_t* bytes)
+{
+    return (uint16_t)((bytes[0] << 8) | bytes[1]);
+}
+
+static uint32_t Read32(const uint8_t* bytes)
+{
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
+
+static void Write16(uint8_t* bytes, uint16_t value)
+{
+    bytes[0] = (uint8_t)(value >> 8);
+    bytes[1] = (uint8_t)value;
+}
+
+static void Write32(uint8_t* bytes, uint32_t value)
+{
+    bytes[0] = (uint8_t)(value >> 24);
+    bytes[1] = (uint8_t)(value >> 16);
+    bytes[2] = (uint8_t)(value >> 8);
+    bytes[3] = (uint8_t)value;
+}
+
+// XDP program which redirects IPv4 UDP frames of the given port into the AF_XDP socket of the receive queue
+static std::vector<bpf_insn> Program(int map, uint16_t port)
+{
+    const uint8_t LDX_W = BPF_LDX | BPF_W | BPF_MEM;
+    const uint8_t LDX_H = BPF_LDX | BPF_H | BPF_MEM;
+    const uint8_t LDX_B = BPF_LDX | BPF_B | BPF_MEM;
+
+    return std::vector<bpf_insn>
+    {
+        Instruction(LDX_W, BPF_REG_2, BPF_REG_1, 0, 0),                             // r2 = ctx->data
+        Instruction(LDX_W, BPF_REG_3, BPF_REG_1, 4, 0),                             // r3 = ctx->data_end
+        Instruction(BPF_ALU64 | BPF_MOV | BPF_X, BPF_REG_4, BPF_REG_2, 0, 0),       // r4 = r2
+        Instruction(BPF_ALU64 | BPF_ADD | BPF_K, BPF_REG_4, 0, 0, 42),              // r4 += headers size
+        Instruction(BPF_JMP | BPF_JGT | BPF_X, BPF_REG_4, BPF_REG_3, 17, 0),        // if r4 > r3 goto pass
+        Instruction(LDX_H, BPF_REG_5, BPF_REG_2, 12, 0),                            // r5 = eth->h_proto
+        Instruction(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 15, Load16(0x0800)),   // if r5 != IPv4 goto pass
+        Instruction(LDX_B, BPF_REG_5, BPF_REG_2, 14, 0),                            // r5 = ip->version_ihl
+        Instruction(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 13, 0x45),             // if r5 != IPv4 without options goto pass
+        Instruction(LDX_B, BPF_REG_5, BPF_REG_2, 23, 0),                            // r5 = ip->protocol
+        Instruction(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 11, 17),               // if r5 != UDP goto pass
+        Instruction(LDX_H, BPF_REG_5, BPF_REG_2, 20, 0),                            // r5 = ip->frag_off
+        Instruction(BPF_ALU64 | BPF_AND | BPF_K, BPF_REG_5, 0, 0, Load16(0x3FFF)),  // r5 &= fragment flags and offset
+        Instruction(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 8, 0),                 // if r5 != 0 goto pass
+        Instruction(LDX_H, BPF_REG_5, BPF_REG_2, 36, 0),                            // r5 = udp->dest
+        Instruction(BPF_JMP | BPF_JNE | BPF_K, BPF_REG_5, 0, 6, Load16(port)),      // if r5 != port goto pass
+        Instruction(LDX_W, BPF_REG_2, BPF_REG_1, 16, 0),                            // r2 = ctx->rx_queue_index
+        Instruction(BPF_LD | BPF_DW | BPF_IMM, BPF_REG_1, BPF_PSEUDO_MAP_FD, 0, map),
+        Instruction(0, 0, 0, 0, 0),                                                 // r1 = map
+        Instruction(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_3, 0, 0, XDP_PASS),        // r3 = XDP_PASS
+        Instruction(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map),            // return bpf_redirect_map(r1, r2, r3)
+        Instruction(BPF_JMP | BPF_EXIT, 0, 0, 0, 0),
+        Instruction(BPF_ALU64 | BPF_MOV | BPF_K, BPF_REG_0, 0, 0, XDP_PASS),        // pass: return XDP_PASS
+        Instruction(BPF_JMP | BPF_EXIT, 0, 0, 0, 0)
+    };
+}
+
+static bool MapRing(int socket, const xdp_ring_offset& offset, uint32_t size, size_t descriptor, off_t pgoff, void*& map, size_t& map_size, uint32_t*& producer, uint32_t*& consumer, void*& descriptors)
+{
+    map_size = offset.desc + size * descriptor;
+    map = ::mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, socket, pgoff);
+    if (map == MAP_FAILED)
+    {
+        map = nullptr;
+        return false;
+    }
+
+    uint8_t* base = (uint8_t*)map;
+    producer = (uint32_t*)(base + offset.producer);
+    consumer = (uint32_t*)(base + offset.consumer);
+    descriptors = base + offset.desc;
+    return true;
+}
+
+#endif
+
+//! @endcond
+
+UDPXdp::UDPXdp() noexcept
+    : _socket(-1),
+      _program(-1),
+      _map(-1),
+      _link(-1),
+      _port(0),
+      _umem(nullptr),
+      _umem_size(0),
+      _frames(0),
+      _fill(),
+      _completion(),
+      _rx(),
+      _tx(),
+      _rx_peeked(0),
+      _mac(),
+      _address(0),
+      _datagrams_received(0),
+      _datagrams_sent(0)
+{
+}
+
+bool UDPXdp::IsSupported() noexcept
+{
+#if defined(__linux__)
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool UDPXdp::Open(const std::string& interface, int queue, int port, size_t frames, asio::error_code& ec)
+{
+    ec.clear();
+
+    if (IsOpened())
+        return true;
+
+#if defined(__linux__)
+    auto fail = [this, &ec]()
+    {
+        ec = std::error_code(errno, std::system_category());
+        Close();
+        return false;
+    };
+
+    _port = (uint16_t)port;
+    _frames = std::max(frames, (size_t)64);
+    uint32_t ring_size = 1;
+    while (ring_size < (_frames / 2))
+        ring_size <<= 1;
+    _frames = 2 * ring_size;
+
+    // Resolve the network interface
+    unsigned ifindex = ::if_nametoindex(interface.c_str());
+    if (ifindex == 0)
+        return fail();
+
+    // Get the interface link layer and network addresses (network address is optional)
+    int control = ::socket(AF_INET, SOCK_DGRAM, 0);
+    if (control < 0)
+        return fail();
+    ifreq request;
+    std::memset(&request, 0, sizeof(request));
+    std::strncpy(request.ifr_name, interface.c_str(), IFNAMSIZ - 1);
+    if (::ioctl(control, SIOCGIFHWADDR, &request) == 0)
+        std::memcpy(_mac.data(), request.ifr_hwaddr.sa_data, _mac.size());
+    if (::ioctl(control, SIOCGIFADDR, &request) == 0)
+        _address = Read32((const uint8_t*)&((sockaddr_in*)&request.ifr_addr)->sin_addr);
+    ::close(control);
+
+    // Create the AF_XDP socket
+    _socket = ::socket(AF_XDP, SOCK_RAW, 0);
+    if (_socket < 0)
+        return fail();
+
+    // Register the UMEM frames area
+    _umem_size = _frames * FRAME_SIZE;
+    void* umem = ::mmap(nullptr, _umem_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (umem == MAP_FAILED)
+        return fail();
+    _umem = (uint8_t*)umem;
+
+    xdp_umem_reg registration;
+    std::memset(&registration, 0, sizeof(registration));
+    registration.addr = (uint64_t)(uintptr_t)_umem;
+    registration.len = _umem_size;
+    registration.chunk_size = FRAME_SIZE;
+    registration.headroom = 0;
+    if (::setsockopt(_socket, SOL_XDP, XDP_UMEM_REG, &registration, sizeof(registration)) != 0)
+        return fail();
+
+    // Create and map rings
+    if ((::setsockopt(_socket, SOL_XDP, XDP_UMEM_FILL_RING, &ring_size, sizeof(ring_size)) != 0) ||
+        (::setsockopt(_socket, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ring_size, sizeof(ring_size)) != 0) ||
+        (::setsockopt(_socket, SOL_XDP, XDP_RX_RING, &ring_size, sizeof(ring_size)) != 0) ||
+        (::setsockopt(_socket, SOL_XDP, XDP_TX_RING, &ring_size, sizeof(ring_size)) != 0))
+        return fail();
+
+    xdp_mmap_offsets offsets;
+    socklen_t length = sizeof(offsets);
+    if (::getsockopt(_socket, SOL_XDP, XDP_MMAP_OFFSETS, &offsets, &length) != 0)
+        return fail();
+
+    _fill.size = _completion.size = _rx.size = _tx.size = ring_size;
+    if (!MapRing(_socket, offsets.fr, ring_size, sizeof(uint64_t), XDP_UMEM_PGOFF_FILL_RING, _fill.map, _fill.map_size, _fill.producer, _fill.consumer, _fill.descriptors) ||
+        !MapRing(_socket, offsets.cr, ring_size, sizeof(uint64_t), XDP_UMEM_PGOFF_COMPLETION_RING, _completion.map, _completion.map_size, _completion.producer, _completion.consumer, _completion.descriptors) ||
+        !MapRing(_socket, offsets.rx, ring_size, sizeof(xdp_desc), XDP_PGOFF_RX_RING, _rx.map, _rx.map_size, _rx.producer, _rx.consumer, _rx.descriptors) ||
+        !MapRing(_socket, offsets.tx, ring_size, sizeof(xdp_desc), XDP_PGOFF_TX_RING, _tx.map, _tx.map_size, _tx.producer, _tx.consumer, _tx.descriptors))
+        return fail();
+
+    // Give the first half of frames to the kernel for receive
+    uint64_t* fill = (uint64_t*)_fill.descriptors;
+    for (uint32_t i = 0; i < ring_size; ++i)
+        fill[i] = (uint64_t)i * FRAME_SIZE;
+    __atomic_store_n(_fill.producer, ring_size, __ATOMIC_RELEASE);
+
+    // Keep the second half of frames for transmit
+    _tx_frames.clear();
+    for (size_t i = ring_size; i < _frames; ++i)
+        _tx_frames.push_back((uint64_t)i * FRAME_SIZE);
+
+    // Bind the socket to the interface queue in the copy mode (generic XDP)
+    sockaddr_xdp address;
+    std::memset(&address, 0, sizeof(address));
+    address.sxdp_family = AF_XDP;
+    address.sxdp_flags = XDP_COPY;
+    address.sxdp_ifindex = ifindex;
+    address.sxdp_queue_id = (uint32_t)queue;
+    if (::bind(_socket, (sockaddr*)&address, sizeof(address)) != 0)
+        return fail();
+
+    // Create the AF_XDP sockets map
+    bpf_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.map_type = BPF_MAP_TYPE_XSKMAP;
+    attr.key_size = sizeof(uint32_t);
+    attr.value_size = sizeof(uint32_t);
+    attr.max_entries = (uint32_t)queue + 1;
+    _map = BPF(BPF_MAP_CREATE, attr);
+    if (_map < 0)
+        return fail();
+
+    uint32_t key = (uint32_t)queue;
+    uint32_t value = (uint32_t)_socket;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.map_fd = (uint32_t)_map;
+    attr.key = (uint64_t)(uintptr_t)&key;
+    attr.value = (uint64_t)(uintptr_t)&value;
+    if (BPF(BPF_MAP_UPDATE_ELEM, attr) != 0)
+        return fail();
+
+    // Load the XDP program
+    auto program = Program(_map, _port);
+    static const char license[] = "Dual MIT/GPL";
+    std::memset(&attr, 0, sizeof(attr));
+    attr.prog_type = BPF_PROG_TYPE_XDP;
+    attr.insn_cnt = (uint32_t)program.size();
+    attr.insns = (uint64_t)(uintptr_t)program.data();
+    attr.license = (uint64_t)(uintptr_t)license;
+    _program = BPF(BPF_PROG_LOAD, attr);
+    if (_program < 0)
+        return fail();
+
+    // Attach the XDP program to the interface in the generic mode (detached when the link is closed)
+    std::memset(&attr, 0, sizeof(attr));
+    attr.link_create.prog_fd = (uint32_t)_program;
+    attr.link_create.target_ifindex = ifindex;
+    attr.link_create.attach_type = BPF_XDP;
+    attr.link_create.flags = XDP_FLAGS_SKB_MODE;
+    _link = BPF(BPF_LINK_CREATE, attr);
+    if (_link < 0)
+        return fail();
+
+    return true;
+#else
+    ec = asio::error::operation_not_supported;
+    return false;
+#endif
+}
+
+void UDPXdp::Close() noexcept
+{
+#if defined(__linux__)
+    if (_link >= 0)
+        ::close(_link);
+    if (_program >= 0)
+        ::close(_program);
+    if (_map >= 0)
+        ::close(_map);
+    if (_socket >= 0)
+        ::close(_socket);
+    for (Ring* ring : { &_fill, &_completion, &_rx, &_tx })
+    {
+        if (ring->map != nullptr)
+            ::munmap(ring->map, ring->map_size);
+        *ring = Ring();
+    }
+    if (_umem != nullptr)
+        ::munmap(_umem, _umem_size);
+#endif
+    _link = _program = _map = _socket = -1;
+    _umem = nullptr;
+    _umem_size = 0;
+    _rx_peeked = 0;
+    _tx_frames.clear();
+    _neighbors.clear();
+}
+
+size_t UDPXdp::Receive(UDPDatagram* datagrams, size_t count)
+{
+#if defined(__linux__)
+    if (!IsOpened())
+        return 0;
+
+    // Release frames of previously received datagrams
+    Release();
+
+    uint32_t consumer = *_rx.consumer;
+    uint32_t available = __atomic_load_n(_rx.producer, __ATOMIC_ACQUIRE) - consumer;
+    _rx_peeked = (uint32_t)std::min((size_t)available, count);
+
+    // Parse received frames in place
+    size_t received = 0;
+    const xdp_desc* descriptors = (const xdp_desc*)_rx.descriptors;
+    std::lock_guard<std::mutex> locker(_tx_lock);
+    for (uint32_t i = 0; i < _rx_peeked; ++i)
+    {
+        const xdp_desc& descriptor = descriptors[(consumer + i) & (_rx.size - 1)];
+        const uint8_t* frame = _umem + descriptor.addr;
+        if (descriptor.len < HEADERS_SIZE)
+            continue;
+
+        size_t size = std::min((size_t)Read16(frame + 38), (size_t)descriptor.len - (HEADERS_SIZE - 8));
+        if (size < 8)
+            continue;
+
+        // Remember the link layer address of the client
+        uint32_t address = Read32(frame + 26);
+        std::array<uint8_t, 6> mac;
+        std::memcpy(mac.data(), frame + 6, mac.size());
+        _neighbors[address] = mac;
+
+        datagrams[received].endpoint = asio::ip::udp::endpoint(asio::ip::address_v4(address), Read16(frame + 34));
+        datagrams[received].buffer = frame + HEADERS_SIZE;
+        datagrams[received].size = size - 8;
+        ++received;
+    }
+
+    // Update statistic
+    _datagrams_received += received;
+
+    return received;
+#else
+    return 0;
+#endif
+}
+
+void UDPXdp::Release()
+{
+#if defined(__linux__)
+    if (_rx_peeked == 0)
+        return;
+
+    // Return frames to the fill ring (it always has room for all receive frames)
+    uint32_t consumer = *_rx.consumer;
+    uint32_t producer = *_fill.producer;
+    const xdp_desc* descriptors = (const xdp_desc*)_rx.descriptors;
+    uint64_t* fill = (uint64_t*)_fill.descriptors;
+    for (uint32_t i = 0; i < _rx_peeked; ++i)
+        fill[(producer + i) & (_fill.size - 1)] = descriptors[(consumer + i) & (_rx.size - 1)].addr & ~(uint64_t)(FRAME_SIZE - 1);
+    __atomic_store_n(_fill.producer, producer + _rx_peeked, __ATOMIC_RELEASE);
+    __atomic_store_n(_rx.consumer, consumer + _rx_peeked, __ATOMIC_RELEASE);
+    _rx_peeked = 0;
+#endif
+}
+
+void UDPXdp::Complete()
+{
+#if defined(__linux__)
+    uint32_t consumer = *_completion.consumer;
+    uint32_t completed = __atomic_load_n(_completion.producer, __ATOMIC_ACQUIRE) - consumer;
+    const uint64_t* addresses = (const uint64_t*)_completion.descriptors;
+    for (uint32_t i = 0; i < completed; ++i)
+        _tx_frames.push_back(addresses[(consumer + i) & (_completion.size - 1)]);
+    __atomic_store_n(_completion.consumer, consumer + completed, __ATOMIC_RELEASE);
+#endif
+}
+
+size_t UDPXdp::Send(const UDPDatagram* datagrams, size_t count, asio::error_code& ec)
+{
+    ec.clear();
+
+#if defined(__linux__)
+    if (!IsOpened() || (_address == 0))
+        return 0;
+
+    std::lock_guard<std::mutex> locker(_tx_lock);
+
+    // Reclaim transmitted frames
+    Complete();
+
+    uint32_t producer = *_tx.producer;
+    xdp_desc* descriptors = (xdp_desc*)_tx.descriptors;
+
+    size_t sent = 0;
+    for (; (sent < count) && !_tx_frames.empty(); ++sent)
+    {
+        const UDPDatagram& datagram = datagrams[sent];
+        if (!datagram.endpoint.address().is_v4() || ((datagram.size + HEADERS_SIZE) > FRAME_SIZE))
+            break;
+
+        // Resolve the link layer address of the endpoint
+        uint32_t address = datagram.endpoint.address().to_v4().to_uint();
+        std::array<uint8_t, 6> mac;
+        if ((address >> 28) == 0xE)
+            mac = { 0x01, 0x00, 0x5E, (uint8_t)((address >> 16) & 0x7F), (uint8_t)(address >> 8), (uint8_t)address };
+        else if (address == 0xFFFFFFFF)
+            mac = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+        else
+        {
+            auto it = _neighbors.find(address);
+            if (it == _neighbors.end())
+                break;
+            mac = it->second;
+        }
+
+        uint64_t frame_address = _tx_frames.back();
+        _tx_frames.pop_back();
+        uint8_t* frame = _umem + frame_address;
+
+        // Ethernet header
+        std::memcpy(frame, mac.data(), 6);
+        std::memcpy(frame + 6, _mac.data(), 6);
+        Write16(frame + 12, 0x0800);
+
+        // IPv4 header
+        uint8_t* ip = frame + 14;
+        ip[0] = 0x45;
+        ip[1] = 0;
+        Write16(ip + 2, (uint16_t)(20 + 8 + datagram.size));
+        Write16(ip + 4, 0);
+        Write16(ip + 6, 0x4000);
+        ip[8] = ((address >> 28) == 0xE) ? 1 : 64;
+        ip[9] = 17;
+        Write16(ip + 10, 0);
+        Write32(ip + 12, _address);
+        Write32(ip + 16, address);
+        uint32_t checksum = 0;
+        for (size_t i = 0; i < 20; i += 2)
+            checksum += Read16(ip + i);
+        while (checksum >> 16)
+            checksum = (checksum & 0xFFFF) + (checksum >> 16);
+        Write16(ip + 10, (uint16_t)~checksum);
+
+        // UDP header without the optional IPv4 checksum
+        uint8_t* udp = ip + 20;
+        Write16(udp, _port);
+        Write16(udp + 2, datagram.endpoint.port());
+        Write16(udp + 4, (uint16_t)(8 + datagram.size));
+        Write16(udp + 6, 0);
+        if (datagram.size > 0)
+            std::memcpy(udp + 8, datagram.buffer, datagram.size);
+
+        xdp_desc& descriptor = descriptors[(producer + sent) & (_tx.size - 1)];
+        descriptor.addr = frame_address;
+        descriptor.len = (uint32_t)(HEADERS_SIZE + datagram.size);
+        descriptor.options = 0;
+    }
+
+    if (sent == 0)
+        return 0;
+
+    // Publish frames and kick the kernel to transmit them
+    __atomic_store_n(_tx.producer, producer + (uint32_t)sent, __ATOMIC_RELEASE);
+    if (::sendto(_socket, nullptr, 0, MSG_DONTWAIT, nullptr, 0) < 0)
+    {
+        if ((errno != EAGAIN) && (errno != EBUSY) && (errno != ENOBUFS))
+            ec = std::error_code(errno, std::system_category());
+    }
+
+    // Update statistic
+    _datagrams_sent += sent;
+
+    return sent;
+#else
+    return 0;
+#endif
+}
+
+} // namespace Asio
+} // namespace CppServer
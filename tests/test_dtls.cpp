@@ -0,0 +1,237 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "server/asio/dtls_client.h"
+#include "server/asio/dtls_server.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+namespace {
+
+std::shared_ptr<SSLContext> CreateServerContext()
+{
+    auto context = std::make_shared<SSLContext>(SSL_CTX_new(DTLS_method()));
+    context->set_password_callback([](size_t max_length, asio::ssl::context::password_purpose purpose) -> std::string { return "qwerty"; });
+    context->use_certificate_chain_file("../tools/certificates/server.pem");
+    context->use_private_key_file("../tools/certificates/server.pem", asio::ssl::context::pem);
+    return context;
+}
+
+std::shared_ptr<SSLContext> CreateClientContext()
+{
+    auto context = std::make_shared<SSLContext>(SSL_CTX_new(DTLS_method()));
+    context->set_verify_mode(asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert);
+    context->load_verify_file("../tools/certificates/ca.pem");
+    return context;
+}
+
+// Transmit all output datagrams of the sender to the receiver
+size_t Transmit(DTLSProtocol& sender, DTLSProtocol& receiver)
+{
+    RUDPQueue output;
+    sender.TakeOutput(output);
+
+    const uint8_t* datagram = output.buffer.data();
+    for (size_t size : output.sizes)
+    {
+        receiver.Input(datagram, size);
+        datagram += size;
+    }
+    return output.sizes.size();
+}
+
+std::vector<std::string> Delivered(DTLSProtocol& receiver)
+{
+    RUDPQueue delivered;
+    receiver.TakeDelivered(delivered);
+
+    std::vector<std::string> messages;
+    const uint8_t* message = delivered.buffer.data();
+    for (size_t size : delivered.sizes)
+    {
+        messages.emplace_back((const char*)message, size);
+        message += size;
+    }
+    return messages;
+}
+
+class EchoDTLSSession : public DTLSSession
+{
+public:
+    using DTLSSession::DTLSSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+};
+
+class EchoDTLSServer : public DTLSServer
+{
+public:
+    using DTLSServer::DTLSServer;
+
+protected:
+    std::shared_ptr<DTLSSession> CreateSession(std::shared_ptr<DTLSServer> server, const asio::ip::udp::endpoint& endpoint) override { return std::make_shared<EchoDTLSSession>(server, endpoint); }
+
+protected:
+    void onStarted() override { ReceiveAsync(); }
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override { DTLSServer::onReceived(endpoint, buffer, size); ReceiveAsync(); }
+};
+
+class EchoDTLSClient : public DTLSClient
+{
+public:
+    std::atomic<bool> handshaked;
+    std::atomic<size_t> messages;
+    std::atomic<bool> errors;
+
+    EchoDTLSClient(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context, const std::string& address, int port) : DTLSClient(service, context, address, port), handshaked(false), messages(0), errors(false) {}
+
+protected:
+    void onHandshaked() override { handshaked = true; }
+    void onReceived(const void* buffer, size_t size) override { ++messages; }
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+};
+
+} // namespace
+
+TEST_CASE("DTLS protocol cookie exchange test", "[CppServer][Asio]")
+{
+    auto server_context = CreateServerContext();
+    auto client_context = CreateClientContext();
+    DTLSProtocol::SetupCookieExchange(server_context->native_handle());
+
+    uint8_t secret[DTLSProtocol::COOKIE_SECRET_SIZE] = { 1, 2, 3 };
+
+    DTLSProtocol listener;
+    listener.SetupCookie(secret, "peer");
+    REQUIRE(listener.Open(server_context->native_handle(), true));
+
+    DTLSProtocol client;
+    REQUIRE(client.Open(client_context->native_handle(), false));
+    REQUIRE(client.Send("early", 5));
+    REQUIRE(client.send_queued() == 1);
+    REQUIRE(client.Connect());
+
+    // ClientHello without the cookie is replied with HelloVerifyRequest
+    RUDPQueue hello;
+    client.TakeOutput(hello);
+    REQUIRE(hello.sizes.size() == 1);
+    REQUIRE(!listener.Listen(hello.buffer.data(), hello.sizes[0]));
+    REQUIRE(listener.cookies_sent() == 1);
+    REQUIRE(Transmit(listener, client) == 1);
+
+    // ClientHello with the cookie is verified only for the same peer
+    client.TakeOutput(hello);
+    REQUIRE(hello.sizes.size() == 1);
+    REQUIRE(listener.Listen(hello.buffer.data(), hello.sizes[0]));
+    listener.SetupCookie(secret, "other");
+    REQUIRE(!listener.Listen(hello.buffer.data(), hello.sizes[0]));
+
+    // Server session performs the handshake with the verified ClientHello
+    DTLSProtocol server;
+    server.SetupCookie(secret, "peer");
+    REQUIRE(server.Open(server_context->native_handle(), true));
+    REQUIRE(server.Input(hello.buffer.data(), hello.sizes[0]));
+    REQUIRE(!server.IsListening());
+    for (size_t i = 0; (i < 10) && !(client.IsHandshaked() && server.IsHandshaked()); ++i)
+    {
+        Transmit(server, client);
+        Transmit(client, server);
+    }
+    REQUIRE(client.IsHandshaked());
+    REQUIRE(server.IsHandshaked());
+    REQUIRE(!client.IsFailed());
+    REQUIRE(!server.IsFailed());
+
+    // Queued message is sent after the handshake
+    auto messages = Delivered(server);
+    REQUIRE(messages.size() == 1);
+    REQUIRE(messages[0] == "early");
+
+    // Each message is sent in the single datagram
+    for (size_t i = 0; i < 100; ++i)
+        REQUIRE(server.Send(std::to_string(i).data(), std::to_string(i).size()));
+    REQUIRE(Transmit(server, client) == 100);
+    messages = Delivered(client);
+    REQUIRE(messages.size() == 100);
+    for (size_t i = 0; i < 100; ++i)
+        REQUIRE(messages[i] == std::to_string(i));
+
+    // Too large messages are rejected
+    std::vector<uint8_t> large(DTLSProtocol::MAX_PAYLOAD + 1);
+    REQUIRE(!client.Send(large.data(), large.size()));
+
+    // Close notify alert closes the peer protocol
+    client.Shutdown();
+    Transmit(client, server);
+    REQUIRE(server.IsClosed());
+}
+
+TEST_CASE("DTLS session test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3345;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoDTLSServer>(service, CreateServerContext(), port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoDTLSClient>(service, CreateClientContext(), address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->handshaked)
+        Thread::Yield();
+
+    // Send encrypted messages to the Echo server
+    const size_t count = 100;
+    for (size_t i = 0; i < count; ++i)
+        REQUIRE(client->SendAsync(std::to_string(i)));
+
+    // Wait for all echo messages...
+    while (client->messages != count)
+        Thread::Yield();
+
+    // Check the session was created after the cookie exchange
+    REQUIRE(server->connected_sessions() == 1);
+    REQUIRE(server->cookies_sent() == 1);
+    REQUIRE(server->cookies_verified() == 1);
+    REQUIRE(server->handshakes() == 1);
+    REQUIRE(server->handshakes_failed() == 0);
+    REQUIRE(!client->errors);
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Wait for the session disconnected with the close notify alert
+    while (server->connected_sessions() != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
@@ -0,0 +1,287 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "server/asio/feed_client.h"
+#include "server/asio/feed_publisher.h"
+#include "server/asio/feed_retransmit.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+namespace {
+
+// Publish messages over the lossy link, recover gaps from the history and collect delivered ones
+void Simulate(FeedHistory& history, FeedReceiver& receiver, size_t count, int loss, std::vector<std::string>& messages, uint64_t& lost)
+{
+    std::mt19937 random(1);
+    std::vector<std::pair<uint64_t, std::vector<uint8_t>>> packets;
+    std::vector<FeedRange> requests;
+    FeedQueue delivered;
+
+    uint64_t timestamp = 1000000000;
+    for (size_t step = 0; step < 100000; ++step)
+    {
+        timestamp += 100000;
+
+        // Publish the next message, drop it or delay it for the random time (reordering).
+        // The last message is never dropped, because the tail loss is not detectable.
+        if (step < count)
+        {
+            std::string message = "message " + std::to_string(history.next());
+            uint64_t sequence = history.Store(message.data(), message.size());
+            std::vector<uint8_t> packet(FeedProtocol::HEADER_SIZE + message.size());
+            FeedProtocol::WriteHeader(packet.data(), sequence);
+            std::memcpy(packet.data() + FeedProtocol::HEADER_SIZE, message.data(), message.size());
+            if (((step + 1) == count) || ((int)(random() % 100) >= loss))
+                packets.push_back({ timestamp + (random() % 5) * 100000, packet });
+        }
+
+        // Deliver delayed packets
+        for (auto it = packets.begin(); it != packets.end();)
+        {
+            if (it->first <= timestamp)
+            {
+                receiver.Input(it->second.data(), it->second.size(), timestamp);
+                it = packets.erase(it);
+            }
+            else
+                ++it;
+        }
+
+        // Serve retransmit requests from the history
+        receiver.Flush(timestamp);
+        receiver.TakeRequests(requests);
+        for (const auto& request : requests)
+        {
+            FeedQueue recovered;
+            history.Copy(request.sequence, request.count, recovered);
+            uint64_t first = recovered.empty() ? (request.sequence + request.count) : recovered.entries.front().sequence;
+            if (first > request.sequence)
+                receiver.Unavailable(request.sequence, first - request.sequence);
+            const uint8_t* message = recovered.buffer.data();
+            for (const auto& entry : recovered.entries)
+            {
+                receiver.Recover(entry.sequence, message, entry.size, timestamp);
+                message += entry.size;
+            }
+        }
+
+        // Collect delivered messages
+        receiver.TakeDelivered(delivered);
+        const uint8_t* message = delivered.buffer.data();
+        for (const auto& entry : delivered.entries)
+        {
+            if (entry.lost > 0)
+            {
+                for (uint64_t i = 0; i < entry.lost; ++i)
+                    messages.emplace_back();
+                lost += entry.lost;
+                continue;
+            }
+            messages.emplace_back((const char*)message, entry.size);
+            message += entry.size;
+        }
+
+        if ((step >= count) && packets.empty() && !receiver.IsPending())
+            break;
+    }
+}
+
+class FeedService : public Service
+{
+public:
+    std::atomic<bool> errors;
+
+    FeedService() : errors(false) {}
+
+protected:
+    void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
+};
+
+class LossyFeedClient : public FeedClient
+{
+public:
+    std::atomic<bool> connected;
+    std::atomic<size_t> messages;
+    std::atomic<size_t> dropped;
+    std::atomic<uint64_t> lost;
+    std::atomic<bool> ordered;
+
+    LossyFeedClient(std::shared_ptr<Service> service, const std::string& address, int port)
+        : FeedClient(service, address, port),
+          connected(false),
+          messages(0),
+          dropped(0),
+          lost(0),
+          ordered(true)
+    {
+    }
+
+protected:
+    void onConnected() override { connected = true; ReceiveAsync(); }
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override
+    {
+        // Inject packet loss: drop every 7th feed packet
+        if ((size >= FeedProtocol::HEADER_SIZE) && ((FeedProtocol::ReadHeader((const uint8_t*)buffer) % 7) == 3))
+        {
+            ++dropped;
+            ReceiveAsync();
+            return;
+        }
+
+        FeedClient::onReceived(endpoint, buffer, size);
+    }
+    void onReceived(uint64_t sequence, const void* buffer, size_t size) override
+    {
+        if ((sequence != (messages + 1)) || (std::string((const char*)buffer, size) != std::to_string(sequence)))
+            ordered = false;
+        ++messages;
+    }
+    void onLost(uint64_t sequence, uint64_t count) override { lost += count; }
+};
+
+} // namespace
+
+TEST_CASE("Feed receiver test", "[CppServer][Asio]")
+{
+    // Recover all lost messages from the history
+    {
+        FeedHistory history(100000, 64);
+        FeedReceiver receiver;
+        std::vector<std::string> messages;
+        uint64_t lost = 0;
+        Simulate(history, receiver, 10000, 10, messages, lost);
+
+        REQUIRE(messages.size() == 10000);
+        for (size_t i = 0; i < messages.size(); ++i)
+            REQUIRE(messages[i] == ("message " + std::to_string(i + 1)));
+        REQUIRE(lost == 0);
+        REQUIRE(receiver.gaps_detected() > 0);
+        REQUIRE(receiver.messages_recovered() > 0);
+        REQUIRE(receiver.messages_reordered() > 0);
+        REQUIRE(receiver.reorder_buffered() == 0);
+    }
+
+    // Report messages which are not available in the short history as lost
+    {
+        FeedHistory history(1, 64);
+        FeedReceiver receiver;
+        receiver.SetupReorderDelay(Timespan::milliseconds(5));
+        std::vector<std::string> messages;
+        uint64_t lost = 0;
+        Simulate(history, receiver, 10000, 10, messages, lost);
+
+        REQUIRE(messages.size() == 10000);
+        REQUIRE(lost > 0);
+        REQUIRE(receiver.messages_lost() == lost);
+        for (size_t i = 0; i < messages.size(); ++i)
+            REQUIRE((messages[i].empty() || (messages[i] == ("message " + std::to_string(i + 1)))));
+    }
+
+    // Declare the oldest gap lost when the reorder buffer overflows
+    {
+        FeedReceiver receiver;
+        receiver.SetupReorderWindow(2);
+        FeedQueue delivered;
+        uint8_t packet[FeedProtocol::HEADER_SIZE];
+        for (uint64_t sequence : { 1, 3, 4, 5 })
+        {
+            FeedProtocol::WriteHeader(packet, sequence);
+            REQUIRE(receiver.Input(packet, sizeof(packet), 0));
+        }
+        receiver.TakeDelivered(delivered);
+        REQUIRE(delivered.entries.size() == 5);
+        REQUIRE(delivered.entries[1].sequence == 2);
+        REQUIRE(delivered.entries[1].lost == 1);
+        REQUIRE(receiver.next() == 6);
+        REQUIRE(!receiver.IsPending());
+    }
+}
+
+TEST_CASE("Feed multicast recovery test", "[CppServer][Asio]")
+{
+    const std::string listen_address = "0.0.0.0";
+    const std::string multicast_address = "239.255.0.1";
+    const int multicast_port = 3344;
+    const std::string retransmit_address = "127.0.0.1";
+    const int retransmit_port = 2225;
+
+    // Create and start Asio service
+    auto service = std::make_shared<FeedService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create the feed history
+    auto history = std::make_shared<FeedHistory>(1024);
+
+    // Create and start the retransmit server
+    auto retransmit = std::make_shared<FeedRetransmitServer>(service, retransmit_port, history);
+    REQUIRE(retransmit->Start());
+    while (!retransmit->IsStarted())
+        Thread::Yield();
+
+    // Create and start the feed publisher
+    auto publisher = std::make_shared<FeedPublisher>(service, 0, history);
+    REQUIRE(publisher->Start(multicast_address, multicast_port));
+    while (!publisher->IsStarted())
+        Thread::Yield();
+
+    // Create and connect the lossy feed client
+    auto client = std::make_shared<LossyFeedClient>(service, listen_address, multicast_port);
+    client->SetupMulticast(true);
+    client->SetupRecovery(retransmit_address, retransmit_port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->connected)
+        Thread::Yield();
+
+    // Join multicast group
+    client->JoinMulticastGroup(multicast_address);
+
+    // Publish messages
+    for (int i = 1; i <= 100; ++i)
+        REQUIRE(publisher->Publish(std::to_string(i)) == (uint64_t)i);
+
+    // Wait for all messages received or recovered...
+    while (client->messages != 100)
+        Thread::Yield();
+
+    // Disconnect the feed client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the feed publisher
+    REQUIRE(publisher->Stop());
+    while (publisher->IsStarted())
+        Thread::Yield();
+
+    // Stop the retransmit server
+    REQUIRE(retransmit->Stop());
+    while (retransmit->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the feed state
+    REQUIRE(client->ordered);
+    REQUIRE(client->lost == 0);
+    REQUIRE(client->dropped > 0);
+    REQUIRE(client->receiver().messages_recovered() == client->dropped);
+    REQUIRE(publisher->messages_published() == 100);
+    REQUIRE(retransmit->messages_retransmitted() >= client->dropped);
+    REQUIRE(!service->errors);
+}
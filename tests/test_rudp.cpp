@@ -0,0 +1,237 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "server/asio/rudp_client.h"
+#include "server/asio/rudp_session.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppServer::Asio;
+
+namespace {
+
+// Lossy link simulator which drops, delays and reorders packets
+class LossyLink
+{
+public:
+    LossyLink(unsigned seed, int loss) : _random(seed), _loss(loss) {}
+
+    void Transmit(RUDPProtocol& sender, uint64_t timestamp)
+    {
+        RUDPQueue output;
+        sender.TakeOutput(output);
+
+        const uint8_t* packet = output.buffer.data();
+        for (size_t size : output.sizes)
+        {
+            // Drop the packet or delay it for the random time (reordering)
+            if ((int)(_random() % 100) >= _loss)
+                _packets.push_back({ timestamp + 5000000 + (_random() % 10) * 1000000, std::vector<uint8_t>(packet, packet + size) });
+            packet += size;
+        }
+    }
+
+    void Deliver(RUDPProtocol& receiver, uint64_t timestamp)
+    {
+        for (auto it = _packets.begin(); it != _packets.end();)
+        {
+            if (it->first <= timestamp)
+            {
+                receiver.Input(it->second.data(), it->second.size(), timestamp);
+                it = _packets.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+private:
+    std::mt19937 _random;
+    int _loss;
+    std::vector<std::pair<uint64_t, std::vector<uint8_t>>> _packets;
+};
+
+// Send messages over the lossy link and collect delivered ones
+std::vector<std::string> Simulate(RUDPProtocol& sender, RUDPProtocol& receiver, size_t count)
+{
+    LossyLink forward(1, 20);
+    LossyLink backward(2, 20);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string message = "message " + std::to_string(i);
+        REQUIRE(sender.Send(message.data(), message.size()));
+    }
+
+    std::vector<std::string> messages;
+    RUDPQueue delivered;
+    uint64_t timestamp = 1000000000;
+    for (size_t step = 0; (step < 600000) && ((messages.size() < count) || sender.IsPending()); ++step)
+    {
+        timestamp += 1000000;
+
+        sender.Flush(timestamp);
+        forward.Transmit(sender, timestamp);
+        forward.Deliver(receiver, timestamp);
+
+        receiver.Flush(timestamp);
+        backward.Transmit(receiver, timestamp);
+        backward.Deliver(sender, timestamp);
+
+        receiver.TakeDelivered(delivered);
+        const uint8_t* message = delivered.buffer.data();
+        for (size_t size : delivered.sizes)
+        {
+            messages.emplace_back((const char*)message, size);
+            message += size;
+        }
+    }
+    return messages;
+}
+
+class EchoRUDPSession : public RUDPSession
+{
+public:
+    using RUDPSession::RUDPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+};
+
+class EchoRUDPServer : public UDPServer
+{
+public:
+    using UDPServer::UDPServer;
+
+protected:
+    std::shared_ptr<UDPSession> CreateSession(std::shared_ptr<UDPServer> server, const asio::ip::udp::endpoint& endpoint) override { return std::make_shared<EchoRUDPSession>(server, endpoint); }
+
+protected:
+    void onStarted() override { ReceiveAsync(); }
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override { UDPServer::onReceived(endpoint, buffer, size); ReceiveAsync(); }
+};
+
+class EchoRUDPClient : public RUDPClient
+{
+public:
+    std::atomic<bool> connected;
+    std::atomic<size_t> messages;
+    std::atomic<bool> ordered;
+
+    EchoRUDPClient(std::shared_ptr<Service> service, const std::string& address, int port) : RUDPClient(service, address, port), connected(false), messages(0), ordered(true) {}
+
+protected:
+    void onConnected() override { connected = true; ReceiveAsync(); }
+    void onReceived(const void* buffer, size_t size) override
+    {
+        if (std::string((const char*)buffer, size) != std::to_string(messages))
+            ordered = false;
+        ++messages;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Reliable UDP protocol ordered delivery test", "[CppServer][Asio]")
+{
+    const size_t count = 1000;
+
+    RUDPProtocol sender;
+    RUDPProtocol receiver;
+
+    auto messages = Simulate(sender, receiver, count);
+
+    // Check all messages were delivered exactly once in order
+    REQUIRE(messages.size() == count);
+    for (size_t i = 0; i < count; ++i)
+        REQUIRE(messages[i] == ("message " + std::to_string(i)));
+
+    // Check the lossy link caused retransmissions
+    REQUIRE(sender.packets_retransmitted() > 0);
+    REQUIRE(sender.messages_sent() == count);
+    REQUIRE(receiver.messages_received() == count);
+    REQUIRE(!sender.IsPending());
+}
+
+TEST_CASE("Reliable UDP protocol unordered delivery test", "[CppServer][Asio]")
+{
+    const size_t count = 1000;
+
+    RUDPProtocol sender;
+    RUDPProtocol receiver;
+    sender.SetupCongestionControl(false);
+    sender.SetupWindow(64, 64);
+    receiver.SetupOrdered(false);
+
+    auto messages = Simulate(sender, receiver, count);
+
+    // Check all messages were delivered exactly once
+    REQUIRE(messages.size() == count);
+    std::set<std::string> unique(messages.begin(), messages.end());
+    REQUIRE(unique.size() == count);
+
+    // Check the lossy link caused retransmissions
+    REQUIRE(sender.packets_retransmitted() > 0);
+    REQUIRE(sender.send_inflight() <= 64);
+}
+
+TEST_CASE("Reliable UDP session test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3339;
+
+    // Create and start Asio service
+    auto service = std::make_shared<Service>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoRUDPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoRUDPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->connected)
+        Thread::Yield();
+
+    // Send reliable messages to the Echo server
+    const size_t count = 100;
+    for (size_t i = 0; i < count; ++i)
+        REQUIRE(client->SendAsync(std::to_string(i)));
+
+    // Wait for all echo messages...
+    while (client->messages != count)
+        Thread::Yield();
+
+    // Check the reliable session of the client
+    REQUIRE(server->connected_sessions() == 1);
+    REQUIRE(client->ordered);
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+}
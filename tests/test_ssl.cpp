@@ -4,12 +4,14 @@
 
 #include "test.h"
 
+#include "server/asio/connection_pool.h"
 #include "server/asio/ssl_client.h"
 #include "server/asio/ssl_server.h"
 #include "threads/thread.h"
 
 #include <atomic>
 #include <chrono>
+#include <mutex>
 #include <vector>
 
 using namespace CppCommon;
@@ -63,9 +65,9 @@ public:
     {
     }
 
-    static std::shared_ptr<SSLContext> CreateContext()
+    static std::shared_ptr<SSLContext> CreateContext(asio::ssl::context::method method = asio::ssl::context::tlsv12)
     {
-        auto context = std::make_shared<SSLContext>(asio::ssl::context::tlsv12);
+        auto context = std::make_shared<SSLContext>(method);
         context->set_default_verify_paths();
         context->set_root_certs();
         context->set_verify_mode(asio::ssl::verify_peer | asio::ssl::verify_fail_if_no_peer_cert);
@@ -127,9 +129,9 @@ public:
     {
     }
 
-    static std::shared_ptr<SSLContext> CreateContext()
+    static std::shared_ptr<SSLContext> CreateContext(asio::ssl::context::method method = asio::ssl::context::tlsv12)
     {
-        auto context = std::make_shared<SSLContext>(asio::ssl::context::tlsv12);
+        auto context = std::make_shared<SSLContext>(method);
         context->set_password_callback([](size_t max_length, asio::ssl::context::password_purpose purpose) -> std::string { return "qwerty"; });
         context->use_certificate_chain_file("../tools/certificates/server.pem");
         context->use_private_key_file("../tools/certificates/server.pem", asio::ssl::context::pem);
@@ -149,6 +151,90 @@ protected:
     void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
 };
 
+class ConflationSSLSession : public SSLSession
+{
+public:
+    using SSLSession::SSLSession;
+
+    static std::atomic<uint64_t> conflated;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Replace the conflated value before the send buffer is flushed
+        SendAsync("head");
+        SendConflated("key", "old");
+        SendAsync("body");
+        SendConflated("key", "new");
+        conflated = values_conflated();
+    }
+};
+
+std::atomic<uint64_t> ConflationSSLSession::conflated(0);
+
+class ConflationSSLServer : public EchoSSLServer
+{
+public:
+    using EchoSSLServer::EchoSSLServer;
+
+protected:
+    std::shared_ptr<SSLSession> CreateSession(std::shared_ptr<SSLServer> server) override { return std::make_shared<ConflationSSLSession>(server); }
+};
+
+class ConflationSSLClient : public EchoSSLClient
+{
+public:
+    using EchoSSLClient::EchoSSLClient;
+
+    std::string received()
+    {
+        std::scoped_lock locker(_received_lock);
+        return _received;
+    }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        std::scoped_lock locker(_received_lock);
+        _received.append((const char*)buffer, size);
+    }
+
+private:
+    std::mutex _received_lock;
+    std::string _received;
+};
+
+class EarlyDataSSLClient : public ConflationSSLClient
+{
+public:
+    using ConflationSSLClient::ConflationSSLClient;
+
+protected:
+    void onHandshaked() override
+    {
+        ConflationSSLClient::onHandshaked();
+
+        // Send new data right after the handshake with early data
+        SendAsync("next");
+    }
+};
+
+class EchoSSLConnectionPool : public SSLConnectionPool
+{
+public:
+    EchoSSLConnectionPool(std::shared_ptr<Service> service, std::shared_ptr<SSLContext> context)
+        : SSLConnectionPool(service),
+          _context(context)
+    {
+    }
+
+protected:
+    std::shared_ptr<PooledSSLClient> CreateClient(std::shared_ptr<Service> service, const asio::ip::tcp::endpoint& endpoint) override { return std::make_shared<PooledSSLClient>(service, _context, endpoint); }
+
+private:
+    std::shared_ptr<SSLContext> _context;
+};
+
 } // namespace
 
 TEST_CASE("SSL server test", "[CppServer][Asio]")
@@ -496,3 +582,807 @@ TEST_CASE("SSL server random test", "[CppServer][Asio]")
     REQUIRE(server->bytes_received() > 0);
     REQUIRE(!server->errors);
 }
+
+TEST_CASE("SSL server session resumption test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2226;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL server context with the session cache
+    auto server_context = EchoSSLServer::CreateContext();
+    server_context->set_session_cache(100);
+    server_context->set_session_tickets(false);
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL client context
+    auto client_context = EchoSSLClient::CreateContext();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoSSLClient>(service, client_context, address, port);
+    REQUIRE(client->option_session_resumption());
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (server->clients != 1))
+        Thread::Yield();
+    REQUIRE(!client->IsResumed());
+
+    // Send a message to the Echo server
+    client->SendAsync("test");
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Reconnect the Echo client with the last session
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (server->clients != 1))
+        Thread::Yield();
+    REQUIRE(client->IsResumed());
+
+    // Send a message to the Echo server
+    client->SendAsync("test");
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->handshakes_full() == 1);
+    REQUIRE(server->handshakes_resumed() == 1);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("SSL server kernel TLS test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2227;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL server context
+    auto server_context = EchoSSLServer::CreateContext();
+
+    // Create and start Echo server with the kernel TLS
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    server->SetupKernelTLS(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL client context
+    auto client_context = EchoSSLClient::CreateContext();
+
+    // Create and connect Echo client with the kernel TLS
+    auto client = std::make_shared<EchoSSLClient>(service, client_context, address, port);
+    client->SetupKernelTLS(true);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a message to the Echo server
+    client->SendAsync("test");
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->handshaked);
+    REQUIRE(server->bytes_sent() == 4);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->handshaked);
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(client->bytes_received() == 4);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("SSL server handshake service test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2228;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start handshake Asio service
+    auto handshake_service = std::make_shared<Service>();
+    REQUIRE(handshake_service->Start());
+    while (!handshake_service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL server context
+    auto server_context = EchoSSLServer::CreateContext();
+
+    // Create and start Echo server with the handshake service
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    server->SetupHandshakeService(handshake_service);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL client context
+    auto client_context = EchoSSLClient::CreateContext();
+
+    // Create and connect Echo clients
+    std::vector<std::shared_ptr<EchoSSLClient>> clients;
+    for (int i = 0; i < 10; ++i)
+    {
+        auto client = std::make_shared<EchoSSLClient>(service, client_context, address, port);
+        REQUIRE(client->ConnectAsync());
+        clients.emplace_back(client);
+    }
+    for (auto& client : clients)
+        while (!client->IsConnected() || !client->IsHandshaked())
+            Thread::Yield();
+    while (server->clients != 10)
+        Thread::Yield();
+
+    // Send messages to the Echo server
+    for (auto& client : clients)
+        client->SendAsync("test");
+
+    // Wait for all data processed...
+    for (auto& client : clients)
+        while (client->bytes_received() != 4)
+            Thread::Yield();
+
+    // Disconnect Echo clients
+    for (auto& client : clients)
+        REQUIRE(client->DisconnectAsync());
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop handshake Asio service
+    REQUIRE(handshake_service->Stop());
+    while (handshake_service->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->handshaked);
+    REQUIRE(server->handshakes_full() == 10);
+    REQUIRE(server->handshakes_pending() == 0);
+    REQUIRE(server->handshake_latency_max() > 0);
+    REQUIRE(server->handshake_latency_total() >= server->handshake_latency_max());
+    REQUIRE(server->handshake_queue_total() >= server->handshake_queue_max());
+    REQUIRE(server->bytes_received() == 40);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("SSL server handshake service stop test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2235;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start handshake Asio service
+    auto handshake_service = std::make_shared<Service>();
+    REQUIRE(handshake_service->Start());
+    while (!handshake_service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL server context
+    auto server_context = EchoSSLServer::CreateContext();
+
+    // Create and start Echo server with the handshake service
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    server->SetupHandshakeService(handshake_service);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL client context
+    auto client_context = EchoSSLClient::CreateContext();
+
+    // Create and connect a burst of Echo clients
+    std::vector<std::shared_ptr<EchoSSLClient>> clients;
+    for (int i = 0; i < 32; ++i)
+    {
+        auto client = std::make_shared<EchoSSLClient>(service, client_context, address, port);
+        REQUIRE(client->ConnectAsync());
+        clients.emplace_back(client);
+    }
+
+    // Stop the Echo server with handshakes in flight
+    while (!server->connected)
+        Thread::Yield();
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Wait for all offloaded handshakes handed back and sessions disconnected...
+    while ((server->handshakes_pending() != 0) || (server->connected_sessions() != 0))
+        Thread::Yield();
+
+    // Disconnect Echo clients
+    for (auto& client : clients)
+        client->DisconnectAsync();
+    for (auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+
+    // Stop handshake Asio service
+    REQUIRE(handshake_service->Stop());
+    while (handshake_service->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->handshakes_pending() == 0);
+    REQUIRE(server->connected_sessions() == 0);
+}
+
+TEST_CASE("SSL server dynamic records test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2229;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL server context
+    auto server_context = EchoSSLServer::CreateContext();
+
+    // Create and start Echo server with dynamic records
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    server->SetupDynamicRecords(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL client context
+    auto client_context = EchoSSLClient::CreateContext();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoSSLClient>(service, client_context, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a lot of small messages to the Echo server
+    std::vector<uint8_t> message(100, 'x');
+    for (int i = 0; i < 1000; ++i)
+        client->SendAsync(message.data(), message.size());
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 100000)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->handshaked);
+    REQUIRE(server->bytes_sent() == 100000);
+    REQUIRE(server->bytes_received() == 100000);
+    REQUIRE(server->records_sent() > (100000 / SSLSession::MAX_RECORD_SIZE));
+    REQUIRE(server->records_full() > 0);
+    REQUIRE(server->records_full() <= server->records_sent());
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == 100000);
+    REQUIRE(client->bytes_received() == 100000);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("SSL server idle release test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2230;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL server context
+    auto server_context = EchoSSLServer::CreateContext();
+
+    // Create and start Echo server with the idle release
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    server->SetupIdleRelease(Timespan::milliseconds(10));
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL client context
+    auto client_context = EchoSSLClient::CreateContext();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoSSLClient>(service, client_context, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a message to the Echo server
+    client->SendAsync("test");
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Wait for the idle session
+    while (server->sessions_idle() != 1)
+        Thread::Yield();
+    REQUIRE(server->buffer_pool().size() > 0);
+
+    // Wake up the idle session with a message larger than the idle buffer
+    std::string message(1000, 'x');
+    client->SendAsync(message);
+    while (client->bytes_received() != 1004)
+        Thread::Yield();
+    REQUIRE(server->buffer_pool().acquired() > 0);
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+    REQUIRE(server->sessions_idle() == 0);
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->handshaked);
+    REQUIRE(server->bytes_sent() == 1004);
+    REQUIRE(server->bytes_received() == 1004);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == 1004);
+    REQUIRE(client->bytes_received() == 1004);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("SSL server early data test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2231;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new TLS 1.3 server context with the session cache
+    auto server_context = EchoSSLServer::CreateContext(asio::ssl::context::tlsv13);
+    server_context->set_session_cache(100);
+
+    // Create and start Echo server with early data
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    server->SetupEarlyData(16384);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new TLS 1.3 client context
+    auto client_context = EchoSSLClient::CreateContext(asio::ssl::context::tlsv13);
+
+    // Create and connect Echo client with early data
+    auto client = std::make_shared<EchoSSLClient>(service, client_context, address, port);
+    client->SetupEarlyData(true);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (server->clients != 1))
+        Thread::Yield();
+    REQUIRE(!client->IsEarlyDataAccepted());
+
+    // Send a message to the Echo server to receive session tickets
+    client->SendAsync("test");
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Send a message before the handshake and reconnect the Echo client with the last session
+    REQUIRE(client->SendAsync("test"));
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (client->bytes_received() != 4))
+        Thread::Yield();
+    REQUIRE(client->IsResumed());
+    REQUIRE(client->IsEarlyDataAccepted());
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->handshakes_full() == 1);
+    REQUIRE(server->handshakes_resumed() == 1);
+    REQUIRE(server->early_data_accepted() == 1);
+    REQUIRE(server->early_data_rejected() == 0);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("SSL server early data send from handshake test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2236;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new TLS 1.3 server context with the session cache
+    auto server_context = EchoSSLServer::CreateContext(asio::ssl::context::tlsv13);
+    server_context->set_session_cache(100);
+
+    // Create and start Echo server with early data
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    server->SetupEarlyData(16384);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new TLS 1.3 client context
+    auto client_context = EarlyDataSSLClient::CreateContext(asio::ssl::context::tlsv13);
+
+    // Create and connect the client which sends data from the handshaked handler
+    auto client = std::make_shared<EarlyDataSSLClient>(service, client_context, address, port);
+    client->SetupEarlyData(true);
+    REQUIRE(!client->SendAsync("test"));
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsHandshaked() || (client->bytes_received() < 4))
+        Thread::Yield();
+
+    // Disconnect the client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Send early data and reconnect the client with the last session
+    REQUIRE(client->SendAsync("test"));
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsHandshaked() || (client->bytes_received() < 8))
+        Thread::Yield();
+    REQUIRE(client->IsResumed());
+    REQUIRE(client->IsEarlyDataAccepted());
+
+    // Disconnect the client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->early_data_accepted() == 1);
+    REQUIRE(!server->errors);
+
+    // Check accepted early data is not sent again
+    REQUIRE(client->received() == "nexttestnext");
+    REQUIRE(client->bytes_sent() == 8);
+    REQUIRE(client->bytes_received() == 8);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("SSL server memory BIO test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2232;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL server context
+    auto server_context = EchoSSLServer::CreateContext();
+
+    // Create and start Echo server with the memory BIO
+    auto server = std::make_shared<EchoSSLServer>(service, server_context, port);
+    server->SetupMemoryBIO(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL client context
+    auto client_context = EchoSSLClient::CreateContext();
+
+    // Create and connect Echo client with the memory BIO
+    auto client = std::make_shared<EchoSSLClient>(service, client_context, address, port);
+    client->SetupMemoryBIO(true);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send a large message of multiple TLS records and a small one to the Echo server
+    std::string message(100000, 'x');
+    client->SendAsync(message);
+    client->SendAsync("test");
+
+    // Wait for all data processed...
+    while (client->bytes_received() != (message.size() + 4))
+        Thread::Yield();
+
+    // Check socket operations of the client
+    REQUIRE(client->socket_reads() > 0);
+    REQUIRE(client->socket_writes() > 0);
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->handshaked);
+    REQUIRE(server->bytes_sent() == (message.size() + 4));
+    REQUIRE(server->bytes_received() == (message.size() + 4));
+    REQUIRE(server->socket_reads() > 0);
+    REQUIRE(server->socket_writes() > 0);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->handshaked);
+    REQUIRE(client->bytes_sent() == (message.size() + 4));
+    REQUIRE(client->bytes_received() == (message.size() + 4));
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("SSL server conflation test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2234;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL server context
+    auto server_context = EchoSSLServer::CreateContext();
+
+    // Create and start conflation server
+    auto server = std::make_shared<ConflationSSLServer>(service, server_context, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and prepare a new SSL client context
+    auto client_context = EchoSSLClient::CreateContext();
+
+    // Create and connect conflation client
+    auto client = std::make_shared<ConflationSSLClient>(service, client_context, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || !client->IsHandshaked() || (server->clients != 1))
+        Thread::Yield();
+
+    // Request the conflated sequence from the server
+    client->SendAsync("test");
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 11)
+        Thread::Yield();
+
+    // Disconnect the conflation client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || client->IsHandshaked() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the conflation server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the replaced value is sent once with the latest payload
+    // after the regular data queued before the flush
+    REQUIRE(client->received() == "headbodynew");
+    REQUIRE(ConflationSSLSession::conflated == 1);
+
+    // Check the conflation server state
+    REQUIRE(server->handshaked);
+    REQUIRE(server->bytes_sent() == 11);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+
+    // Check the conflation client state
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("SSL connection pool test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 2233;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoSSLService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoSSLServer>(service, EchoSSLServer::CreateContext(), port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and start the connection pool with two warm connections
+    asio::ip::tcp::endpoint endpoint(asio::ip::make_address(address), (unsigned short)port);
+    auto pool = std::make_shared<EchoSSLConnectionPool>(service, EchoSSLClient::CreateContext());
+    pool->SetupConnections(2, 2);
+    REQUIRE(pool->Start());
+    REQUIRE(pool->Warmup(endpoint));
+    while ((pool->idle_connections() != 2) || (server->clients != 2))
+        Thread::Yield();
+
+    // Checkout handshaked connections several times without new handshakes
+    for (size_t i = 0; i < 10; ++i)
+    {
+        std::atomic<bool> completed(false);
+        std::shared_ptr<PooledSSLClient> client;
+        REQUIRE(pool->CheckoutAsync(endpoint, [&](std::shared_ptr<PooledSSLClient> checked) { client = checked; completed = true; }));
+        while (!completed)
+            Thread::Yield();
+        REQUIRE(client != nullptr);
+        REQUIRE(client->IsHandshaked());
+        REQUIRE(pool->Return(client));
+    }
+
+    // Stop the pool and disconnect idle connections
+    REQUIRE(pool->Stop());
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the pool statistic
+    REQUIRE(pool->checkouts() == 10);
+    REQUIRE(pool->hits() == 10);
+    REQUIRE(pool->hit_rate() == 1.0);
+    REQUIRE(pool->connects() == 2);
+    REQUIRE(pool->connects_failed() == 0);
+
+    // Check the Echo server state
+    REQUIRE(server->connections_accepted() == 2);
+    REQUIRE(!server->errors);
+}
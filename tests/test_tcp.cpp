@@ -4,12 +4,15 @@
 
 #include "test.h"
 
+#include "server/asio/connection_pool.h"
 #include "server/asio/tcp_client.h"
 #include "server/asio/tcp_server.h"
 #include "threads/thread.h"
 
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <set>
 #include <vector>
 
 using namespace CppCommon;
@@ -27,8 +30,9 @@ public:
     std::atomic<bool> idle;
     std::atomic<bool> errors;
 
-    EchoTCPService()
-        : thread_initialize(false),
+    explicit EchoTCPService(int threads = 1)
+        : Service(threads),
+          thread_initialize(false),
           thread_cleanup(false),
           started(false),
           stopped(false),
@@ -121,6 +125,223 @@ protected:
     void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
 };
 
+class PubSubTCPSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+    static std::atomic<size_t> subscriptions;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Subscribe the session to the received topic
+        if (Subscribe(std::string((const char*)buffer, size)))
+            ++subscriptions;
+    }
+};
+
+std::atomic<size_t> PubSubTCPSession::subscriptions(0);
+
+class PubSubTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(std::shared_ptr<TCPServer> server) override { return std::make_shared<PubSubTCPSession>(server); }
+};
+
+class FanOutTCPSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+    static std::atomic<size_t> local_sends;
+    static std::atomic<size_t> foreign_sends;
+    static std::mutex services_lock;
+    static std::set<asio::io_service*> services;
+
+    bool SendAsync(const void* buffer, size_t size) override
+    {
+        // Check the multicast is performed by the session working thread
+        if (Service::GetCurrentAsioService() == io_service())
+            ++local_sends;
+        else
+            ++foreign_sends;
+        return TCPSession::SendAsync(buffer, size);
+    }
+
+protected:
+    void onConnected() override
+    {
+        std::scoped_lock locker(services_lock);
+        services.insert(io_service().get());
+    }
+};
+
+std::atomic<size_t> FanOutTCPSession::local_sends(0);
+std::atomic<size_t> FanOutTCPSession::foreign_sends(0);
+std::mutex FanOutTCPSession::services_lock;
+std::set<asio::io_service*> FanOutTCPSession::services;
+
+class FanOutTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(std::shared_ptr<TCPServer> server) override { return std::make_shared<FanOutTCPSession>(server); }
+};
+
+class ConflationTCPSession : public TCPSession
+{
+public:
+    using TCPSession::TCPSession;
+
+    static std::atomic<uint64_t> conflated;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        // Replace the conflated value before the send buffer is flushed
+        SendAsync("head");
+        SendConflated("key", "old");
+        SendAsync("body");
+        SendConflated("key", "new");
+        conflated = values_conflated();
+    }
+};
+
+std::atomic<uint64_t> ConflationTCPSession::conflated(0);
+
+class ConflationTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(std::shared_ptr<TCPServer> server) override { return std::make_shared<ConflationTCPSession>(server); }
+};
+
+class ConflationTCPClient : public EchoTCPClient
+{
+public:
+    using EchoTCPClient::EchoTCPClient;
+
+    std::string received()
+    {
+        std::scoped_lock locker(_received_lock);
+        return _received;
+    }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override
+    {
+        std::scoped_lock locker(_received_lock);
+        _received.append((const char*)buffer, size);
+    }
+
+private:
+    std::mutex _received_lock;
+    std::string _received;
+};
+
+class TimestampTCPSession : public EchoTCPSession
+{
+public:
+    using EchoTCPSession::EchoTCPSession;
+
+    static std::atomic<size_t> timestamped;
+    static std::atomic<size_t> transmitted;
+
+protected:
+    void onReceivedTimestamped(const void* buffer, size_t size, const PacketTimestamp& timestamp) override
+    {
+        if (timestamp.best() > 0)
+            ++timestamped;
+        EchoTCPSession::onReceived(buffer, size);
+    }
+    void onSentTimestamp(uint32_t id, const PacketTimestamp& timestamp) override
+    {
+        if (timestamp.best() > 0)
+            ++transmitted;
+    }
+};
+
+std::atomic<size_t> TimestampTCPSession::timestamped(0);
+std::atomic<size_t> TimestampTCPSession::transmitted(0);
+
+class TimestampTCPServer : public EchoTCPServer
+{
+public:
+    using EchoTCPServer::EchoTCPServer;
+
+protected:
+    std::shared_ptr<TCPSession> CreateSession(std::shared_ptr<TCPServer> server) override { return std::make_shared<TimestampTCPSession>(server); }
+};
+
+class EchoPooledTCPClient : public PooledTCPClient
+{
+public:
+    std::atomic<size_t> received;
+
+    EchoPooledTCPClient(std::shared_ptr<Service> service, const asio::ip::tcp::endpoint& endpoint)
+        : PooledTCPClient(service, endpoint),
+          received(0)
+    {
+    }
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { received += size; }
+};
+
+class EchoTCPConnectionPool : public ConnectionPool<EchoPooledTCPClient>
+{
+public:
+    using ConnectionPool<EchoPooledTCPClient>::ConnectionPool;
+
+protected:
+    std::shared_ptr<EchoPooledTCPClient> CreateClient(std::shared_ptr<Service> service, const asio::ip::tcp::endpoint& endpoint) override { return std::make_shared<EchoPooledTCPClient>(service, endpoint); }
+};
+
+class HealthTCPConnectionPool : public EchoTCPConnectionPool
+{
+public:
+    std::atomic<size_t> checks;
+    std::atomic<bool> unhealthy;
+
+    explicit HealthTCPConnectionPool(std::shared_ptr<Service> service)
+        : EchoTCPConnectionPool(service),
+          checks(0),
+          unhealthy(false)
+    {
+    }
+
+protected:
+    bool CheckHealth(std::shared_ptr<EchoPooledTCPClient>& client) override
+    {
+        // Call the pool from the health check
+        if (connections() > 0)
+            ++checks;
+
+        if (unhealthy.exchange(false))
+            return false;
+
+        return EchoTCPConnectionPool::CheckHealth(client);
+    }
+};
+
+std::shared_ptr<EchoPooledTCPClient> Checkout(EchoTCPConnectionPool& pool, const asio::ip::tcp::endpoint& endpoint)
+{
+    std::atomic<bool> completed(false);
+    std::shared_ptr<EchoPooledTCPClient> result;
+    REQUIRE(pool.CheckoutAsync(endpoint, [&](std::shared_ptr<EchoPooledTCPClient> client) { result = client; completed = true; }));
+    while (!completed)
+        Thread::Yield();
+    return result;
+}
+
 } // namespace
 
 TEST_CASE("TCP server test", "[CppServer][Asio]")
@@ -183,6 +404,7 @@ TEST_CASE("TCP server test", "[CppServer][Asio]")
     REQUIRE(server->disconnected);
     REQUIRE(server->bytes_sent() == 4);
     REQUIRE(server->bytes_received() == 4);
+    REQUIRE(server->connections_accepted() == 1);
     REQUIRE(!server->errors);
 
     // Check the Echo client state
@@ -317,6 +539,721 @@ TEST_CASE("TCP server multicast test", "[CppServer][Asio]")
     REQUIRE(!client3->errors);
 }
 
+TEST_CASE("TCP server paced multicast test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1122;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with the multicast paced to 100 messages per second
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupMulticastPacing(100, PacingUnit::Packets);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Multicast a burst of messages to all clients
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(server->Multicast("test"));
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 40)
+        Thread::Yield();
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the burst was spread in time by the multicast pacer
+    REQUIRE(elapsed >= std::chrono::milliseconds(80));
+    REQUIRE(server->multicast_pacer().messages_paced() == 10);
+    REQUIRE(server->multicast_pacer().throttles() > 0);
+
+    // Check the Echo server state
+    REQUIRE(server->bytes_sent() == 40);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_received() == 40);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("TCP server multicast fan-out test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1114;
+
+    // Create and start Asio service with multiple working threads
+    auto service = std::make_shared<EchoTCPService>(4);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<FanOutTCPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo clients
+    std::vector<std::shared_ptr<EchoTCPClient>> clients;
+    for (int i = 0; i < 16; ++i)
+    {
+        auto client = std::make_shared<EchoTCPClient>(service, address, port);
+        REQUIRE(client->ConnectAsync());
+        clients.emplace_back(client);
+    }
+    for (auto& client : clients)
+        while (!client->IsConnected())
+            Thread::Yield();
+    while (server->clients != clients.size())
+        Thread::Yield();
+
+    // Multicast some data to all clients
+    server->Multicast("test");
+    server->Multicast("test");
+    server->Multicast("test");
+
+    // Wait for all data processed...
+    for (auto& client : clients)
+        while (client->bytes_received() != 12)
+            Thread::Yield();
+
+    // Check sessions are distributed over all IO services and each group
+    // is multicast by the working thread of its IO service
+    REQUIRE(service->services() == 4);
+    REQUIRE(FanOutTCPSession::services.size() == 4);
+    REQUIRE(FanOutTCPSession::local_sends == 3 * clients.size());
+    REQUIRE(FanOutTCPSession::foreign_sends == 0);
+
+    // Disconnect Echo clients
+    for (auto& client : clients)
+        REQUIRE(client->DisconnectAsync());
+    for (auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->connected);
+    REQUIRE(server->disconnected);
+    REQUIRE(server->bytes_sent() == 12 * clients.size());
+    REQUIRE(server->bytes_received() == 0);
+    REQUIRE(!server->errors);
+
+    // Check the Echo clients state
+    for (auto& client : clients)
+    {
+        REQUIRE(client->bytes_sent() == 0);
+        REQUIRE(client->bytes_received() == 12);
+        REQUIRE(!client->errors);
+    }
+}
+
+TEST_CASE("TCP server multiple acceptors test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1115;
+
+    // Create and start Asio service with multiple working threads
+    auto service = std::make_shared<EchoTCPService>(4);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with one acceptor per working thread
+    // and several concurrent accept operations on each of them
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupMultipleAcceptors(true);
+    server->SetupAcceptConcurrency(4);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo clients
+    std::vector<std::shared_ptr<EchoTCPClient>> clients;
+    for (int i = 0; i < 16; ++i)
+    {
+        auto client = std::make_shared<EchoTCPClient>(service, address, port);
+        REQUIRE(client->ConnectAsync());
+        clients.emplace_back(client);
+    }
+    for (auto& client : clients)
+        while (!client->IsConnected())
+            Thread::Yield();
+    while (server->clients != clients.size())
+        Thread::Yield();
+
+    // Send a message from each client to the Echo server
+    for (auto& client : clients)
+        client->SendAsync("test");
+
+    // Wait for all data processed...
+    for (auto& client : clients)
+        while (client->bytes_received() != 4)
+            Thread::Yield();
+
+    // Disconnect Echo clients
+    for (auto& client : clients)
+        REQUIRE(client->DisconnectAsync());
+    for (auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->connected);
+    REQUIRE(server->disconnected);
+    REQUIRE(server->bytes_sent() == 4 * clients.size());
+    REQUIRE(server->bytes_received() == 4 * clients.size());
+    REQUIRE(server->connections_accepted() == clients.size());
+    REQUIRE(server->accept_errors() == 0);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP server accept burst test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1119;
+
+    // Create and start Asio service with multiple working threads
+    auto service = std::make_shared<EchoTCPService>(4);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with a single acceptor
+    // and several concurrent accept operations on it
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->SetupAcceptConcurrency(8);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Connect a burst of Echo clients at once
+    std::vector<std::shared_ptr<EchoTCPClient>> clients;
+    for (int i = 0; i < 256; ++i)
+        clients.emplace_back(std::make_shared<EchoTCPClient>(service, address, port));
+    for (auto& client : clients)
+        REQUIRE(client->ConnectAsync());
+    for (auto& client : clients)
+        while (!client->IsConnected())
+            Thread::Yield();
+    while (server->clients != clients.size())
+        Thread::Yield();
+
+    // Send a message from each client to the Echo server
+    for (auto& client : clients)
+        client->SendAsync("test");
+
+    // Wait for all data processed...
+    for (auto& client : clients)
+        while (client->bytes_received() != 4)
+            Thread::Yield();
+
+    // Disconnect Echo clients
+    for (auto& client : clients)
+        REQUIRE(client->DisconnectAsync());
+    for (auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->bytes_sent() == 4 * clients.size());
+    REQUIRE(server->bytes_received() == 4 * clients.size());
+    REQUIRE(server->connections_accepted() == clients.size());
+    REQUIRE(server->accept_errors() == 0);
+    REQUIRE(server->backlog_overflows() <= server->connections_accepted());
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP server conflation test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1120;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start conflation server
+    auto server = std::make_shared<ConflationTCPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect conflation client
+    auto client = std::make_shared<ConflationTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Request the conflated sequence from the server
+    client->SendAsync("test");
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 11)
+        Thread::Yield();
+
+    // Disconnect the conflation client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the conflation server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the replaced value is sent once with the latest payload
+    // after the regular data queued before the flush
+    REQUIRE(client->received() == "headbodynew");
+    REQUIRE(ConflationTCPSession::conflated == 1);
+
+    // Check the conflation server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->bytes_sent() == 11);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!server->errors);
+
+    // Check the conflation client state
+    REQUIRE(client->bytes_sent() == 4);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("TCP server timestamping test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1121;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with receive & transmit timestamps
+    auto server = std::make_shared<TimestampTCPServer>(service, port);
+    server->SetupTimestamping(true, true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Send messages to the Echo server
+    client->SendAsync("test");
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+    client->SendAsync("test");
+    while (client->bytes_received() != 8)
+        Thread::Yield();
+
+    // Wait for transmit timestamps...
+    if (Timestamping::IsSupported())
+        while (TimestampTCPSession::transmitted == 0)
+            Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(TimestampTCPSession::timestamped == 2);
+    REQUIRE(server->bytes_sent() == 8);
+    REQUIRE(server->bytes_received() == 8);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == 8);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("TCP server admission control test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1116;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with a single session allowed
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    server->admission().SetupMaxSessions(1);
+    server->admission().SetupRejectResponse("busy", 4);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect the first Echo client
+    auto client1 = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client1->ConnectAsync());
+    while (!client1->IsConnected() || (server->clients != 1))
+        Thread::Yield();
+
+    // Create and connect the second Echo client, which should be rejected
+    auto client2 = std::make_shared<EchoTCPClient>(service, address, port);
+    REQUIRE(client2->ConnectAsync());
+    while (!client2->disconnected)
+        Thread::Yield();
+
+    // Disconnect the first Echo client
+    REQUIRE(client1->DisconnectAsync());
+    while (client1->IsConnected() || (server->clients != 0))
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->connections_accepted() == 2);
+    REQUIRE(server->admission().admitted() == 1);
+    REQUIRE(server->admission().rejected() == 1);
+    REQUIRE(!server->errors);
+
+    // Check the rejected Echo client state
+    REQUIRE(client2->bytes_received() == 4);
+}
+
+TEST_CASE("TCP server publish/subscribe test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1117;
+
+    // Create and start Asio service with multiple working threads
+    auto service = std::make_shared<EchoTCPService>(4);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start PubSub server
+    auto server = std::make_shared<PubSubTCPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo clients
+    std::vector<std::shared_ptr<EchoTCPClient>> clients;
+    for (int i = 0; i < 8; ++i)
+    {
+        auto client = std::make_shared<EchoTCPClient>(service, address, port);
+        REQUIRE(client->ConnectAsync());
+        clients.emplace_back(client);
+    }
+    for (auto& client : clients)
+        while (!client->IsConnected())
+            Thread::Yield();
+    while (server->clients != clients.size())
+        Thread::Yield();
+
+    // Subscribe even clients to the topic 'even' and odd clients to the topic 'odd'
+    PubSubTCPSession::subscriptions = 0;
+    for (size_t i = 0; i < clients.size(); ++i)
+        clients[i]->SendAsync(((i % 2) == 0) ? "even" : "odd");
+    while (PubSubTCPSession::subscriptions != clients.size())
+        Thread::Yield();
+
+    // Publish some data to topics
+    REQUIRE(server->Publish("even", "test"));
+    REQUIRE(server->Publish("odd", "te"));
+    REQUIRE(server->Publish("none", "test"));
+
+    // Wait for all data processed...
+    for (size_t i = 0; i < clients.size(); ++i)
+        while (clients[i]->bytes_received() != (((i % 2) == 0) ? 4 : 2))
+            Thread::Yield();
+
+    // Disconnect Echo clients
+    for (auto& client : clients)
+        REQUIRE(client->DisconnectAsync());
+    for (auto& client : clients)
+        while (client->IsConnected())
+            Thread::Yield();
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the PubSub server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the PubSub server state
+    REQUIRE(server->bytes_sent() == 3 * clients.size());
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP connection pool test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1118;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>(2);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and start the connection pool with one warm and two maximal connections
+    asio::ip::tcp::endpoint endpoint(asio::ip::make_address(address), (unsigned short)port);
+    auto pool = std::make_shared<EchoTCPConnectionPool>(service);
+    pool->SetupConnections(1, 2);
+    pool->SetupMaintenanceInterval(Timespan::milliseconds(10));
+    REQUIRE(pool->Start());
+    REQUIRE(pool->Warmup(endpoint));
+    while (pool->idle_connections() != 1)
+        Thread::Yield();
+
+    // Checkout the warm connection and send a message with it
+    auto client1 = Checkout(*pool, endpoint);
+    REQUIRE(client1 != nullptr);
+    REQUIRE(client1->IsConnected());
+    REQUIRE(client1->SendAsync("test"));
+    while (client1->received != 4)
+        Thread::Yield();
+
+    // Checkout the second connection which is connected on demand
+    auto client2 = Checkout(*pool, endpoint);
+    REQUIRE(client2 != nullptr);
+    REQUIRE(client2 != client1);
+    REQUIRE(pool->connections(endpoint) == 2);
+
+    // Checkout the third connection which waits for the returned one
+    std::atomic<bool> completed(false);
+    std::shared_ptr<EchoPooledTCPClient> client3;
+    REQUIRE(pool->CheckoutAsync(endpoint, [&](std::shared_ptr<EchoPooledTCPClient> client) { client3 = client; completed = true; }));
+    REQUIRE(pool->waiting_checkouts() == 1);
+    REQUIRE(pool->Return(client1));
+    while (!completed)
+        Thread::Yield();
+    REQUIRE(client3 == client1);
+
+    // Return all connections into the pool
+    REQUIRE(pool->Return(client2));
+    REQUIRE(pool->Return(client3));
+    REQUIRE(pool->idle_connections() == 2);
+
+    // Check the pool statistic
+    REQUIRE(pool->checkouts() == 3);
+    REQUIRE(pool->hits() == 1);
+    REQUIRE(pool->misses() == 2);
+    REQUIRE(pool->connects() == 2);
+    REQUIRE(pool->wait_time() > Timespan::zero());
+    REQUIRE(pool->hit_rate() > 0.3);
+
+    // Evict the idle connection above the minimal count
+    pool->SetupIdleTimeout(Timespan::milliseconds(50));
+    while ((pool->connections(endpoint) != 1) || (server->clients != 1))
+        Thread::Yield();
+    REQUIRE(pool->evictions() == 1);
+
+    // Expire the checkout which waits for the busy connection
+    pool->SetupConnections(1, 1);
+    pool->SetupCheckoutTimeout(Timespan::milliseconds(50));
+    client1 = Checkout(*pool, endpoint);
+    REQUIRE(client1 != nullptr);
+    REQUIRE(Checkout(*pool, endpoint) == nullptr);
+    REQUIRE(pool->timeouts() == 1);
+
+    // Stop the pool and disconnect the returned connection
+    REQUIRE(pool->Stop());
+    REQUIRE(!pool->Return(client1));
+    while (server->clients != 0)
+        Thread::Yield();
+    REQUIRE(pool->connections() == 0);
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->connections_accepted() == 2);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("TCP connection pool health check test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 1123;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoTCPService>(2);
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server
+    auto server = std::make_shared<EchoTCPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and start the connection pool with one warm connection
+    asio::ip::tcp::endpoint endpoint(asio::ip::make_address(address), (unsigned short)port);
+    auto pool = std::make_shared<HealthTCPConnectionPool>(service);
+    pool->SetupConnections(1, 1);
+    pool->SetupMaintenanceInterval(Timespan::milliseconds(10));
+    REQUIRE(pool->Start());
+    REQUIRE(pool->Warmup(endpoint));
+    while ((pool->idle_connections() != 1) || (pool->checks == 0))
+        Thread::Yield();
+
+    // Fail the health check of the idle connection, which calls the pool
+    auto client = Checkout(*pool, endpoint);
+    REQUIRE(client != nullptr);
+    REQUIRE(client->pooled_state() == PooledState::Busy);
+    REQUIRE(pool->Return(client));
+    REQUIRE(client->pooled_state() == PooledState::Idle);
+    pool->unhealthy = true;
+    while (pool->health_checks_failed() != 1)
+        Thread::Yield();
+    REQUIRE(client->pooled_state() == PooledState::Closed);
+
+    // Wait for the replaced connection
+    while ((pool->idle_connections() != 1) || (server->clients != 1))
+        Thread::Yield();
+    auto replaced = Checkout(*pool, endpoint);
+    REQUIRE(replaced != nullptr);
+    REQUIRE(replaced != client);
+
+    // Stop the pool and disconnect the returned connection
+    REQUIRE(pool->Stop());
+    REQUIRE(!pool->Return(replaced));
+    while (server->clients != 0)
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->connections_accepted() == 2);
+    REQUIRE(!server->errors);
+}
+
 TEST_CASE("TCP server random test", "[CppServer][Asio]")
 {
     const std::string address = "127.0.0.1";
@@ -10,6 +10,8 @@
 
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <string>
 #include <vector>
 
 using namespace CppCommon;
@@ -91,6 +93,136 @@ protected:
     void onError(int error, const std::string& category, const std::string& message) override { errors = true; }
 };
 
+class BatchEchoUDPServer : public EchoUDPServer
+{
+public:
+    using EchoUDPServer::EchoUDPServer;
+
+protected:
+    void onReceivedBatch(const UDPDatagram* datagrams, size_t count) override { SendBatchAsync(datagrams, count); }
+};
+
+class SegmentsUDPServer : public EchoUDPServer
+{
+public:
+    std::atomic<size_t> segments;
+
+    SegmentsUDPServer(std::shared_ptr<EchoUDPService> service, int port) : EchoUDPServer(service, port), segments(0) {}
+
+protected:
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override { ++segments; ReceiveAsync(); }
+};
+
+class QueueUDPServer : public EchoUDPServer
+{
+public:
+    using EchoUDPServer::EchoUDPServer;
+
+protected:
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override
+    {
+        // Send a burst of datagrams into the send queue
+        for (int i = 0; i < 100; ++i)
+            SendAsync(endpoint, buffer, size);
+        ReceiveAsync();
+    }
+    void onSent(const asio::ip::udp::endpoint& endpoint, size_t sent) override {}
+};
+
+class SequenceUDPServer : public EchoUDPServer
+{
+public:
+    using EchoUDPServer::EchoUDPServer;
+
+protected:
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override
+    {
+        // Send a burst of numbered datagrams into the send queue
+        for (int i = 0; i < 100; ++i)
+        {
+            std::string sequence = std::to_string(1000 + i);
+            SendAsync(endpoint, sequence.data(), sequence.size());
+        }
+        ReceiveAsync();
+    }
+    void onSent(const asio::ip::udp::endpoint& endpoint, size_t sent) override {}
+};
+
+class SequenceUDPClient : public EchoUDPClient
+{
+public:
+    using EchoUDPClient::EchoUDPClient;
+
+    std::string last()
+    {
+        std::scoped_lock locker(_last_lock);
+        return _last;
+    }
+
+protected:
+    void onReceived(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size) override
+    {
+        {
+            std::scoped_lock locker(_last_lock);
+            _last.assign((const char*)buffer, size);
+        }
+        ReceiveAsync();
+    }
+
+private:
+    std::mutex _last_lock;
+    std::string _last;
+};
+
+class TimestampUDPServer : public EchoUDPServer
+{
+public:
+    std::atomic<size_t> timestamped;
+    std::atomic<size_t> transmitted;
+
+    TimestampUDPServer(std::shared_ptr<EchoUDPService> service, int port) : EchoUDPServer(service, port), timestamped(0), transmitted(0) {}
+
+protected:
+    void onReceivedTimestamped(const asio::ip::udp::endpoint& endpoint, const void* buffer, size_t size, const PacketTimestamp& timestamp) override
+    {
+        if (timestamp.best() > 0)
+            ++timestamped;
+        EchoUDPServer::onReceived(endpoint, buffer, size);
+    }
+    void onSentTimestamp(uint32_t id, const PacketTimestamp& timestamp) override
+    {
+        if (timestamp.best() > 0)
+            ++transmitted;
+    }
+};
+
+class EchoUDPSession : public UDPSession
+{
+public:
+    using UDPSession::UDPSession;
+
+protected:
+    void onReceived(const void* buffer, size_t size) override { SendAsync(buffer, size); }
+};
+
+class SessionUDPServer : public UDPServer
+{
+public:
+    std::atomic<size_t> connected;
+    std::atomic<size_t> disconnected;
+
+    SessionUDPServer(std::shared_ptr<EchoUDPService> service, int port) : UDPServer(service, port), connected(0), disconnected(0) {}
+
+protected:
+    std::shared_ptr<UDPSession> CreateSession(std::shared_ptr<UDPServer> server, const asio::ip::udp::endpoint& endpoint) override { return std::make_shared<EchoUDPSession>(server, endpoint); }
+
+protected:
+    void onStarted() override { ReceiveAsync(); }
+    void onConnected(std::shared_ptr<UDPSession>& session) override { ++connected; }
+    void onDisconnected(std::shared_ptr<UDPSession>& session) override { ++disconnected; }
+    void onSent(const asio::ip::udp::endpoint& endpoint, size_t sent) override { UDPServer::onSent(endpoint, sent); ReceiveAsync(); }
+};
+
 } // namespace
 
 TEST_CASE("UDP server test", "[CppServer][Asio]")
@@ -278,3 +410,559 @@ TEST_CASE("UDP server random test", "[CppServer][Asio]")
     REQUIRE(server->bytes_received() > 0);
     REQUIRE(!server->errors);
 }
+
+TEST_CASE("UDP server batch test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3335;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with batched receive
+    auto server = std::make_shared<BatchEchoUDPServer>(service, port);
+    server->SetupReceiveBatch(16);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoUDPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Send several messages to the Echo server
+    for (int i = 0; i < 10; ++i)
+        client->Send("test");
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 40)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->bytes_sent() == 40);
+    REQUIRE(server->bytes_received() == 40);
+    REQUIRE(server->datagrams_received() == 10);
+    REQUIRE(!server->errors);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == 40);
+    REQUIRE(client->bytes_received() == 40);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("UDP server multiple sockets test", "[CppServer][Asio]")
+{
+    const int port = 3346;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Additional receive sockets cannot be combined with the batched receive
+    auto server = std::make_shared<BatchEchoUDPServer>(service, port);
+    server->SetupMultipleSockets(true);
+    server->SetupReceiveBatch(16);
+    REQUIRE(!server->Start());
+    REQUIRE(server->errors);
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(!server->started);
+}
+
+TEST_CASE("UDP server segmentation offload test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3336;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start server with receive offload
+    auto server = std::make_shared<SegmentsUDPServer>(service, port);
+    server->SetupReceiveOffload(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect client
+    auto client = std::make_shared<EchoUDPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Send a buffer segmented into four datagrams
+    std::vector<uint8_t> buffer(350, 'x');
+    REQUIRE(client->SendSegmentedAsync(buffer.data(), buffer.size(), 100));
+
+    // Wait for all segments received...
+    while (server->segments != 4)
+        Thread::Yield();
+    while (client->bytes_sent() != 350)
+        Thread::Yield();
+
+    // Send a buffer above the single call limit of 64 segments
+    std::vector<uint8_t> large(100 * 100, 'x');
+    REQUIRE(client->SendSegmentedAsync(large.data(), large.size(), 100));
+
+    // Wait for all segments received...
+    while (server->segments != 104)
+        Thread::Yield();
+
+    // Disconnect the client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the server state
+    REQUIRE(server->bytes_received() == 10350);
+    REQUIRE(server->datagrams_received() == 104);
+    REQUIRE(!server->errors);
+
+    // Check the client state
+    REQUIRE(client->bytes_sent() == 10350);
+    REQUIRE(client->datagrams_sent() == 104);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("UDP server send queue test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3337;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start server with the bounded send queue
+    auto server = std::make_shared<QueueUDPServer>(service, port);
+    server->SetupSendQueue(10, DropPolicy::DropNewest);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect client
+    auto client = std::make_shared<EchoUDPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Send a message to start the burst
+    client->Send("test");
+
+    // Wait for the burst to be sent or dropped...
+    while ((server->datagrams_sent() + server->datagrams_dropped()) != 100)
+        Thread::Yield();
+    while (client->bytes_received() != server->bytes_sent())
+        Thread::Yield();
+
+    // Disconnect the client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the server state
+    REQUIRE(server->datagrams_sent() > 0);
+    REQUIRE(server->datagrams_dropped() > 0);
+    REQUIRE(server->bytes_dropped() == 4 * server->datagrams_dropped());
+    REQUIRE(server->bytes_pending() == 0);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("UDP server send queue drop oldest test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3347;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start server with the single datagram send queue
+    auto server = std::make_shared<SequenceUDPServer>(service, port);
+    server->SetupSendQueue(1, DropPolicy::DropOldest);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect client
+    auto client = std::make_shared<SequenceUDPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Send a message to start the burst
+    client->Send("test");
+
+    // Wait for the burst to be sent or dropped...
+    while ((server->datagrams_sent() + server->datagrams_dropped()) != 100)
+        Thread::Yield();
+    while (client->bytes_received() != server->bytes_sent())
+        Thread::Yield();
+
+    // Disconnect the client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the newest datagram survived the drops
+    REQUIRE(client->last() == "1099");
+
+    // Check the server state
+    REQUIRE(server->datagrams_sent() > 0);
+    REQUIRE(server->datagrams_dropped() > 0);
+    REQUIRE(server->bytes_dropped() == 4 * server->datagrams_dropped());
+    REQUIRE(server->bytes_pending() == 0);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("UDP server sessions test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3338;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with short session idle timeout
+    auto server = std::make_shared<SessionUDPServer>(service, port);
+    server->SetupSessionTimeout(CppCommon::Timespan::milliseconds(500));
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo clients
+    auto client1 = std::make_shared<EchoUDPClient>(service, address, port);
+    REQUIRE(client1->ConnectAsync());
+    while (!client1->IsConnected())
+        Thread::Yield();
+    auto client2 = std::make_shared<EchoUDPClient>(service, address, port);
+    REQUIRE(client2->ConnectAsync());
+    while (!client2->IsConnected())
+        Thread::Yield();
+
+    // Send messages to the Echo server
+    client1->Send("test");
+    while (client1->bytes_received() != 4)
+        Thread::Yield();
+    client1->Send("test");
+    while (client1->bytes_received() != 8)
+        Thread::Yield();
+    client2->Send("test");
+    while (client2->bytes_received() != 4)
+        Thread::Yield();
+
+    // Check virtual sessions of clients
+    REQUIRE(server->connected_sessions() == 2);
+    auto session = server->FindSession(asio::ip::udp::endpoint(asio::ip::make_address(address), client1->socket().local_endpoint().port()));
+    REQUIRE(session != nullptr);
+    REQUIRE(session->datagrams_received() == 2);
+    REQUIRE(session->bytes_received() == 8);
+    while (session->bytes_sent() != 8)
+        Thread::Yield();
+    session.reset();
+
+    // Wait for idle sessions to expire...
+    while (server->connected_sessions() != 0)
+        Thread::Yield();
+
+    // Disconnect Echo clients
+    REQUIRE(client1->DisconnectAsync());
+    REQUIRE(client2->DisconnectAsync());
+    while (client1->IsConnected() || client2->IsConnected())
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->connected == 2);
+    REQUIRE(server->disconnected == 2);
+    REQUIRE(server->bytes_sent() == 12);
+    REQUIRE(server->bytes_received() == 12);
+}
+
+TEST_CASE("UDP server session socket test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3348;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server without the reuse port option
+    auto server = std::make_shared<SessionUDPServer>(service, port);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoUDPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Send a message to create the virtual session
+    client->Send("test");
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+
+    // Check the session socket requires the reuse port option
+    asio::ip::udp::endpoint endpoint(asio::ip::make_address(address), client->socket().local_endpoint().port());
+    auto session = server->FindSession(endpoint);
+    REQUIRE(session != nullptr);
+    REQUIRE(!session->ConnectSocket());
+    REQUIRE(!session->IsSocketConnected());
+    session.reset();
+
+    // Restart Echo server with the reuse port option
+    REQUIRE(server->Stop());
+    while (server->IsStarted() || (server->disconnected != 1))
+        Thread::Yield();
+    server->SetupReusePort(true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Send a message to create the virtual session
+    client->Send("test");
+    while (client->bytes_received() != 8)
+        Thread::Yield();
+
+    // Connect the session socket
+    session = server->FindSession(endpoint);
+    REQUIRE(session != nullptr);
+    REQUIRE(session->ConnectSocket());
+    REQUIRE(session->IsSocketConnected());
+
+    // Exchange datagrams with the connected session socket
+    client->Send("test");
+    while (client->bytes_received() != 12)
+        Thread::Yield();
+    client->Send("test");
+    while (client->bytes_received() != 16)
+        Thread::Yield();
+    REQUIRE(session->datagrams_received() == 3);
+    REQUIRE(session->bytes_received() == 12);
+    while (session->bytes_sent() != 12)
+        Thread::Yield();
+    session.reset();
+
+    // Disconnect Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted() || (server->disconnected != 2))
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check datagrams of the connected socket bypass the server socket
+    REQUIRE(server->connected == 2);
+    REQUIRE(server->bytes_received() == 4);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("UDP server timestamping test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3340;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with receive & transmit timestamps
+    auto server = std::make_shared<TimestampUDPServer>(service, port);
+    server->SetupTimestamping(true, true);
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoUDPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Send messages to the Echo server
+    client->Send("test");
+    while (client->bytes_received() != 4)
+        Thread::Yield();
+    client->Send("test");
+    while (client->bytes_received() != 8)
+        Thread::Yield();
+
+    // Wait for transmit timestamps...
+    if (Timestamping::IsSupported())
+        while (server->transmitted != 2)
+            Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->timestamped == 2);
+    REQUIRE(server->datagrams_received() == 2);
+    REQUIRE(!server->errors);
+}
+
+TEST_CASE("UDP server AF_XDP fallback test", "[CppServer][Asio]")
+{
+    const std::string address = "127.0.0.1";
+    const int port = 3343;
+
+    // Create and start Asio service
+    auto service = std::make_shared<EchoUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start Echo server with AF_XDP transport on the missing network interface
+    auto server = std::make_shared<EchoUDPServer>(service, port);
+    server->SetupXdp("cppserver0");
+    REQUIRE(server->Start());
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Server should fall back to the socket transport
+    REQUIRE(!server->IsXdp());
+
+    // Create and connect Echo client
+    auto client = std::make_shared<EchoUDPClient>(service, address, port);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Send several messages to the Echo server
+    for (int i = 0; i < 10; ++i)
+        client->Send("test");
+
+    // Wait for all data processed...
+    while (client->bytes_received() != 40)
+        Thread::Yield();
+
+    // Disconnect the Echo client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the Echo server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the Echo server state
+    REQUIRE(server->started);
+    REQUIRE(server->stopped);
+    REQUIRE(server->bytes_sent() == 40);
+    REQUIRE(server->bytes_received() == 40);
+    REQUIRE(server->xdp().datagrams_received() == 0);
+
+    // Check the Echo client state
+    REQUIRE(client->bytes_sent() == 40);
+    REQUIRE(!client->errors);
+}
@@ -4,12 +4,16 @@
 
 #include "test.h"
 
+#include "server/asio/pacer.h"
 #include "server/asio/udp_client.h"
+#include "server/asio/udp_ring.h"
 #include "server/asio/udp_server.h"
 #include "threads/thread.h"
 
 #include <atomic>
 #include <chrono>
+#include <cstring>
+#include <thread>
 #include <vector>
 
 using namespace CppCommon;
@@ -342,3 +346,270 @@ TEST_CASE("UDP server multicast random test", "[CppServer][Asio]")
     REQUIRE(server->bytes_received() == 0);
     REQUIRE(!server->errors);
 }
+
+TEST_CASE("UDP ring test", "[CppServer][Asio]")
+{
+    const uint64_t count = 100000;
+
+    UDPRing ring(64, 8, 4);
+    REQUIRE(ring.capacity() == 64);
+
+    // Consumer thread checks all datagrams are read in order
+    auto consume = [&ring, count](UDPRing::Consumer* consumer, std::atomic<bool>& ordered)
+    {
+        uint64_t expected = 0;
+        while (expected < count)
+        {
+            const UDPDatagram* datagrams;
+            size_t acquired = consumer->Acquire(datagrams);
+            for (size_t i = 0; i < acquired; ++i)
+            {
+                uint64_t value;
+                std::memcpy(&value, datagrams[i].buffer, sizeof(value));
+                if ((datagrams[i].size != sizeof(value)) || (value != expected))
+                    ordered = false;
+                ++expected;
+            }
+            consumer->Release(acquired);
+            if (acquired == 0)
+                Thread::Yield();
+        }
+        ring.Unsubscribe(consumer);
+    };
+
+    std::atomic<bool> ordered1(true);
+    std::atomic<bool> ordered2(true);
+    auto consumer1 = ring.Subscribe();
+    auto consumer2 = ring.Subscribe();
+    REQUIRE(consumer1 != nullptr);
+    REQUIRE(consumer2 != nullptr);
+    std::thread thread1(consume, consumer1, std::ref(ordered1));
+    std::thread thread2(consume, consumer2, std::ref(ordered2));
+
+    // Produce datagrams and wait for the slowest consumer when the ring is full
+    asio::ip::udp::endpoint endpoint;
+    for (uint64_t value = 0; value < count;)
+    {
+        if (ring.Publish(endpoint, &value, sizeof(value)))
+            ++value;
+        else
+            Thread::Yield();
+    }
+
+    thread1.join();
+    thread2.join();
+
+    // Check the ring state
+    REQUIRE(ordered1);
+    REQUIRE(ordered2);
+    REQUIRE(ring.published() == count);
+
+    // Check the ring without consumers never gets full
+    for (uint64_t value = 0; value < 1000; ++value)
+        REQUIRE(ring.Publish(endpoint, &value, sizeof(value)));
+}
+
+TEST_CASE("UDP client multicast receive ring test", "[CppServer][Asio]")
+{
+    const std::string listen_address = "0.0.0.0";
+    const std::string multicast_address = "239.255.0.1";
+    const int multicast_port = 3341;
+    const size_t count = 100;
+
+    // Create and start Asio service
+    auto service = std::make_shared<MulticastUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start multicast server
+    auto server = std::make_shared<MulticastUDPServer>(service, 0);
+    REQUIRE(server->Start(multicast_address, multicast_port));
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create the shared receive ring with two consumers
+    auto ring = std::make_shared<UDPRing>(1024);
+    auto consumer1 = ring->Subscribe();
+    auto consumer2 = ring->Subscribe();
+
+    // Create and connect multicast client with the receive ring
+    auto client = std::make_shared<MulticastUDPClient>(service, listen_address, multicast_port);
+    client->SetupMulticast(true);
+    client->SetupReceiveRing(ring);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Join multicast group
+    client->JoinMulticastGroup(multicast_address);
+
+    // Consumer threads read all received datagrams from the ring
+    auto consume = [count](UDPRing::Consumer* consumer, std::atomic<size_t>& bytes)
+    {
+        size_t datagrams = 0;
+        while (datagrams < count)
+        {
+            const UDPDatagram* slots;
+            size_t acquired = consumer->Acquire(slots);
+            for (size_t i = 0; i < acquired; ++i)
+                bytes += slots[i].size;
+            consumer->Release(acquired);
+            datagrams += acquired;
+            if (acquired == 0)
+                Thread::Yield();
+        }
+    };
+    std::atomic<size_t> bytes1(0);
+    std::atomic<size_t> bytes2(0);
+    std::thread thread1(consume, consumer1, std::ref(bytes1));
+    std::thread thread2(consume, consumer2, std::ref(bytes2));
+
+    // Multicast some data to the client
+    for (size_t i = 0; i < count; ++i)
+    {
+        server->Multicast("test");
+        Thread::Sleep(1);
+    }
+
+    thread1.join();
+    thread2.join();
+
+    // Disconnect the multicast client
+    client->LeaveMulticastGroup(multicast_address);
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the multicast server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check each consumer received all datagrams of the single socket
+    REQUIRE(bytes1 == 4 * count);
+    REQUIRE(bytes2 == 4 * count);
+    REQUIRE(client->datagrams_received() == count);
+    REQUIRE(ring->published() == count);
+    REQUIRE(ring->datagrams_dropped() == 0);
+    REQUIRE(!client->errors);
+}
+
+TEST_CASE("Send pacer test", "[CppServer][Asio]")
+{
+    const uint64_t timestamp = 1000000000;
+
+    // Packets pacer spreads messages evenly during the second
+    Pacer packets;
+    packets.Setup(1000, PacingUnit::Packets);
+    size_t sent = 0;
+    for (uint64_t now = timestamp; now < (timestamp + 1000000000); now += 100000)
+    {
+        while (packets.Delay(now) == 0)
+        {
+            packets.Consume(now, 100);
+            ++sent;
+        }
+    }
+    REQUIRE(sent == 1000);
+    REQUIRE(packets.bytes_paced() == 100000);
+
+    // Bytes pacer allows the burst and then delays by the message cost
+    Pacer bytes;
+    bytes.Setup(1000000, PacingUnit::Bytes, 10000);
+    sent = 0;
+    while (bytes.Delay(timestamp) == 0)
+    {
+        bytes.Consume(timestamp, 1000);
+        ++sent;
+    }
+    REQUIRE(sent == 11);
+    REQUIRE(bytes.Delay(timestamp) == 1000000);
+
+    // Launch times are spread by the message cost within the horizon
+    Pacer launch;
+    launch.Setup(1000, PacingUnit::Packets);
+    for (uint64_t i = 0; i < 4; ++i)
+    {
+        REQUIRE(launch.Delay(timestamp, 3000000) == 0);
+        REQUIRE(launch.Consume(timestamp, 1) == (timestamp + i * 1000000));
+    }
+    REQUIRE(launch.Delay(timestamp, 3000000) > 0);
+}
+
+TEST_CASE("UDP server paced multicast test", "[CppServer][Asio]")
+{
+    const std::string listen_address = "0.0.0.0";
+    const std::string multicast_address = "239.255.0.1";
+    const int multicast_port = 3342;
+    const size_t count = 50;
+    const uint64_t rate = 500;
+
+    // Create and start Asio service
+    auto service = std::make_shared<MulticastUDPService>();
+    REQUIRE(service->Start());
+    while (!service->IsStarted())
+        Thread::Yield();
+
+    // Create and start multicast server paced by packets rate
+    auto server = std::make_shared<MulticastUDPServer>(service, 0);
+    server->SetupPacing(rate, PacingUnit::Packets);
+    REQUIRE(server->Start(multicast_address, multicast_port));
+    while (!server->IsStarted())
+        Thread::Yield();
+
+    // Create and connect multicast client
+    auto client = std::make_shared<MulticastUDPClient>(service, listen_address, multicast_port);
+    client->SetupMulticast(true);
+    REQUIRE(client->ConnectAsync());
+    while (!client->IsConnected())
+        Thread::Yield();
+
+    // Join multicast group
+    client->JoinMulticastGroup(multicast_address);
+
+    // Multicast the burst of datagrams
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < count; ++i)
+        REQUIRE(server->MulticastAsync("test"));
+
+    // Wait for all data processed...
+    while (client->bytes_received() != (4 * count))
+        Thread::Yield();
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
+
+    // Check the burst was spread with the pacing rate
+    REQUIRE(duration >= (int64_t)((count - 1) * 1000 / rate));
+    REQUIRE(server->pacer().messages_paced() == count);
+    REQUIRE(server->pacer().throttles() > 0);
+    REQUIRE(server->pacer().achieved_rate() <= (1.1 * rate));
+
+    // Leave multicast group
+    client->LeaveMulticastGroup(multicast_address);
+
+    // Disconnect the multicast client
+    REQUIRE(client->DisconnectAsync());
+    while (client->IsConnected())
+        Thread::Yield();
+
+    // Stop the multicast server
+    REQUIRE(server->Stop());
+    while (server->IsStarted())
+        Thread::Yield();
+
+    // Stop the Asio service
+    REQUIRE(service->Stop());
+    while (service->IsStarted())
+        Thread::Yield();
+
+    // Check the multicast server state
+    REQUIRE(server->bytes_sent() == (4 * count));
+    REQUIRE(server->datagrams_dropped() == 0);
+    REQUIRE(!server->errors);
+    REQUIRE(!client->errors);
+}